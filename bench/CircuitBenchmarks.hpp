@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <filesystem>
+
+namespace ec {
+/**
+ * @brief Register the end-to-end benchmarks.
+ * @details For every circuit `<name>.qasm` in `<directory>/original` with a
+ * counterpart `<name>_transpiled.qasm` in `<directory>/transpiled`, the
+ * preprocessing of the pair and the check with each individual checker are
+ * registered as `EndToEnd/<stage>/<name>`.
+ * @param directory The directory containing the circuit pairs
+ */
+void registerCircuitBenchmarks(const std::filesystem::path& directory);
+} // namespace ec
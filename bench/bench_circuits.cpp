@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CircuitBenchmarks.hpp"
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ec {
+namespace {
+struct CircuitPair {
+  std::string name;
+  qc::QuantumComputation original;
+  qc::QuantumComputation transpiled;
+};
+
+// sequential execution of a single checker keeps the measurements stable
+Configuration makeConfiguration(const std::string& stage) {
+  Configuration config{};
+  config.execution.parallel = false;
+  config.execution.runAlternatingChecker = stage == "alternating";
+  config.execution.runConstructionChecker = false;
+  config.execution.runSimulationChecker = stage == "simulation";
+  config.execution.runZXChecker = stage == "zx";
+  config.simulation.maxSims = 16U;
+  config.simulation.seed = 42U;
+  return config;
+}
+
+void preprocess(benchmark::State& state, const CircuitPair& pair) {
+  const auto config = makeConfiguration("preprocessing");
+  for (auto _ : state) {
+    auto ecm = EquivalenceCheckingManager(pair.original, pair.transpiled,
+                                          config);
+    benchmark::DoNotOptimize(ecm.getFirstCircuit().getNops());
+  }
+}
+
+void check(benchmark::State& state, const CircuitPair& pair,
+           const std::string& stage) {
+  const auto config = makeConfiguration(stage);
+  for (auto _ : state) {
+    // only the check itself is measured
+    state.PauseTiming();
+    auto ecm = EquivalenceCheckingManager(pair.original, pair.transpiled,
+                                          config);
+    state.ResumeTiming();
+    ecm.run();
+    if (ecm.equivalence() == EquivalenceCriterion::NotEquivalent) {
+      state.SkipWithError("circuits are reported as not equivalent");
+      break;
+    }
+  }
+  state.counters["gates"] = static_cast<double>(pair.original.getNops() +
+                                                pair.transpiled.getNops());
+}
+} // namespace
+
+void registerCircuitBenchmarks(const std::filesystem::path& directory) {
+  const auto originals = directory / "original";
+  if (!std::filesystem::is_directory(originals)) {
+    return;
+  }
+  std::vector<std::filesystem::path> files{};
+  for (const auto& entry : std::filesystem::directory_iterator(originals)) {
+    if (entry.path().extension() == ".qasm") {
+      files.emplace_back(entry.path());
+    }
+  }
+  // register the benchmarks in a stable order
+  std::ranges::sort(files);
+
+  for (const auto& file : files) {
+    const auto name = file.stem().string();
+    const auto transpiled =
+        directory / "transpiled" / (name + "_transpiled.qasm");
+    if (!std::filesystem::exists(transpiled)) {
+      continue;
+    }
+    // the circuits are shared by all benchmarks of the pair
+    const auto pair = std::make_shared<const CircuitPair>(
+        CircuitPair{name, qasm3::Importer::importf(file.string()),
+                    qasm3::Importer::importf(transpiled.string())});
+
+    benchmark::RegisterBenchmark(
+        "EndToEnd/preprocessing/" + name,
+        [pair](benchmark::State& state) { preprocess(state, *pair); })
+        ->Unit(benchmark::kMillisecond);
+    for (const std::string stage : {"alternating", "simulation", "zx"}) {
+      benchmark::RegisterBenchmark(
+          "EndToEnd/" + stage + "/" + name,
+          [pair, stage](benchmark::State& state) {
+            check(state, *pair, stage);
+          })
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+} // namespace ec
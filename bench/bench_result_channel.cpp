@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ResultChannel.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace ec {
+namespace {
+constexpr std::size_t CAPACITY = 256U;
+
+void bmRoundTrip(benchmark::State& state) {
+  ResultChannel<std::size_t> channel(1U);
+  std::size_t value = 0U;
+  for (auto _ : state) {
+    channel.push(value);
+    value = channel.waitAndPop() + 1U;
+  }
+  benchmark::DoNotOptimize(value);
+}
+BENCHMARK(bmRoundTrip)->Name("ResultChannel/round_trip");
+
+// the given number of producers push into the channel concurrently, while the
+// benchmark thread consumes all values
+void bmProducers(benchmark::State& state) {
+  constexpr std::size_t values = 1024U;
+  const auto producers = static_cast<std::size_t>(state.range(0));
+  ResultChannel<std::size_t> channel(CAPACITY);
+  for (auto _ : state) {
+    std::vector<std::thread> threads{};
+    threads.reserve(producers);
+    for (std::size_t p = 0U; p < producers; ++p) {
+      threads.emplace_back([&channel] {
+        for (std::size_t i = 0U; i < values; ++i) {
+          channel.push(i);
+        }
+      });
+    }
+    std::size_t sum = 0U;
+    for (std::size_t i = 0U; i < producers * values; ++i) {
+      sum += channel.waitAndPop();
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(producers * values));
+}
+BENCHMARK(bmProducers)
+    ->Name("ResultChannel/producers")
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+} // namespace
+} // namespace ec
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/simulation/StateGenerator.hpp"
+#include "checker/dd/simulation/StateType.hpp"
+#include "dd/Package.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace ec {
+namespace {
+void generate(benchmark::State& state, const StateType type) {
+  const auto nqubits = static_cast<std::size_t>(state.range(0));
+  dd::Package dd(nqubits);
+  const StateGenerator generator(42U);
+  std::size_t index = 0U;
+  for (auto _ : state) {
+    // generated states carry a reference, which is released right away
+    const auto stimulus =
+        generator.generateState(dd, index++, nqubits, 0U, type);
+    benchmark::DoNotOptimize(stimulus.p);
+    dd.decRef(stimulus);
+    dd.garbageCollect();
+  }
+}
+
+void bmComputationalBasis(benchmark::State& state) {
+  generate(state, StateType::ComputationalBasis);
+}
+BENCHMARK(bmComputationalBasis)
+    ->Name("StateGenerator/computational_basis")
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
+
+void bmRandom1QBasis(benchmark::State& state) {
+  generate(state, StateType::Random1QBasis);
+}
+BENCHMARK(bmRandom1QBasis)
+    ->Name("StateGenerator/random_1Q_basis")
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
+
+void bmStabilizer(benchmark::State& state) {
+  generate(state, StateType::Stabilizer);
+}
+BENCHMARK(bmStabilizer)
+    ->Name("StateGenerator/stabilizer")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+} // namespace
+} // namespace ec
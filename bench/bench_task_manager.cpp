@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/QFT.hpp"
+#include "checker/dd/TaskManager.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+#include "checker/dd/applicationscheme/OneToOneApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/ProportionalApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/SequentialApplicationScheme.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "dd/StateGeneration.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ec {
+namespace {
+// gates are weighted by their number of controls
+std::size_t controlCost(const GateCostLookupTableKeyType& key) {
+  return key.second + 1U;
+}
+
+qc::QuantumComputation makeQFT(const benchmark::State& state) {
+  return qc::createQFT(static_cast<qc::Qubit>(state.range(0)), false);
+}
+
+void bmApplyGateMatrix(benchmark::State& state) {
+  const auto qc = makeQFT(state);
+  dd::Package dd(qc.getNqubits());
+  auto tm = TaskManager<dd::MatrixDD>(qc, dd);
+  for (auto _ : state) {
+    tm.reset();
+    auto functionality = dd::Package::makeIdent();
+    tm.incRef(functionality);
+    tm.finish(functionality);
+    benchmark::DoNotOptimize(functionality.p);
+    tm.decRef(functionality);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(qc.getNops()));
+}
+BENCHMARK(bmApplyGateMatrix)
+    ->Name("TaskManager/applyGate/matrix")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+
+void bmApplyGateVector(benchmark::State& state) {
+  const auto qc = makeQFT(state);
+  dd::Package dd(qc.getNqubits());
+  auto tm = TaskManager<dd::VectorDD>(qc, dd);
+  for (auto _ : state) {
+    tm.reset();
+    auto vector = dd::makeZeroState(qc.getNqubits(), dd);
+    tm.incRef(vector);
+    tm.finish(vector);
+    benchmark::DoNotOptimize(vector.p);
+    tm.decRef(vector);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(qc.getNops()));
+}
+BENCHMARK(bmApplyGateVector)
+    ->Name("TaskManager/applyGate/vector")
+    ->RangeMultiplier(2)
+    ->Range(4, 64);
+
+// an alternating check of G G^-1 (i.e., the QFT against itself) driven by the
+// given application scheme
+template <class MakeScheme>
+void alternate(benchmark::State& state, MakeScheme makeScheme) {
+  const auto qc = makeQFT(state);
+  dd::Package dd(qc.getNqubits());
+  auto tm1 = TaskManager<dd::MatrixDD>(qc, dd, Direction::Left);
+  auto tm2 = TaskManager<dd::MatrixDD>(qc, dd, Direction::Right);
+  const std::unique_ptr<ApplicationScheme<dd::MatrixDD>> scheme =
+      makeScheme(tm1, tm2);
+  for (auto _ : state) {
+    tm1.reset();
+    tm2.reset();
+    auto functionality = dd::Package::makeIdent();
+    tm1.incRef(functionality);
+    while (!tm1.finished() && !tm2.finished()) {
+      const auto [apply1, apply2] = (*scheme)();
+      tm1.advance(functionality, apply1);
+      tm2.advance(functionality, apply2);
+    }
+    tm1.finish(functionality);
+    tm2.finish(functionality);
+    benchmark::DoNotOptimize(functionality.p);
+    tm1.decRef(functionality);
+  }
+}
+
+void bmSequentialScheme(benchmark::State& state) {
+  alternate(state, [](auto& tm1, auto& tm2) {
+    return std::make_unique<SequentialApplicationScheme<dd::MatrixDD>>(tm1,
+                                                                       tm2);
+  });
+}
+BENCHMARK(bmSequentialScheme)
+    ->Name("ApplicationScheme/sequential")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+
+void bmOneToOneScheme(benchmark::State& state) {
+  alternate(state, [](auto& tm1, auto& tm2) {
+    return std::make_unique<OneToOneApplicationScheme<dd::MatrixDD>>(tm1, tm2);
+  });
+}
+BENCHMARK(bmOneToOneScheme)
+    ->Name("ApplicationScheme/one_to_one")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+
+void bmProportionalScheme(benchmark::State& state) {
+  alternate(state, [](auto& tm1, auto& tm2) {
+    return std::make_unique<ProportionalApplicationScheme<dd::MatrixDD>>(tm1,
+                                                                         tm2);
+  });
+}
+BENCHMARK(bmProportionalScheme)
+    ->Name("ApplicationScheme/proportional")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+
+void bmGateCostScheme(benchmark::State& state) {
+  alternate(state, [](auto& tm1, auto& tm2) {
+    return std::make_unique<GateCostApplicationScheme<dd::MatrixDD>>(
+        tm1, tm2, controlCost, false);
+  });
+}
+BENCHMARK(bmGateCostScheme)
+    ->Name("ApplicationScheme/gate_cost")
+    ->RangeMultiplier(2)
+    ->Range(4, 16);
+} // namespace
+} // namespace ec
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CircuitBenchmarks.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return EXIT_FAILURE;
+  }
+
+  // the circuit pairs can be replaced by other circuit families
+  std::filesystem::path circuits = MQT_QCEC_BENCH_CIRCUITS_DIR;
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  if (const auto* directory = std::getenv("MQT_QCEC_BENCH_CIRCUITS")) {
+    circuits = directory;
+  }
+  ec::registerCircuitBenchmarks(circuits);
+
+  benchmark::AddCustomContext("circuits", circuits.string());
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
@@ -8,6 +8,8 @@
  * Licensed under the MIT License
  */
 
+#include "checker/dd/applicationscheme/GateCostProfileStore.hpp"
+
 #include <nanobind/nanobind.h>
 
 namespace ec {
@@ -29,6 +31,11 @@ NB_MODULE(MQT_QCEC_MODULE_NAME, m) {
   registerEquivalenceCheckingManager(m);
   registerEquivalenceCriterion(m);
   registerStateType(m);
+
+  // the process-wide gate cost profile stores may hold Python cost functions,
+  // which have to be released while the interpreter is still alive
+  nb::module_::import_("atexit").attr("register")(
+      nb::cpp_function([] { GateCostProfileStore::clear(); }));
 }
 
 } // namespace ec
@@ -9,8 +9,10 @@
  */
 
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h> // NOLINT(misc-include-cleaner)
 
 namespace ec {
 
@@ -64,7 +66,27 @@ Referred to as *"compilation_flow"* in :cite:p:`burgholzer2020verifyingResultsIB
 
       .value(
           "proportional", ApplicationSchemeType::Proportional,
-          R"pb(Alternates between applications from the first and the second circuit, but applies the gates in proportion to the number of gates in each circuit.)pb");
+          R"pb(Alternates between applications from the first and the second circuit, but applies the gates in proportion to the number of gates in each circuit.)pb")
+
+      .value(
+          "adaptive", ApplicationSchemeType::Adaptive,
+          R"pb(Observes the size of the decision diagram after each step and adapts from which circuit gates are applied.
+
+While the decision diagram is as small as the identity, gates are applied proportionally.
+Once it grows, gates from the other circuit are applied until the decision diagram stops shrinking.
+The decisions are recorded in the results of the checker.
+Only works for the alternating equivalence checker.)pb");
+
+  m.def("compile_gate_cost_profile", &GateCostProfile::compile, "profile"_a,
+        "output"_a,
+        R"pb(Convert a gate cost profile to the compiled binary format.
+
+Compiled profiles can be used in place of the original profile (see :attr:`.Configuration.Application.profile`).
+They are memory-mapped instead of being parsed and are shared read-only by all checkers and processes using them.
+
+Args:
+    profile: The path to the profile in the text format.
+    output: The path the compiled profile is written to.)pb");
 }
 
 } // namespace ec
@@ -11,8 +11,11 @@
 #include "Configuration.hpp"
 
 #include <nanobind/nanobind.h>
-#include <nanobind/stl/string.h> // NOLINT(misc-include-cleaner)
-#include <nlohmann/json.hpp>     // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/function.h> // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/pair.h>     // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/string.h>   // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/vector.h>   // NOLINT(misc-include-cleaner)
+#include <nlohmann/json.hpp>       // NOLINT(misc-include-cleaner)
 
 namespace ec {
 
@@ -98,7 +101,7 @@ Defaults to :code:`0.`, which means no timeout.
 
 .. note::
 
-    Timeouts in QCEC work by checking an atomic flag in between the application of gates (for DD-based checkers) or rewrite rules (for the ZX-based checkers).
+    Timeouts in QCEC work by checking an atomic flag in between the application of gates and before each garbage collection (for DD-based checkers) or in between rewrite rules (for the ZX-based checkers).
     Unfortunately, this means that an operation needs to be fully applied before a timeout can set in.
     If a certain operation during the equivalence check takes a very long time (e.g., because the DD is becoming very large), the timeout will not be triggered until that operation is finished.
     Thus, it is possible that the timeout is not triggered at the expected time, and it might seem like the timeout is being ignored.
@@ -109,12 +112,44 @@ Defaults to :code:`0.`, which means no timeout.
 
     Consequently, timeouts in QCEC are a best-effort feature, and they should not be relied upon to always work as expected.
     From experience, they tend to work reliably well for the ZX-based checkers, but they are less reliable for the DD-based checkers.)pb")
+
+      .def_rw(
+          "checkpoint_file", &Configuration::Execution::checkpointFile,
+          R"pb(Set a file the alternating checker writes its state to, so that a long-running check can be resumed.
+
+The state consists of the positions in both circuits, the tracked permutations, and the accumulated decision diagram (in a compact binary format). It is written every :attr:`checkpoint_interval` seconds and whenever the checker is stopped without a result (e.g., due to a timeout). A later check of the same (preprocessed) circuits with the same application scheme resumes from the checkpoint, also on a different machine. Checkpoints of other checks are ignored. The lookahead and adaptive application schemes do not support checkpoints. Defaults to an empty string, which disables checkpoints.)pb")
+
+      .def_rw("checkpoint_interval",
+              &Configuration::Execution::checkpointInterval,
+              R"pb(Set the interval (in seconds) in which checkpoints are written.
+
+See :attr:`checkpoint_file`. Defaults to :code:`300.`.)pb")
       .def_rw("run_construction_checker",
               &Configuration::Execution::runConstructionChecker,
               R"pb(Set whether the construction checker should be executed.
 
 Defaults to :code:`False` since the alternating checker is to be preferred in most cases.)pb")
 
+      .def_rw(
+          "construction_threads",
+          &Configuration::Execution::constructionThreads,
+          R"pb(Set the number of threads the construction checker uses to build the functionality of each circuit.
+
+Values above :code:`1` split each circuit into (at most) that many segments. Their unitaries are built concurrently in separate DD packages and then multiplied in a balanced tree. Circuits that are too small to be split are built gate by gate. Defaults to :code:`1`.)pb")
+
+      .def_rw(
+          "slices", &Configuration::Execution::slices,
+          R"pb(Set the number of slices the circuits are cut into at synchronization points before running the full check.
+
+If both circuits contain the same number of barriers acting on all qubits, they are cut at these barriers. Otherwise, each slice contains the same fraction of the gates of each circuit. The pairs of slices are checked independently (and concurrently in the parallel flow), which keeps the decision diagrams small for deep circuits that have only been rewritten locally. If all pairs are equivalent, so are the circuits. Otherwise, the regular check is run on the full circuits within the remaining time. Slicing is skipped for partial equivalence checking and for circuits with ancillary or garbage qubits. Values below :code:`2` disable slicing. Defaults to :code:`0`.)pb")
+
+      .def_rw(
+          "pipelined_preprocessing",
+          &Configuration::Execution::pipelinedPreprocessing,
+          R"pb(Set whether simulations should already start while the circuits are being preprocessed.
+
+If enabled (and the simulation checker is configured), the manager simulates copies of the circuits that have only passed the optimizations required for correctness (e.g., the transformation of dynamic circuits) on a separate thread while the remaining optimization passes run. If these simulations show non-equivalence, :meth:`~.EquivalenceCheckingManager.run` reports the result right away (see :attr:`~.EquivalenceCheckingManager.Results.decided_during_preprocessing`). Otherwise, they are discarded and the regular check is run. Defaults to :code:`False`.)pb")
+
       .def_rw("run_simulation_checker",
               &Configuration::Execution::runSimulationChecker,
               R"pb(Set whether the simulation checker should be executed.
@@ -132,17 +167,108 @@ Defaults to :code:`True` since staying close to the identity can quickly show th
 
 Defaults to :code:`True` but arbitrary multi-controlled operations are only partially supported.)pb")
 
+      .def_rw(
+          "run_clifford_checker",
+          &Configuration::Execution::runCliffordChecker,
+          R"pb(Set whether the stabilizer-tableau checker should be executed for Clifford circuits.
+
+If both circuits only consist of Clifford operations, it runs before all other checkers and decides the check in time polynomial in the number of qubits, also in the presence of ancillary qubits. Since stabilizer tableaux do not capture global phases, equivalent circuits are reported as :attr:`~.EquivalenceCriterion.equivalent_up_to_global_phase`. Partial equivalence checking of circuits with garbage qubits is not supported. Defaults to :code:`False`.)pb")
+
       .def_rw(
           "numerical_tolerance", &Configuration::Execution::numericalTolerance,
           R"pb(Set the numerical tolerance of the underlying decision diagram package.
 
 Defaults to :code:`2e-13` and should only be changed by users who know what they are doing.)pb")
 
+      .def_rw(
+          "simulation_tolerance",
+          &Configuration::Execution::simulationTolerance,
+          R"pb(Set the numerical tolerance of the decision diagram package of the simulation checker.
+
+A coarser tolerance than :attr:`numerical_tolerance` merges more edge weights and keeps the decision diagrams small, which is usually sufficient for screening for non-equivalence. Since the tolerance is a process-wide setting of the decision diagram package, checkers running concurrently (e.g., if :attr:`parallel` is set) share the smallest tolerance among them. Checks of different managers running at the same time must use the same tolerance, and sequential checks with differing per-checker tolerances must not overlap with any other check. Otherwise, the later check raises a :class:`RuntimeError`. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.)pb")
+
+      .def_rw(
+          "alternating_tolerance",
+          &Configuration::Execution::alternatingTolerance,
+          R"pb(Set the numerical tolerance of the decision diagram package of the alternating checker.
+
+See :attr:`simulation_tolerance` for how the tolerances of concurrently running checkers are combined. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.)pb")
+
+      .def_rw(
+          "construction_tolerance",
+          &Configuration::Execution::constructionTolerance,
+          R"pb(Set the numerical tolerance of the decision diagram package of the construction checker.
+
+See :attr:`simulation_tolerance` for how the tolerances of concurrently running checkers are combined. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.)pb")
+
       .def_rw("set_all_ancillae_garbage",
               &Configuration::Execution::setAllAncillaeGarbage,
               R"pb(Set whether all ancillae should be treated as garbage qubits.
 
-Defaults to :code:`False` but the ZX-calculus checker will not be able to handle circuits with non-garbage ancillae.)pb");
+Defaults to :code:`False` but the ZX-calculus checker will not be able to handle circuits with non-garbage ancillae.)pb")
+
+      .def_rw(
+          "gc_interval", &Configuration::Execution::gcInterval,
+          R"pb(Set after how many applied gates the garbage collection of the DD packages is invoked.
+
+Defaults to :code:`1`, i.e., after every gate. Larger values amortize the cost of the collection over multiple gates at the expense of a higher memory footprint. A value of :code:`0` disables periodic garbage collection.)pb")
+
+      .def_rw(
+          "gc_memory_threshold", &Configuration::Execution::gcMemoryThreshold,
+          R"pb(Set a resident memory budget (in bytes) above which garbage collection in the DD packages is forced.
+
+Defaults to :code:`0`, which disables the memory-based trigger.)pb")
+
+      .def_rw(
+          "dd_unique_table_buckets",
+          &Configuration::Execution::ddUniqueTableBuckets,
+          R"pb(Set the number of buckets of the unique table that is predominantly used by the DD-based checkers (rounded up to the next power of two).
+
+Defaults to :code:`0`, which means that the size is derived from the number of qubits of the circuits. The chosen sizes are reported in the results of each checker.)pb")
+
+      .def_rw(
+          "dd_compute_table_buckets",
+          &Configuration::Execution::ddComputeTableBuckets,
+          R"pb(Set the number of buckets of the compute tables that are predominantly used by the DD-based checkers (rounded up to the next power of two).
+
+Defaults to :code:`0`, which means that the size is derived from the number of qubits and gates of the circuits. The chosen sizes are reported in the results of each checker.)pb")
+
+      .def_rw(
+          "memory_limit", &Configuration::Execution::memoryLimit,
+          R"pb(Set a limit (in bytes) on the resident memory of the process during the DD-based checks.
+
+A DD-based checker that still exceeds the limit after a forced garbage collection stops without a result, while the remaining checkers continue. Defaults to :code:`0`, which means no limit.)pb")
+
+      .def_rw(
+          "checker_memory_limit",
+          &Configuration::Execution::checkerMemoryLimit,
+          R"pb(Set a limit (in bytes) on the memory occupied by the nodes of the DD package of each DD-based checker.
+
+A checker exceeding this limit stops without a result, while the remaining checkers continue. The peak memory of each checker is reported in its results. Defaults to :code:`0`, which means no limit.)pb")
+
+      .def_rw(
+          "instrumentation", &Configuration::Execution::instrumentation,
+          R"pb(Set whether the DD-based checkers should be instrumented. Defaults to :code:`False`.
+
+If enabled, the results of each DD-based checker contain the time spent in the individual phases of the check (:code:`initialize`, :code:`execute`, :code:`finish`, :code:`postprocess`, and :code:`check_equivalence`), the peak and final number of DD nodes, and the statistics of the unique and compute tables of its DD package. Tracking the peak size requires traversing the DDs after every step, which slows down the check.)pb")
+
+      .def_rw(
+          "counterexample_amplitudes",
+          &Configuration::Execution::counterexampleAmplitudes,
+          R"pb(The number of amplitudes recorded in the compact :attr:`~.EquivalenceCheckingManager.Results.counterexample`.
+
+The amplitudes in which both output states differ the most are recorded (for circuits with at most 20 qubits).
+Defaults to :code:`8`.)pb")
+
+      .def_rw(
+          "retain_counterexample_dds",
+          &Configuration::Execution::retainCounterexampleDDs,
+          R"pb(Whether to keep the decision diagrams of a counterexample after the check.
+
+The decision diagrams :attr:`~.EquivalenceCheckingManager.Results.cex_input`, :attr:`~.EquivalenceCheckingManager.Results.cex_output1`, and :attr:`~.EquivalenceCheckingManager.Results.cex_output2` keep the DD packages of the checkers (and all of their nodes) alive.
+If disabled, only the compact :attr:`~.EquivalenceCheckingManager.Results.counterexample` is kept and the packages of all finished checkers are released as soon as the check has been decided.
+This reduces the memory retained by long-running processes checking many circuits.
+Defaults to :code:`True`.)pb");
 
   // optimization options
   optimizations.def(nb::init<>())
@@ -198,7 +324,35 @@ Can be helpful for dynamic quantum circuits that have been transformed to a stat
           &Configuration::Optimizations::elidePermutations,
           R"pb(Elide permutations from the circuit by permuting the qubits in the circuit and eliminating SWAP gates from the circuits.
 
-Defaults to :code:`True` as this typically boosts performance.)pb");
+Defaults to :code:`True` as this typically boosts performance.)pb")
+
+      .def_rw(
+          "strip_common_gates",
+          &Configuration::Optimizations::stripCommonGates,
+          R"pb(Remove the longest common prefix and suffix of operations from both circuits before any checker runs.
+
+Compiled circuits often only differ from the original in a few places. Identical leading operations cancel directly, and identical trailing operations conjugate the remaining difference, which does not change whether it resembles the identity (up to a global phase). Detecting them is linear in the size of the circuits and saves the corresponding decision diagram operations in all checkers. The pass is skipped for partial equivalence checking and circuits with ancillary or garbage qubits. Defaults to :code:`False`.)pb")
+
+      .def_rw(
+          "decompose_components",
+          &Configuration::Optimizations::decomposeComponents,
+          R"pb(Split the circuits into independent qubit components and check each of them as a separate sub-problem.
+
+Two qubits belong to the same component if a gate of either circuit acts on both of them or if the permutations of either circuit map one onto the other. The circuits are equivalent if and only if all components are. In the parallel flow, the components are checked concurrently. The decomposition is skipped for partial equivalence checking, incomplete output permutations, and circuits with non-unitary operations. Defaults to :code:`False`.)pb")
+
+      .def_rw(
+          "cache_preprocessing",
+          &Configuration::Optimizations::cachePreprocessing,
+          R"pb(Reuse the results of preprocessing (i.e., the optimization passes as well as the removal of idle qubits and the setup of ancillary qubits) whenever identical circuits are checked with identical optimization options.
+
+Cached circuits are kept in memory for the lifetime of the process. Defaults to :code:`False`.)pb")
+
+      .def_rw(
+          "preprocessing_cache_directory",
+          &Configuration::Optimizations::preprocessingCacheDirectory,
+          R"pb(A directory in which preprocessed circuits are additionally persisted so that they can be reused across processes (e.g., repeated CI runs).
+
+Setting a directory enables :attr:`cache_preprocessing`. Defaults to an empty string, which means that nothing is written to disk.)pb");
 
   // application options
   application.def(nb::init<>())
@@ -220,7 +374,56 @@ Defaults to :code:`True` as this typically boosts performance.)pb");
           R"pb(The :attr:`Gate Cost <.ApplicationScheme.gate_cost>` application scheme can be configured with a profile that specifies the cost of gates.
 
 This profile can be set via a file constructed like a lookup table.
-Every line :code:`<GATE_ID> <N_CONTROLS> <COST>` specifies the cost for a given gate type and with a certain number of controls, e.g., :code:`X 0 1` denotes that a single-qubit X gate has a cost of :code:`1`, while :code:`X 2 15` denotes that a Toffoli gate has a cost of :code:`15`.)pb");
+Every line :code:`<GATE_ID> <N_CONTROLS> <COST>` specifies the cost for a given gate type and with a certain number of controls, e.g., :code:`X 0 1` denotes that a single-qubit X gate has a cost of :code:`1`, while :code:`X 2 15` denotes that a Toffoli gate has a cost of :code:`15`.
+
+Alternatively, a profile compiled via :func:`~.compile_gate_cost_profile` can be used, which avoids parsing the profile and is memory-mapped.
+In any case, the profile is only loaded once per run and is shared by all checkers.)pb")
+
+      .def_rw(
+          "profile_store", &Configuration::Application::profileStore,
+          R"pb(Path of a file that persists the gate costs computed by the :attr:`cost_function` (if no :attr:`profile` is set).
+
+Instead of generating a complete profile up front, the cost of a gate is only computed once it is needed, i.e., once it occurs in a checked circuit.
+Each cost is computed once per process, appended to the file in the format of a :attr:`profile`, and reused by all later runs that use the same file.
+Consequently, the file can also be used as a :attr:`profile` later on.)pb")
+
+      .def_rw(
+          "cost_function", &Configuration::Application::costFunction,
+          R"pb(The function computing the cost of a gate for the :attr:`Gate Cost <.ApplicationScheme.gate_cost>` application scheme if no :attr:`profile` is set.
+
+It is called with the type of a gate and its number of controls, e.g., via :func:`~.create_cost_function`, and returns the cost of the gate.
+By default, every gate has a cost of :code:`1`.)pb")
+
+      .def_rw(
+          "lookahead_estimate_threshold",
+          &Configuration::Application::lookaheadEstimateThreshold,
+          R"pb(The :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme usually computes the products with the next gates of both circuits and keeps the smaller one.
+
+If set to a positive value, the size of both products is first estimated from the node counts of the current decision diagram at the levels touched by the respective gates.
+Whenever one estimate is smaller than the other by at least this factor, only the corresponding product is computed.
+
+Defaults to :code:`0.`, i.e., no estimation.)pb")
+
+      .def_rw(
+          "lookahead_multiplication_budget",
+          &Configuration::Application::lookaheadMultiplicationBudget,
+          R"pb(Bounds the size (in nodes) of the decision diagram for which the :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme speculatively computes both candidate products.
+
+For larger decision diagrams, only the product with the smaller estimated size is computed.
+A value of :code:`0` means that both products are always computed when the estimate is inconclusive.
+
+Defaults to :code:`0`.)pb")
+
+      .def_rw(
+          "alternating_portfolio",
+          &Configuration::Application::alternatingPortfolio,
+          R"pb(Additional :class:`.ApplicationScheme` instances that race the :attr:`alternating_scheme` when checking in parallel.
+
+Each scheme is used by a further alternating checker running concurrently, and the first checker to reach a result cancels all others.
+Listing a scheme multiple times (or listing the :attr:`alternating_scheme` itself) runs the repeated checkers with decision diagram packages whose tables are twice as large as those of the previous checker with that scheme.
+The portfolio takes threads away from the simulation checkers and is ignored in sequential runs.
+
+Defaults to an empty list.)pb");
 
   // functionality options
   functionality.def(nb::init<>())
@@ -245,7 +448,16 @@ If set to :code:`True`, a check for partial equivalence will be performed and th
 If set to :code:`False`, the checker will output 'not equivalent' for circuits that are partially equivalent but not totally equivalent.
 In particular, garbage qubits will be treated as if they were measured qubits.
 
-Defaults to :code:`False`.)pb");
+Defaults to :code:`False`.)pb")
+
+      .def_rw(
+          "zx_stall_rounds", &Configuration::Functionality::zxStallRounds,
+          R"pb(The number of consecutive rounds of simplification without a decrease in the size of the ZX-diagram after which the ZX checker gives up.
+
+The checker then stops without a result, which frees its thread for further simulations.
+A value of :code:`0` disables this behavior.
+
+Defaults to :code:`0`.)pb");
 
   // simulation options
   simulation.def(nb::init<>())
@@ -274,7 +486,69 @@ Defaults to :attr:`.StateType.computational_basis`.)pb")
       .def_rw("seed", &Configuration::Simulation::seed,
               R"pb(The seed used in the quantum state generator.
 
-Defaults to :code:`0`, which means that the seed is chosen non-deterministically for each program run.)pb");
+Defaults to :code:`0`, which means that the seed is chosen non-deterministically for each program run.)pb")
+
+      .def_rw(
+          "first_stimulus", &Configuration::Simulation::firstStimulus,
+          R"pb(The index of the first stimulus that is simulated.
+
+The stimuli only depend on the :attr:`seed` and their index.
+Hence, multiple processes (e.g., on different nodes of a cluster) using the same non-zero seed simulate disjoint stimuli if they are assigned disjoint ranges of :attr:`max_sims` stimuli starting at this index.
+Ignored in :attr:`exhaustive` mode, which always covers all basis states.
+Defaults to :code:`0`.)pb")
+
+      .def_rw(
+          "stimuli_per_run", &Configuration::Simulation::stimuliPerRun,
+          R"pb(The number of stimuli that are propagated through the circuits by a single simulation run.
+
+Batching multiple stimuli in one run allows to construct each gate's decision diagram only once for the whole batch and to share the decision diagram package between the stimuli.
+Each stimulus still counts as one simulation towards :attr:`max_sims`.
+Defaults to :code:`1`.)pb")
+
+      .def_rw(
+          "exhaustive", &Configuration::Simulation::exhaustive,
+          R"pb(Whether to simulate all computational basis states instead of a random selection.
+
+Only applies to :attr:`.StateType.computational_basis` stimuli and circuits with at most 20 (non-ancillary) qubits, in which case :attr:`max_sims` is set to the number of basis states.
+The basis states are enumerated in Gray-code order, such that consecutive stimuli only differ in a single qubit and share most of their intermediate results in the compute tables.
+If every simulation yields exactly the same output state for both circuits (including the phase), the circuits are proven to be equivalent.
+Defaults to :code:`False`.)pb")
+
+      .def_rw(
+          "false_negative_bound", &Configuration::Simulation::falseNegativeBound,
+          R"pb(Stop the simulations once the probability that an existing error would have gone undetected by all simulations so far drops below this bound.
+
+The probability is estimated from the assumed detection probabilities of the individual stimuli (see :attr:`basis_detection_probability`, :attr:`random_1q_detection_probability`, and :attr:`stabilizer_detection_probability`), i.e., after :math:`k_t` successful simulations with stimuli of type :math:`t`, it is bounded by :math:`\prod_t (1 - p_t)^{k_t}`.
+The number of simulations is still limited by :attr:`max_sims`.
+Defaults to :code:`0.`, which disables early stopping.)pb")
+
+      .def_rw(
+          "basis_detection_probability",
+          &Configuration::Simulation::basisDetectionProbability,
+          R"pb(The assumed probability that a single :attr:`computational basis <.StateType.computational_basis>` stimulus detects an existing error.
+
+Defaults to :code:`0.5`.)pb")
+
+      .def_rw(
+          "random_1q_detection_probability",
+          &Configuration::Simulation::random1QDetectionProbability,
+          R"pb(The assumed probability that a single :attr:`random single-qubit basis <.StateType.random_1q_basis>` stimulus detects an existing error.
+
+Defaults to :code:`0.75`.)pb")
+
+      .def_rw(
+          "stabilizer_detection_probability",
+          &Configuration::Simulation::stabilizerDetectionProbability,
+          R"pb(The assumed probability that a single :attr:`stabilizer <.StateType.stabilizer>` stimulus detects an existing error.
+
+Defaults to :code:`0.9`.)pb")
+
+      .def_rw(
+          "adaptive_state_type", &Configuration::Simulation::adaptiveStateType,
+          R"pb(Whether to choose the type of stimuli for each simulation run adaptively instead of always using :attr:`state_type`.
+
+Each type is tried once, after which the simulations use the type that gathered the most evidence per second so far, where the evidence of a stimulus is :math:`-\log(1 - p_t)` for its detection probability :math:`p_t`.
+Defaults to :code:`False`.)pb");
 
   // parameterized options
   parameterized.def(nb::init<>())
@@ -294,7 +568,8 @@ For parameterized circuits that cannot be shown to be equivalent by the ZX check
 The first instantiation tries to set as many gate parameters to 0.
 The last instantiations initializes the parameters with random values to guarantee completeness of the equivalence check.
 Because random instantiation is costly, additional instantiations can be performed that lead to simpler equivalence checking instances as the random instantiation.
-This option changes how many of those additional checks are performed.)pb");
+This option changes how many of those additional checks are performed.
+When checking in parallel, the instantiations are checked concurrently and the first non-equivalent instantiation (in the above order) is reported.)pb");
 }
 
 } // namespace ec
@@ -8,17 +8,25 @@
  * Licensed under the MIT License
  */
 
+#include "BatchEquivalenceCheckingManager.hpp"
 #include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "IncrementalEquivalenceCheckingManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <cstddef>
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/complex.h>     // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/optional.h>    // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/pair.h>        // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/string.h>      // NOLINT(misc-include-cleaner)
 #include <nanobind/stl/string_view.h> // NOLINT(misc-include-cleaner)
+#include <nanobind/stl/vector.h>      // NOLINT(misc-include-cleaner)
 #include <nlohmann/json.hpp>          // NOLINT(misc-include-cleaner)
 #include <string>
+#include <utility>
 
 namespace ec {
 
@@ -40,12 +48,33 @@ It features many configuration options that orchestrate the procedure.)pb");
       ecm, "Results",
       R"pb(Captures the main results and statistics from :meth:`~.EquivalenceCheckingManager.run`.)pb");
 
+  auto progress = nb::class_<EquivalenceCheckingManager::Progress>(
+      ecm, "Progress",
+      R"pb(A snapshot of the progress of a running equivalence check (see :meth:`~.EquivalenceCheckingManager.set_progress_callback`).)pb");
+
+  auto checkerProgress =
+      nb::class_<EquivalenceCheckingManager::Progress::Checker>(
+          progress, "Checker", R"pb(The progress of a single checker.)pb");
+
+  auto counterexample = nb::class_<EquivalenceCheckingManager::Counterexample>(
+      ecm, "Counterexample",
+      R"pb(A compact description of a counterexample that does not depend on any decision diagram package.)pb");
+
+  auto amplitude =
+      nb::class_<EquivalenceCheckingManager::Counterexample::Amplitude>(
+          counterexample, "Amplitude",
+          R"pb(An amplitude of both output states of a counterexample.)pb");
+
   // Constructors
   ecm.def(
       nb::init<const qc::QuantumComputation&, const qc::QuantumComputation&,
                Configuration>(),
       "circ1"_a, "circ2"_a, "config"_a = Configuration(),
-      R"pb(Create an equivalence checking manager for two circuits and configure it with a :class:`.Configuration` object.)pb");
+      // the preprocessing of the circuits does not touch any Python objects
+      nb::call_guard<nb::gil_scoped_release>(),
+      R"pb(Create an equivalence checking manager for two circuits and configure it with a :class:`.Configuration` object.
+
+The circuits are copied and preprocessed without holding the GIL, so they must not be modified by other threads during the construction.)pb");
 
   // Access to circuits
   ecm.def_prop_ro("qc1", &EquivalenceCheckingManager::getFirstCircuit,
@@ -65,8 +94,37 @@ It features many configuration options that orchestrate the procedure.)pb");
       R"pb(The configuration of the equivalence checking manager.)pb");
 
   // Run
+  // the GIL is released such that other Python threads (including the
+  // progress callback) can run while the check is in progress
   ecm.def("run", &EquivalenceCheckingManager::run,
-          R"pb(Execute the equivalence check as configured.)pb");
+          nb::call_guard<nb::gil_scoped_release>(),
+          R"pb(Execute the equivalence check as configured.
+
+The GIL is released during the check, such that multiple managers can be run concurrently from different Python threads.)pb");
+
+  ecm.def(
+      "set_progress_callback",
+      [](EquivalenceCheckingManager& manager, const nb::object& callback,
+         const double interval) {
+        EquivalenceCheckingManager::ProgressCallback cb{};
+        if (!callback.is_none()) {
+          cb = [callback](const EquivalenceCheckingManager::Progress& p) {
+            const nb::gil_scoped_acquire acquire;
+            callback(p);
+          };
+        }
+        manager.setProgressCallback(std::move(cb), interval);
+      },
+      "callback"_a.none(), "interval"_a = 1.,
+      R"pb(Report the progress of subsequent runs to a callback.
+
+While a check is running, the callback is periodically invoked (from a separate thread) with a :class:`~.EquivalenceCheckingManager.Progress` snapshot.
+A final snapshot is reported once the check has finished.
+Exceptions raised by the callback stop the reporting and are re-raised once the check has finished.
+
+Args:
+    callback: A callable taking a :class:`~.EquivalenceCheckingManager.Progress` object or :code:`None` to disable the reporting.
+    interval: The time between two snapshots (in seconds).)pb");
 
   // Results
   ecm.def_prop_ro("results", &EquivalenceCheckingManager::getResults,
@@ -114,6 +172,16 @@ Args:
               &EquivalenceCheckingManager::Results::preprocessingTime,
               R"pb(Time spent during preprocessing (in seconds).)pb")
 
+      .def_rw(
+          "preprocessing_cache_hits",
+          &EquivalenceCheckingManager::Results::preprocessingCacheHits,
+          R"pb(Number of circuits whose preprocessing was served from the preprocessing cache.)pb")
+
+      .def_rw(
+          "decided_during_preprocessing",
+          &EquivalenceCheckingManager::Results::decidedDuringPreprocessing,
+          R"pb(Whether non-equivalence has already been shown by the simulations that ran while the circuits were preprocessed (see :attr:`~.Configuration.Execution.pipelined_preprocessing`).)pb")
+
       .def_rw("check_time", &EquivalenceCheckingManager::Results::checkTime,
               R"pb(Time spent during equivalence check (in seconds).)pb")
 
@@ -128,6 +196,11 @@ Args:
               &EquivalenceCheckingManager::Results::performedSimulations,
               R"pb(Number of simulations that have been finished.)pb")
 
+      .def_rw(
+          "false_negative_probability",
+          &EquivalenceCheckingManager::Results::falseNegativeProbability,
+          R"pb(Bound on the probability that an existing error went undetected by all successful simulations, based on the assumed detection probabilities of the stimuli.)pb")
+
       .def_rw(
           "cex_input", &EquivalenceCheckingManager::Results::cexInput,
           R"pb(DD representation of the initial state that produced a counterexample.)pb")
@@ -140,11 +213,36 @@ Args:
           "cex_output2", &EquivalenceCheckingManager::Results::cexOutput2,
           R"pb(DD representation of the second circuit's counterexample output state.)pb")
 
+      .def_rw(
+          "cex_stimulus", &EquivalenceCheckingManager::Results::cexStimulus,
+          R"pb(Index of the stimulus that produced the counterexample, if the counterexample stems from a simulation.
+
+Together with the :attr:`~.Configuration.Simulation.seed`, the index suffices to reproduce the counterexample.)pb")
+
+      .def_rw(
+          "counterexample",
+          &EquivalenceCheckingManager::Results::counterexample,
+          R"pb(Compact description of the counterexample, if non-equivalence has been shown by a simulation.
+
+In contrast to the counterexample decision diagrams, it remains valid after the decision diagram packages of the checkers have been released (see :attr:`~.Configuration.Execution.retain_counterexample_dds`).)pb")
+
       .def_rw(
           "performed_instantiations",
           &EquivalenceCheckingManager::Results::performedInstantiations,
           R"pb(Number of circuit instantiations performed during equivalence checking of parameterized quantum circuits.)pb")
 
+      .def_rw(
+          "components", &EquivalenceCheckingManager::Results::components,
+          R"pb(Number of independent qubit components that have been checked separately (0 if the check has not been decomposed).
+
+See :attr:`~.Configuration.Optimizations.decompose_components`.)pb")
+
+      .def_rw(
+          "slices", &EquivalenceCheckingManager::Results::slices,
+          R"pb(Number of slices that have been checked separately (0 if the circuits have not been sliced).
+
+See :attr:`~.Configuration.Execution.slices`.)pb")
+
       .def_prop_rw(
           "checker_results",
           [](const EquivalenceCheckingManager::Results& results) {
@@ -182,6 +280,262 @@ Args:
         return "<EquivalenceCheckingManager.Results: " +
                toString(res.equivalence) + ">";
       });
+
+  // EquivalenceCheckingManager::Progress bindings
+  progress
+      .def_ro("elapsed", &EquivalenceCheckingManager::Progress::elapsed,
+              R"pb(Time since the start of the check (in seconds).)pb")
+      .def_ro("started_simulations",
+              &EquivalenceCheckingManager::Progress::startedSimulations,
+              R"pb(Number of simulations that have been started.)pb")
+      .def_ro(
+          "performed_simulations",
+          &EquivalenceCheckingManager::Progress::performedSimulations,
+          R"pb(Number of simulations that have been finished successfully.)pb")
+      .def_ro("checkers", &EquivalenceCheckingManager::Progress::checkers,
+              R"pb(The progress of the individual checkers.)pb");
+
+  checkerProgress
+      .def_ro("name", &EquivalenceCheckingManager::Progress::Checker::name,
+              R"pb(The name of the checker.)pb")
+      .def_prop_ro(
+          "gates1",
+          [](const EquivalenceCheckingManager::Progress::Checker& checker) {
+            return checker.progress.gates1;
+          },
+          R"pb(Number of gates of the first circuit applied so far.)pb")
+      .def_prop_ro(
+          "gates2",
+          [](const EquivalenceCheckingManager::Progress::Checker& checker) {
+            return checker.progress.gates2;
+          },
+          R"pb(Number of gates of the second circuit applied so far.)pb")
+      .def_prop_ro(
+          "nodes",
+          [](const EquivalenceCheckingManager::Progress::Checker& checker) {
+            return checker.progress.nodes;
+          },
+          R"pb(Size of the decision diagram (or number of vertices of the ZX-diagram) when it was last sampled.)pb")
+      .def_prop_ro(
+          "rewrites",
+          [](const EquivalenceCheckingManager::Progress::Checker& checker) {
+            return checker.progress.rewrites;
+          },
+          R"pb(Number of rewrites applied by the ZX checker.)pb");
+
+  // EquivalenceCheckingManager::Counterexample bindings
+  counterexample
+      .def_ro("stimulus_type",
+              &EquivalenceCheckingManager::Counterexample::stimulusType,
+              R"pb(The type of the stimulus that produced the counterexample.)pb")
+      .def_ro(
+          "basis_state", &EquivalenceCheckingManager::Counterexample::basisState,
+          R"pb(Index of the input state if it is a computational basis state.)pb")
+      .def_ro(
+          "amplitudes", &EquivalenceCheckingManager::Counterexample::amplitudes,
+          R"pb(The amplitudes in which both output states differ the most (in descending order of the difference).
+
+Only recorded for circuits with at most 20 qubits (see :attr:`~.Configuration.Execution.counterexample_amplitudes`).)pb")
+      .def(
+          "json",
+          [](const EquivalenceCheckingManager::Counterexample& cex) {
+            const auto json = nb::module_::import_("json");
+            const auto loads = json.attr("loads");
+            const auto dict = loads(cex.json().dump());
+            return nb::cast<nb::typed<nb::dict, nb::str, nb::any>>(dict);
+          },
+          R"pb(Returns a JSON-style dictionary of the counterexample.)pb");
+
+  amplitude
+      .def_ro("index",
+              &EquivalenceCheckingManager::Counterexample::Amplitude::index,
+              R"pb(The index of the basis state.)pb")
+      .def_ro("output1",
+              &EquivalenceCheckingManager::Counterexample::Amplitude::output1,
+              R"pb(The amplitude of the first circuit's output state.)pb")
+      .def_ro("output2",
+              &EquivalenceCheckingManager::Counterexample::Amplitude::output2,
+              R"pb(The amplitude of the second circuit's output state.)pb");
+
+  // BatchEquivalenceCheckingManager bindings
+  auto batch = nb::class_<BatchEquivalenceCheckingManager>(
+      m, "BatchEquivalenceCheckingManager",
+      R"pb(Check the equivalence of many pairs of circuits at once.
+
+All pairs are checked with the same :class:`.Configuration`.
+The checkers of all pairs share a single pool of :attr:`~.Configuration.Execution.nthreads` worker threads and at most that many pairs are checked concurrently.
+Circuits that are part of multiple pairs are only optimized once.)pb");
+
+  batch
+      .def(nb::init<Configuration>(), "config"_a = Configuration(),
+           R"pb(Create a batch with the given :class:`.Configuration`.)pb")
+
+      .def("add_circuit",
+           nb::overload_cast<const qc::QuantumComputation&>(
+               &BatchEquivalenceCheckingManager::addCircuit),
+           "circ"_a,
+           R"pb(Register a circuit with the batch.
+
+Args:
+    circ: The circuit to register.
+
+Returns:
+    The id of the circuit which can be used in :meth:`add_pair`.)pb")
+
+      .def(
+          "add_pair",
+          nb::overload_cast<std::size_t, std::size_t>(
+              &BatchEquivalenceCheckingManager::addPair),
+          "circ1"_a, "circ2"_a,
+          R"pb(Add a pair of previously registered circuits.
+
+Args:
+    circ1: The id of the first circuit.
+    circ2: The id of the second circuit.
+
+Returns:
+    The index of the pair.)pb")
+
+      .def(
+          "add_pair",
+          nb::overload_cast<const qc::QuantumComputation&,
+                            const qc::QuantumComputation&>(
+              &BatchEquivalenceCheckingManager::addPair),
+          "circ1"_a, "circ2"_a,
+          R"pb(Register both circuits and add them as a pair.
+
+Args:
+    circ1: The first circuit.
+    circ2: The second circuit.
+
+Returns:
+    The index of the pair.)pb")
+
+      .def(
+          "run",
+          [](BatchEquivalenceCheckingManager& manager,
+             const nb::object& callback) {
+            BatchEquivalenceCheckingManager::ResultCallback cb{};
+            if (!callback.is_none()) {
+              cb = [&callback](const std::size_t index,
+                               const EquivalenceCheckingManager::Results& res) {
+                const nb::gil_scoped_acquire acquire;
+                callback(index, res);
+              };
+            }
+            const nb::gil_scoped_release release;
+            manager.run(cb);
+          },
+          "callback"_a = nb::none(),
+          R"pb(Check all pairs that have been added.
+
+Args:
+    callback: An optional callable that is invoked with the index and the :class:`~.EquivalenceCheckingManager.Results` of each pair as soon as it has been checked.
+        Counterexample decision diagrams are not retained in the results of a batch.)pb")
+
+      .def_prop_ro(
+          "results", &BatchEquivalenceCheckingManager::getResults,
+          R"pb(The results of all pairs (in the order in which the pairs have been added).)pb")
+
+      .def_prop_rw(
+          "configuration", &BatchEquivalenceCheckingManager::getConfiguration,
+          [](BatchEquivalenceCheckingManager& manager,
+             const Configuration& config) {
+            manager.getConfiguration() = config;
+          },
+          nb::rv_policy::reference_internal,
+          R"pb(The configuration used for all pairs.)pb")
+
+      .def("__len__", &BatchEquivalenceCheckingManager::numPairs)
+      .def("__repr__", [](const BatchEquivalenceCheckingManager& manager) {
+        return "<BatchEquivalenceCheckingManager: " +
+               std::to_string(manager.numPairs()) + " pairs>";
+      });
+
+  // IncrementalEquivalenceCheckingManager bindings
+  auto incremental = nb::class_<IncrementalEquivalenceCheckingManager>(
+      m, "IncrementalEquivalenceCheckingManager",
+      R"pb(Re-verify a pair of circuits after small edits of the second circuit.
+
+Once the pair has been shown equivalent, an edited version of the second circuit is only checked in the window of operations in which it differs from the previous version.
+Since all other operations are shared by both versions, this takes about as long as verifying the edited region.
+Whenever this shortcut does not apply (e.g., the layouts changed or the window contains non-unitary operations) or is inconclusive, the full pair is checked.)pb");
+
+  incremental
+      .def(nb::init<const qc::QuantumComputation&,
+                    const qc::QuantumComputation&, Configuration>(),
+           "circ1"_a, "circ2"_a, "config"_a = Configuration(),
+           R"pb(Create a manager for the given pair of circuits.
+
+The pair is not checked until :meth:`run` or :meth:`update` is called.)pb")
+
+      .def("run", &IncrementalEquivalenceCheckingManager::run,
+           nb::call_guard<nb::gil_scoped_release>(),
+           nb::rv_policy::reference_internal,
+           R"pb(Check the current pair from scratch.
+
+Returns:
+    The results of the check.)pb")
+
+      .def(
+          "update",
+          nb::overload_cast<const qc::QuantumComputation&>(
+              &IncrementalEquivalenceCheckingManager::update),
+          "circ2"_a, nb::call_guard<nb::gil_scoped_release>(),
+          nb::rv_policy::reference_internal,
+          R"pb(Replace the second circuit with an edited version and re-verify the pair.
+
+The edited window spans from the first to the last operation in which both versions differ.
+
+Args:
+    circ2: The edited version of the second circuit.
+
+Returns:
+    The results of the edited pair.)pb")
+
+      .def(
+          "update",
+          nb::overload_cast<const qc::QuantumComputation&, std::size_t,
+                            std::size_t>(
+              &IncrementalEquivalenceCheckingManager::update),
+          "circ2"_a, "begin"_a, "end"_a,
+          nb::call_guard<nb::gil_scoped_release>(),
+          nb::rv_policy::reference_internal,
+          R"pb(Replace the second circuit with an edited version and re-verify the pair.
+
+Args:
+    circ2: The edited version of the second circuit.
+    begin: The index of the first edited operation.
+    end: The index past the last edited operation of the previous version.
+        The operations ``[begin, end)`` of the previous version have been replaced by the operations ``[begin, end + len(circ2) - len(previous))`` of the edited version.
+
+Returns:
+    The results of the edited pair.
+
+Raises:
+    ValueError: If the range is invalid or both versions differ outside of it.)pb")
+
+      .def_prop_ro("results", &IncrementalEquivalenceCheckingManager::getResults,
+                   R"pb(The results of the last check.)pb")
+
+      .def_prop_ro(
+          "decided_incrementally",
+          &IncrementalEquivalenceCheckingManager::decidedIncrementally,
+          R"pb(Whether the last check has been decided on the edited window alone.)pb")
+
+      .def_prop_ro(
+          "window_size", &IncrementalEquivalenceCheckingManager::getWindowSize,
+          R"pb(The numbers of operations in the edited window of the previous and the edited version of the second circuit.)pb")
+
+      .def_prop_rw(
+          "configuration",
+          &IncrementalEquivalenceCheckingManager::getConfiguration,
+          [](IncrementalEquivalenceCheckingManager& manager,
+             const Configuration& config) {
+            manager.getConfiguration() = config;
+          },
+          nb::rv_policy::reference_internal,
+          R"pb(The configuration used for all checks.)pb");
 }
 
 } // namespace ec
@@ -45,7 +45,7 @@ For details, see :cite:p:`burgholzer2021randomStimuliGenerationQuantum`.)pb")
 
       .value(
           "stabilizer", StateType::Stabilizer,
-          R"pb(Randomly choose a stabilizer state by creating a random Clifford circuit. Also referred to as *"global_random"*.)pb")
+          R"pb(Randomly choose a stabilizer state as a random graph state with random local Clifford operations. Also referred to as *"global_random"*.)pb")
 
       .value("global_quantum", StateType::Stabilizer,
              R"pb(Alias for :attr:`~StateType.stabilizer`.)pb");
@@ -61,5 +61,20 @@ if(BUILD_MQT_QCEC_TESTS)
   list(APPEND FETCH_PACKAGES googletest)
 endif()
 
+if(BUILD_MQT_QCEC_BENCHMARKS)
+  set(BENCHMARK_ENABLE_TESTING
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL
+      OFF
+      CACHE BOOL "" FORCE)
+  set(GBENCH_VERSION
+      1.9.4
+      CACHE STRING "Google Benchmark version")
+  set(GBENCH_URL https://github.com/google/benchmark/archive/refs/tags/v${GBENCH_VERSION}.tar.gz)
+  FetchContent_Declare(benchmark URL ${GBENCH_URL} FIND_PACKAGE_ARGS ${GBENCH_VERSION})
+  list(APPEND FETCH_PACKAGES benchmark)
+endif()
+
 # Make all declared dependencies available.
 FetchContent_MakeAvailable(${FETCH_PACKAGES})
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+/**
+ * @brief Check the equivalence of many pairs of circuits at once.
+ * @details All pairs are checked with the same configuration. The pairs are
+ * checked as tasks on a single thread pool sized by `Execution::nthreads`
+ * (with the calling thread checking pairs as well), and at most that many
+ * pairs are checked concurrently. Only batches with fewer pairs than threads
+ * use the parallel flow for the individual pairs, whose checkers then run on
+ * the same pool. Larger batches check every pair with the sequential flow.
+ * Circuits are registered once and may be part of multiple pairs, in which case
+ * their optimization passes are only run once.
+ */
+class BatchEquivalenceCheckingManager {
+public:
+  using Results = EquivalenceCheckingManager::Results;
+
+  /// Callback invoked (serialized) with the index and results of each pair
+  /// as soon as it has been checked
+  using ResultCallback =
+      std::function<void(std::size_t index, const Results& results)>;
+
+  explicit BatchEquivalenceCheckingManager(
+      Configuration config = Configuration{})
+      : configuration(std::move(config)) {}
+
+  /**
+   * @brief Register a circuit with the batch.
+   * @param circ The circuit (copied)
+   * @return The id to refer to the circuit in `addPair`
+   */
+  std::size_t addCircuit(const qc::QuantumComputation& circ);
+  /// Register a circuit with the batch without copying it
+  std::size_t addCircuit(qc::QuantumComputation&& circ);
+  /// Register a circuit shared with the caller, which is never modified
+  std::size_t addCircuit(std::shared_ptr<const qc::QuantumComputation> circ);
+
+  /**
+   * @brief Add a pair of previously registered circuits to be checked.
+   * @param circ1 The id of the first circuit
+   * @param circ2 The id of the second circuit
+   * @return The index of the pair
+   * @throws std::out_of_range if any of the ids is unknown
+   */
+  std::size_t addPair(std::size_t circ1, std::size_t circ2);
+
+  /// Register both circuits and add them as a pair. Returns the pair index.
+  std::size_t addPair(const qc::QuantumComputation& circ1,
+                      const qc::QuantumComputation& circ2) {
+    const auto id1 = addCircuit(circ1);
+    const auto id2 = addCircuit(circ2);
+    return addPair(id1, id2);
+  }
+
+  /**
+   * @brief Check all pairs that have been added.
+   * @details Results are reported through the callback in the order in which
+   * the pairs finish. The counterexample DDs are not retained in the batch
+   * results since they reference the DD package of the individual check. If
+   * the check of any pair throws, the remaining pairs are still checked and
+   * the first exception is rethrown afterwards.
+   * @param callback Optional callback to stream the results
+   */
+  void run(const ResultCallback& callback = {});
+
+  /// Results of all pairs (indexed like the pairs)
+  [[nodiscard]] auto getResults() const -> const auto& { return results; }
+
+  [[nodiscard]] std::size_t numPairs() const noexcept { return pairs.size(); }
+  [[nodiscard]] std::size_t numCircuits() const noexcept {
+    return circuits.size();
+  }
+
+  /// Returns a mutable reference to the used configuration
+  [[nodiscard]] auto getConfiguration() -> auto& { return configuration; }
+
+  /// Set the thread pool to use. Passing `nullptr` restores the default.
+  void setThreadPool(std::shared_ptr<ThreadPool> pool) {
+    threadPool = std::move(pool);
+    ownsThreadPool = threadPool == nullptr;
+  }
+  [[nodiscard]] auto getThreadPool() const -> const auto& {
+    return threadPool;
+  }
+
+private:
+  Configuration configuration;
+
+  std::vector<std::shared_ptr<const qc::QuantumComputation>> circuits;
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+  std::vector<Results> results;
+
+  std::shared_ptr<ThreadPool> threadPool;
+  bool ownsThreadPool{true};
+};
+} // namespace ec
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/// A pair of corresponding slices of two circuits
+using SlicePair = std::pair<qc::QuantumComputation, qc::QuantumComputation>;
+
+/// The minimal number of operations per slice for proportional cut points
+constexpr std::size_t MIN_SLICE_SIZE = 8U;
+
+/**
+ * @brief Cut a pair of circuits into corresponding slices.
+ * @details If both circuits contain the same (positive) number of barriers
+ * acting on all qubits, they are cut at these barriers. Otherwise, they are
+ * cut into `slices` parts containing the same fraction of the operations of
+ * each circuit (as the proportional application scheme would interleave
+ * them). The logical qubits carried by the physical qubits are tracked across
+ * SWAP gates, and each slice maps the layout at its start cut to the one at
+ * its end cut. The last slice ends in the output permutation of the circuit,
+ * and the global phase is assigned to the first slice. Consequently, the
+ * circuits are equivalent if all pairs of slices are, while a non-equivalent
+ * pair of slices does not allow any conclusion. Both circuits need to have
+ * the same number of qubits, neither ancillary nor garbage qubits, complete
+ * permutations, and only unitary operations; otherwise, no slices are formed.
+ * @param qc1 The first (preprocessed) circuit
+ * @param qc2 The second (preprocessed) circuit
+ * @param slices The number of slices for proportional cut points
+ * @return The pairs of slices in circuit order or nothing if the circuits
+ * cannot be cut into (at least) two slices
+ */
+[[nodiscard]] std::vector<SlicePair>
+sliceAtCutPoints(const qc::QuantumComputation& qc1,
+                 const qc::QuantumComputation& qc2, std::size_t slices);
+} // namespace ec
@@ -12,6 +12,7 @@
 
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 #include "dd/DDDefinitions.hpp"
 #include "dd/RealNumber.hpp"
@@ -19,9 +20,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <nlohmann/json_fwd.hpp>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace ec {
 
@@ -30,16 +33,93 @@ public:
   // configuration options for execution
   struct Execution {
     dd::fp numericalTolerance = dd::RealNumber::eps;
+    // numerical tolerances of the DD packages of the individual checkers
+    // (0 falls back to `numericalTolerance`). A coarser tolerance, e.g., for
+    // the simulations screening for non-equivalence, merges more edge weights
+    // and keeps the decision diagrams small. The tolerance is a process-wide
+    // setting of the DD package, so checkers running concurrently share the
+    // smallest tolerance among them (see `sharedTolerance()`). Managers that
+    // check sub-problems for another manager (components, slices,
+    // instantiations, or the pairs of a batch) always use the tolerance set
+    // by the outermost manager. Checks of different managers running at the
+    // same time have to use the same tolerance, and sequential checks with
+    // differing per-checker tolerances must not overlap with any other check
+    // (see `ToleranceLease`).
+    dd::fp simulationTolerance = 0.;
+    dd::fp alternatingTolerance = 0.;
+    dd::fp constructionTolerance = 0.;
 
     bool parallel = true;
     std::size_t nthreads = std::max(2U, std::thread::hardware_concurrency());
-    double timeout = 0.; // in seconds
+    // in seconds (0 disables the timeout). The DD-based checkers poll for
+    // the timeout (or any other cancellation) before each gate and garbage
+    // collection, but never interrupt the application of a single gate. A
+    // check thus only stops once the gate it is applying has been applied.
+    double timeout = 0.;
+
+    // file the alternating checker periodically (every `checkpointInterval`
+    // seconds) and upon cancellation writes its state to. A later check of
+    // the same circuits resumes from it. An empty name disables checkpoints.
+    std::string checkpointFile;
+    double checkpointInterval = 300.; // in seconds
+
+    // number of threads the construction checker uses to build the
+    // functionality of each circuit. Values above 1 split the circuits into
+    // segments whose unitaries are built concurrently (in separate DD
+    // packages) and multiplied in a balanced tree.
+    std::size_t constructionThreads = 1U;
+
+    // number of slices the circuits are cut into at synchronization points
+    // (matching barriers or proportional gate counts). The slices are checked
+    // independently, and the full check only runs if they are inconclusive.
+    // Values below 2 disable slicing.
+    std::size_t slices = 0U;
+
+    // start simulations on lightly preprocessed copies of the circuits (on a
+    // separate thread) while the costlier optimization passes are still
+    // running. If they show non-equivalence, `run()` reports it right away.
+    bool pipelinedPreprocessing = false;
 
     bool runConstructionChecker = false;
     bool runSimulationChecker = true;
     bool runAlternatingChecker = true;
     bool runZXChecker = true;
+    // compare the stabilizer tableaux of Clifford circuits ahead of all other
+    // checkers (which decides the check up to a global phase)
+    bool runCliffordChecker = false;
     bool setAllAncillaeGarbage = false;
+
+    // garbage collection policy of the DD packages: collect every `gcInterval`
+    // gates (0 disables periodic collection) and force a collection whenever
+    // the resident memory exceeds `gcMemoryThreshold` bytes (0 disables it)
+    std::size_t gcInterval = 1U;
+    std::size_t gcMemoryThreshold = 0U;
+
+    // number of buckets of the unique and compute tables of the DD packages.
+    // A value of 0 means that they are derived from the circuits.
+    std::size_t ddUniqueTableBuckets = 0U;
+    std::size_t ddComputeTableBuckets = 0U;
+
+    // memory budgets (in bytes) of the DD-based checkers. A checker exceeding
+    // its budget stops without a result while the remaining checkers resume.
+    // `memoryLimit` bounds the memory of the whole process, whereas
+    // `checkerMemoryLimit` bounds the nodes of each individual DD package.
+    // A value of 0 means no limit.
+    std::size_t memoryLimit = 0U;
+    std::size_t checkerMemoryLimit = 0U;
+
+    // record per-phase timings, DD sizes and compute/unique table statistics
+    // of the DD-based checkers in their results
+    bool instrumentation = false;
+
+    // number of amplitudes (in which the output states differ the most) that
+    // are recorded in the compact description of a counterexample
+    std::size_t counterexampleAmplitudes = 8U;
+    // keep the DDs of a counterexample (and with them, the DD packages of the
+    // checkers) alive after a check. Otherwise, only the compact description
+    // of the counterexample is kept and the packages of all finished checkers
+    // are released as soon as the check has been decided.
+    bool retainCounterexampleDDs = true;
   };
 
   // configuration options for pre-check optimizations
@@ -51,6 +131,19 @@ public:
     bool reorderOperations = true;
     bool backpropagateOutputPermutation = false;
     bool elidePermutations = true;
+
+    // remove the longest common prefix and suffix of both circuits (after all
+    // other preprocessing steps), since identical gates cancel each other
+    bool stripCommonGates = false;
+
+    // check the independent qubit components of both circuits (as determined
+    // after all other preprocessing steps) as separate sub-problems
+    bool decomposeComponents = false;
+
+    // reuse the results of preprocessing identical circuits with identical
+    // options (kept in memory and, if a directory is given, also on disk)
+    bool cachePreprocessing = false;
+    std::string preprocessingCacheDirectory;
   };
 
   // configuration options for application schemes
@@ -62,16 +155,42 @@ public:
     ApplicationSchemeType alternatingScheme =
         ApplicationSchemeType::Proportional;
 
-    // options for the gate cost application scheme
+    // options for the gate cost application scheme. Unless a `profile` is
+    // given, costs are computed by `costFunction`. If `profileStore` is set,
+    // each cost is only computed once and persisted to that file (see
+    // `GateCostProfileStore`).
     std::string profile;
+    std::string profileStore;
     CostFunction costFunction = [](const GateCostLookupTableKeyType& /*key*/) {
       return 1U;
     };
+    // the loaded `profile` (if any), which is shared by all checkers. The
+    // equivalence checking manager loads it once before running the checkers
+    // and it is only used as long as its source matches `profile`.
+    std::shared_ptr<const GateCostProfile> gateCostProfile;
+
+    // options for the lookahead application scheme: a candidate is chosen
+    // based on the estimated size of its result alone if its estimate is
+    // smaller than that of the other candidate by at least this factor
+    // (0 disables estimation). Both candidate products are only computed
+    // speculatively while the current DD has at most
+    // `lookaheadMultiplicationBudget` nodes (0 means no bound).
+    double lookaheadEstimateThreshold = 0.;
+    std::size_t lookaheadMultiplicationBudget = 0U;
+
+    // additional schemes that race the `alternatingScheme` in the parallel
+    // flow, each in its own alternating checker. Members using the same scheme
+    // as an earlier member get DD packages with twice as large tables.
+    std::vector<ApplicationSchemeType> alternatingPortfolio;
   };
 
   struct Functionality {
     double traceThreshold = 1e-8;
     bool checkPartialEquivalence = false;
+
+    // the ZX checker gives up (without a result) once its miter has not
+    // shrunk for this many consecutive rounds of simplification (0 disables)
+    std::size_t zxStallRounds = 0U;
   };
 
   // configuration options for the simulation scheme
@@ -80,6 +199,32 @@ public:
     std::size_t maxSims = computeMaxSims();
     StateType stateType = StateType::ComputationalBasis;
     std::size_t seed = 0U;
+    // index of the first stimulus that is simulated. Processes sharing a
+    // (non-zero) seed simulate disjoint stimuli if they are assigned disjoint
+    // ranges `[firstStimulus, firstStimulus + maxSims)`, e.g., when the
+    // simulations are distributed across multiple nodes.
+    std::size_t firstStimulus = 0U;
+    // number of stimuli that are propagated in lockstep by a single simulation
+    // run (sharing the gate DDs and the DD package between them)
+    std::size_t stimuliPerRun = 1U;
+    // simulate all computational basis states (in Gray-code order) for
+    // circuits with at most `MAX_EXHAUSTIVE_QUBITS` qubits. If every
+    // simulation yields exactly the same output state, the circuits are
+    // equivalent.
+    bool exhaustive = false;
+    static constexpr std::size_t MAX_EXHAUSTIVE_QUBITS = 20U;
+    // stop simulating once the probability of an error going undetected by
+    // all simulations so far drops below this bound (0 disables early
+    // stopping). `maxSims` remains the upper limit on the simulations.
+    double falseNegativeBound = 0.;
+    // the assumed probability that a single stimulus of the respective type
+    // detects an existing error. Used to bound the false-negative probability.
+    double basisDetectionProbability = 0.5;
+    double random1QDetectionProbability = 0.75;
+    double stabilizerDetectionProbability = 0.9;
+    // choose the type of stimuli for each run based on the evidence gathered
+    // per second by each type so far (instead of always using `stateType`)
+    bool adaptiveStateType = false;
 
     // this function makes sure that the maximum number of simulations is
     // configured properly.
@@ -117,6 +262,21 @@ public:
 
   [[nodiscard]] bool onlySimulationCheckerConfigured() const noexcept;
 
+  /// The numerical tolerance of a checker configured with the given
+  /// per-checker tolerance (falling back to the global one)
+  [[nodiscard]] dd::fp checkerTolerance(dd::fp tolerance) const noexcept;
+
+  /// The smallest numerical tolerance of all configured DD-based checkers,
+  /// which is used whenever several of them run concurrently
+  [[nodiscard]] dd::fp sharedTolerance() const noexcept;
+
+  /// Let all checkers use the shared tolerance, e.g., for checks running
+  /// concurrently with other checks
+  void shareTolerance() noexcept;
+
+  /// Whether all configured DD-based checkers use the shared tolerance
+  [[nodiscard]] bool uniformTolerance() const noexcept;
+
   [[nodiscard]] nlohmann::json json() const;
 
   [[nodiscard]] std::string toString() const;
@@ -12,43 +12,116 @@
 
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
-#include "ThreadSafeQueue.hpp"
+#include "ResultChannel.hpp"
+#include "ThreadPool.hpp"
+#include "ToleranceLease.hpp"
 #include "checker/EquivalenceChecker.hpp"
 #include "checker/dd/DDSimulationChecker.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
 #include "checker/dd/simulation/StateGenerator.hpp"
+#include "checker/dd/simulation/StateType.hpp"
+#include "checker/zx/ZXChecker.hpp"
 #include "dd/Node.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <complex>
 #include <condition_variable>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace ec {
 
+class SubproblemScheduler;
+
 class EquivalenceCheckingManager {
 public:
+  /// A description of a counterexample that is independent of any DD package
+  struct Counterexample {
+    /// An amplitude of both output states
+    struct Amplitude {
+      std::size_t index{};
+      std::complex<double> output1;
+      std::complex<double> output2;
+    };
+
+    /// The type of the stimulus that produced the counterexample
+    StateType stimulusType = StateType::ComputationalBasis;
+    /// Index of the input if it is a computational basis state
+    std::optional<std::size_t> basisState;
+    /// The amplitudes in which the output states differ the most (in
+    /// descending order of the difference). Only recorded for up to
+    /// `MAX_AMPLITUDE_QUBITS` qubits.
+    std::vector<Amplitude> amplitudes;
+    static constexpr std::size_t MAX_AMPLITUDE_QUBITS = 20U;
+
+    /**
+     * @brief Summarize the counterexample given by its DDs.
+     * @param input The input state
+     * @param output1 The output state of the first circuit
+     * @param output2 The output state of the second circuit
+     * @param type The type of the stimulus
+     * @param nqubits The number of qubits of the states
+     * @param amplitudes The maximal number of amplitudes to record
+     */
+    [[nodiscard]] static Counterexample
+    summarize(const dd::VectorDD& input, const dd::VectorDD& output1,
+              const dd::VectorDD& output2, StateType type, std::size_t nqubits,
+              std::size_t amplitudes);
+
+    [[nodiscard]] nlohmann::json json() const;
+  };
+
   struct Results {
     double preprocessingTime{};
     double checkTime{};
+    /// Number of circuits whose preprocessing was served from the cache
+    std::size_t preprocessingCacheHits = 0U;
+    /// Whether the check has been decided by the simulations that ran while
+    /// the circuits were preprocessed (see `pipelinedPreprocessing`)
+    bool decidedDuringPreprocessing = false;
 
     EquivalenceCriterion equivalence = EquivalenceCriterion::NoInformation;
 
     std::size_t startedSimulations = 0U;
     std::size_t performedSimulations = 0U;
+    /// Bound on the probability that an error went undetected by all
+    /// successful simulations (based on the assumed detection probabilities)
+    double falseNegativeProbability = 1.;
     dd::VectorDD cexInput{};
     dd::VectorDD cexOutput1{};
     dd::VectorDD cexOutput2{};
+    /// Index of the stimulus that produced the counterexample (if the
+    /// counterexample stems from an indexed stimulus)
+    std::optional<std::size_t> cexStimulus;
+    /// Compact description of the counterexample (if non-equivalence has been
+    /// shown by a simulation). In contrast to the counterexample DDs, it
+    /// remains valid when the DD packages of the checkers are released.
+    std::optional<Counterexample> counterexample;
     std::size_t performedInstantiations = 0U;
+    /// Number of independent qubit components that have been checked
+    /// separately (0 if the check has not been decomposed)
+    std::size_t components = 0U;
+    /// Number of slices that have been checked separately (0 if the circuits
+    /// have not been sliced)
+    std::size_t slices = 0U;
 
     nlohmann::json checkerResults = nlohmann::json::array();
 
@@ -71,13 +144,107 @@ public:
     }
   };
 
+  /// Create a manager for copies of both circuits
   EquivalenceCheckingManager(const qc::QuantumComputation& circ1,
                              const qc::QuantumComputation& circ2,
-                             Configuration config = Configuration{});
+                             Configuration config = Configuration{})
+      : EquivalenceCheckingManager(
+            std::make_shared<qc::QuantumComputation>(circ1),
+            std::make_shared<qc::QuantumComputation>(circ2), std::move(config),
+            false, false) {}
+
+  /// Create a manager that takes over both circuits without copying them
+  EquivalenceCheckingManager(qc::QuantumComputation&& circ1,
+                             qc::QuantumComputation&& circ2,
+                             Configuration config = Configuration{})
+      : EquivalenceCheckingManager(
+            std::make_shared<qc::QuantumComputation>(std::move(circ1)),
+            std::make_shared<qc::QuantumComputation>(std::move(circ2)),
+            std::move(config), false, false) {}
+
+  /**
+   * @brief Create a manager sharing ownership of both circuits.
+   * @details The shared circuits are never modified. A circuit is only copied
+   * if the preprocessing of the manager has to change it. Circuits that have
+   * already been passed through `optimizeCircuit` with the optimizations of
+   * the given configuration (e.g., the circuits of another manager obtained via
+   * `getSharedFirstCircuit`) can be flagged as such, so that they are checked
+   * without any copy.
+   * @param circ1 The first circuit
+   * @param circ2 The second circuit
+   * @param config The configuration to use
+   * @param circuitsOptimized Whether both circuits have already been optimized
+   */
+  EquivalenceCheckingManager(
+      std::shared_ptr<const qc::QuantumComputation> circ1,
+      std::shared_ptr<const qc::QuantumComputation> circ2,
+      Configuration config = Configuration{},
+      const bool circuitsOptimized = false)
+      : EquivalenceCheckingManager(std::move(circ1), std::move(circ2),
+                                   std::move(config), circuitsOptimized,
+                                   circuitsOptimized) {}
+
+  EquivalenceCheckingManager(const EquivalenceCheckingManager&) = delete;
+  EquivalenceCheckingManager&
+  operator=(const EquivalenceCheckingManager&) = delete;
+  EquivalenceCheckingManager(EquivalenceCheckingManager&&) = delete;
+  EquivalenceCheckingManager& operator=(EquivalenceCheckingManager&&) = delete;
+
+  /// Cancels any checker that is still winding down and waits for it
+  ~EquivalenceCheckingManager();
+
+  /// A snapshot of the progress of a run
+  struct Progress {
+    /// Time since the start of the run (in seconds)
+    double elapsed{};
+    /// Number of stimuli claimed and successfully simulated so far
+    std::size_t startedSimulations = 0U;
+    std::size_t performedSimulations = 0U;
+
+    struct Checker {
+      std::string_view name;
+      EquivalenceChecker::Progress progress;
+    };
+    /// The progress of each checker of the run
+    std::vector<Checker> checkers;
+  };
+  using ProgressCallback = std::function<void(const Progress&)>;
 
+  /**
+   * @brief Report the progress of subsequent runs to a callback.
+   * @details During a run, a reporter thread takes a snapshot of the progress
+   * counters of all checkers every `interval` seconds and passes it to the
+   * callback (on the reporter thread). A final snapshot is reported once the
+   * run has finished. The checkers only update relaxed atomic counters while
+   * applying gates; the size of the DDs is sampled at the next cancellation
+   * point after a snapshot has been taken, so it lags behind by one interval.
+   * Exceptions thrown by the callback stop the reporting and are rethrown at
+   * the end of the run.
+   * @param callback The callback to invoke (an empty callback disables the
+   * reporting)
+   * @param interval The time between two snapshots (in seconds)
+   */
+  void setProgressCallback(ProgressCallback callback,
+                           const double interval = 1.) {
+    progressCallback = std::move(callback);
+    progressInterval = interval;
+  }
+  [[nodiscard]] bool hasProgressCallback() const noexcept {
+    return static_cast<bool>(progressCallback);
+  }
+
+  /**
+   * @brief Run the equivalence check.
+   * @details In the parallel flow, this method returns as soon as a decision
+   * has been reached. Checkers that are still running at that point are asked
+   * to stop and wind down in the background. They are not included in the
+   * checker results and are waited for before the next run, on `reset()`, and
+   * on destruction of the manager.
+   */
   void run();
 
   void reset() {
+    waitForPendingTasks();
     stateGenerator.clear();
     results = Results();
     checkers.clear();
@@ -100,7 +267,10 @@ public:
    * configured optimizations.
    * @return The first circuit
    */
-  [[nodiscard]] auto getFirstCircuit() const -> const auto& { return qc1; }
+  [[nodiscard]] auto getFirstCircuit() const
+      -> const qc::QuantumComputation& {
+    return *qc1;
+  }
 
   /**
    * @brief Get an immutable reference to the second circuit
@@ -109,7 +279,53 @@ public:
    * configured optimizations.
    * @return The second circuit
    */
-  [[nodiscard]] auto getSecondCircuit() const -> const auto& { return qc2; }
+  [[nodiscard]] auto getSecondCircuit() const
+      -> const qc::QuantumComputation& {
+    return *qc2;
+  }
+
+  /// Shared ownership of the (preprocessed) first circuit, e.g., for sharing
+  /// it with another manager
+  [[nodiscard]] auto getSharedFirstCircuit() const -> const auto& {
+    return qc1;
+  }
+  /// Shared ownership of the (preprocessed) second circuit
+  [[nodiscard]] auto getSharedSecondCircuit() const -> const auto& {
+    return qc2;
+  }
+
+  /**
+   * @brief Set the thread pool used for running checkers in parallel.
+   * @details By default, the manager lazily creates its own pool sized by
+   * `Execution::nthreads` on the first parallel run. Injecting a pool allows
+   * to share the same set of long-lived worker threads across many managers.
+   * The number of concurrently scheduled checkers per manager is still limited
+   * by `Execution::nthreads`.
+   * @param pool The pool to use. Passing `nullptr` restores the default.
+   */
+  void setThreadPool(std::shared_ptr<ThreadPool> pool) {
+    threadPool = std::move(pool);
+    ownsThreadPool = threadPool == nullptr;
+  }
+
+  /// Returns the thread pool used for parallel runs (if any has been set up)
+  [[nodiscard]] auto getThreadPool() const -> const auto& {
+    return threadPool;
+  }
+
+  /**
+   * @brief Run the configured optimization passes on a single circuit.
+   * @details This is the per-circuit part of the preprocessing performed by
+   * the constructor. It allows to optimize a circuit once and reuse the result
+   * for multiple equivalence checks (see BatchEquivalenceCheckingManager).
+   * @param qc The circuit to optimize
+   * @param optimizations The optimizations to apply
+   * @throws std::runtime_error if the circuit is dynamic and dynamic circuit
+   * transformation is disabled.
+   */
+  static void
+  optimizeCircuit(qc::QuantumComputation& qc,
+                  const Configuration::Optimizations& optimizations);
 
   /// Disable all previously enabled checkers
   void disableAllCheckers() {
@@ -117,6 +333,7 @@ public:
     configuration.execution.runZXChecker = false;
     configuration.execution.runSimulationChecker = false;
     configuration.execution.runAlternatingChecker = false;
+    configuration.execution.runCliffordChecker = false;
   }
 
   /**
@@ -142,6 +359,7 @@ public:
     configuration.application.alternatingScheme =
         ApplicationSchemeType::GateCost;
     configuration.application.profile = profileLocation;
+    configuration.application.gateCostProfile = nullptr;
   }
 
   /**
@@ -159,19 +377,170 @@ public:
     configuration.application.costFunction = costFunction;
   }
 
+  /**
+   * @brief Set a gate cost function whose costs are persisted to a file.
+   * @details This also sets the application scheme to GateCost. Each cost is
+   * only computed once and appended to the given file, from which it is read
+   * again by later runs (see `GateCostProfileStore`).
+   * @param storeLocation The path of the file the costs are persisted to.
+   * @param costFunction The cost function to use.
+   */
+  void setGateCostProfileStore(const std::string_view storeLocation,
+                               const CostFunction& costFunction) {
+    setGateCostFunction(costFunction);
+    configuration.application.profileStore = storeLocation;
+  }
+
 protected:
-  qc::QuantumComputation qc1;
-  qc::QuantumComputation qc2;
+  friend class BatchEquivalenceCheckingManager;
+  friend class SubproblemScheduler;
+
+  /// Create a manager for circuits that might have already been run through
+  /// `optimizeCircuit`, in which case the optimization passes are skipped.
+  /// Shared circuits are copied before they are modified. Nested managers
+  /// (see `nested`) are created by another manager.
+  EquivalenceCheckingManager(
+      std::shared_ptr<const qc::QuantumComputation> circ1,
+      std::shared_ptr<const qc::QuantumComputation> circ2, Configuration config,
+      bool circ1Optimized, bool circ2Optimized, bool nestedCheck = false);
+
+  /// Create a manager for circuits exclusively owned by the manager, which are
+  /// modified in place by the preprocessing.
+  EquivalenceCheckingManager(std::shared_ptr<qc::QuantumComputation> circ1,
+                             std::shared_ptr<qc::QuantumComputation> circ2,
+                             Configuration config, bool circ1Optimized,
+                             bool circ2Optimized, bool nestedCheck = false);
+
+  /// Load the gate cost profile of the configuration (unless it already has
+  /// been loaded) if it is used by any of the checkers
+  static void loadGateCostProfile(Configuration& config);
+
+  /// Run all preprocessing steps on the circuits
+  void preprocess();
+  /// Run the preprocessing steps that transform the circuits and derive the
+  /// parameters of the check from them
+  void preprocessCircuits();
+  /// Run the preprocessing while reusing (and populating) the global
+  /// preprocessing cache
+  void preprocessWithCache();
+  /// Whether the optimization passes of both circuits are worth running
+  /// concurrently (on top of being independent of each other)
+  [[nodiscard]] bool preprocessConcurrently() const;
+
+  /// Start simulating lightly preprocessed copies of the circuits on a
+  /// separate thread (see `Execution::pipelinedPreprocessing`)
+  void startSpeculativeSimulations();
+  /// Stop the speculative simulations and keep their results if they have
+  /// shown non-equivalence
+  void finishSpeculativeSimulations();
+
+  /// Get the first circuit for modification (copying it if it is shared)
+  qc::QuantumComputation& modifiableFirstCircuit();
+  /// Get the second circuit for modification (copying it if it is shared)
+  qc::QuantumComputation& modifiableSecondCircuit();
+
+  // the circuits are immutable once the manager has been constructed
+  std::shared_ptr<const qc::QuantumComputation> qc1;
+  std::shared_ptr<const qc::QuantumComputation> qc2;
+  // the circuits exclusively owned by the manager (if any)
+  std::shared_ptr<qc::QuantumComputation> ownedQc1;
+  std::shared_ptr<qc::QuantumComputation> ownedQc2;
+  bool firstCircuitOptimized{false};
+  bool secondCircuitOptimized{false};
+  // whether the manager checks a sub-problem (or runs speculative simulations)
+  // for another manager. The numerical tolerance of the DD package is a global
+  // setting, so only the outermost manager sets it. Nested managers (possibly
+  // running concurrently) use it as is and are configured with the shared
+  // tolerance (see `Configuration::shareTolerance`).
+  bool nested{false};
+  // the claim of the outermost manager on the tolerance of the DD package,
+  // which is held until all checkers of a run have finished
+  std::optional<ToleranceLease> toleranceLease;
 
   Configuration configuration{};
 
+  // only used to generate indexed stimuli, which does not modify the
+  // generator and, hence, can be done concurrently
   StateGenerator stateGenerator;
-  std::mutex stateGeneratorMutex;
 
-  bool done{false};
+  std::atomic<bool> done{false};
   std::condition_variable doneCond;
   std::mutex doneMutex;
   std::vector<std::unique_ptr<EquivalenceChecker>> checkers;
+  std::mutex checkersMutex;
+  /// Number of threads the ZX checker may use (guarded by `checkersMutex`)
+  std::size_t zxThreads{1U};
+
+  /// Number of stimuli claimed and successfully simulated by the simulation
+  /// workers of the current parallel run
+  std::atomic<std::size_t> claimedSimulations{0U};
+  std::atomic<std::size_t> passedSimulations{0U};
+  /// Whether any simulation only yielded equivalence up to a phase
+  std::atomic<bool> inexactSimulations{false};
+
+  /// Statistics of the successful simulations per type of stimuli
+  struct SimulationStatistics {
+    std::array<std::size_t, 3> stimuli{};
+    std::array<double, 3> time{};
+    /// -log of the bound on the false-negative probability
+    double evidence = 0.;
+  };
+  SimulationStatistics simulationStatistics{};
+  std::mutex simulationStatisticsMutex;
+  /// Set once the simulations have reached the false-negative bound
+  std::atomic<bool> confidentSimulations{false};
+  /// The number of distinct computational basis stimuli
+  std::size_t basisStimuli = std::numeric_limits<std::size_t>::max();
+
+  ProgressCallback progressCallback;
+  double progressInterval = 1.;
+  /// The minimal time between two progress snapshots (in seconds)
+  static constexpr double MIN_PROGRESS_INTERVAL = 1e-3;
+
+  /// Take a snapshot of the progress of the current run and request the
+  /// checkers to sample the size of their DDs for the next snapshot
+  [[nodiscard]] Progress takeProgressSnapshot(
+      std::chrono::steady_clock::time_point start);
+
+  /// Pairs of subcircuits that are checked as separate sub-problems
+  using CircuitPairs =
+      std::vector<std::pair<std::shared_ptr<const qc::QuantumComputation>,
+                            std::shared_ptr<const qc::QuantumComputation>>>;
+  /// The pairs of subcircuits of the independent qubit components (empty if
+  /// the check is not decomposed)
+  CircuitPairs componentCircuits;
+  /// The pairs of slices of the circuits (empty if the circuits are not
+  /// sliced)
+  CircuitPairs sliceCircuits;
+
+  /// The scheduler of the instantiations of the symbolic circuits or the
+  /// sub-problems of the check that are currently being checked (if any)
+  SubproblemScheduler* activeScheduler = nullptr;
+  std::mutex instancesMutex;
+
+  /// The manager simulating the lightly preprocessed circuits while the
+  /// circuits of this manager are preprocessed (guarded by `instancesMutex`)
+  EquivalenceCheckingManager* speculativeManager = nullptr;
+  /// Set once the speculative simulations shall no longer be started
+  /// (guarded by `instancesMutex`)
+  bool speculationStopped = false;
+  /// The number of (primary) qubits of the speculatively simulated circuits
+  std::array<std::size_t, 2> speculativeQubits{};
+  /// The results of speculative simulations that have shown non-equivalence
+  std::optional<Results> speculativeResults;
+  std::future<std::optional<Results>> speculation;
+
+  /// The id and result of a checker that finished its execution
+  struct Completion {
+    std::size_t id;
+    EquivalenceCriterion equivalence;
+  };
+
+  /// Tasks of the last parallel run (indexed like `checkers`)
+  std::vector<std::future<void>> pendingTasks;
+
+  std::shared_ptr<ThreadPool> threadPool;
+  bool ownsThreadPool{true};
 
   Results results{};
 
@@ -186,9 +555,18 @@ protected:
   /// it adds corresponding ancillaries in the smaller circuit
   void setupAncillariesAndGarbage();
 
+  /// Remove the longest common prefix and suffix of operations of both
+  /// circuits (see `Optimizations::stripCommonGates`). The layouts at the cuts
+  /// become the new initial layout and output permutation of both circuits.
+  void stripCommonGates();
+
   /// Run all configured optimization passes
   void runOptimizationPasses();
 
+  /// Run the Clifford checker ahead of all other checkers (if it is configured
+  /// and can handle the circuits). Returns whether it has decided the check.
+  bool checkClifford();
+
   /// Sequential Equivalence Check (TCAD'21)
   /// First, a couple of simulations with various stimuli are conducted.
   /// If any of those stimuli produce output states with a fidelity not close to
@@ -198,69 +576,208 @@ protected:
   /// decision diagram checker is invoked to determine the equivalence.
   void checkSequential();
 
+  /// Symbolic Equivalence Check
+  /// The ZX checker tries to show the equivalence of the symbolic circuits.
+  /// If it fails to do so, the parameters are instantiated (see
+  /// checkInstantiations). In the parallel flow, the ZX checker races the
+  /// checks of the instantiations and whichever concludes first decides.
   void checkSymbolic();
 
+  /// Check instantiations of the symbolic circuits with the DD-based checkers.
+  /// The circuits are instantiated with the parameters for which all
+  /// expressions are zero, `nAdditionalInstantiations` random phases, and
+  /// finally uniformly random values. Any non-equivalent instantiation proves
+  /// the non-equivalence, otherwise the result of the random instantiation is
+  /// reported. In the parallel flow, the instantiations are checked
+  /// concurrently on the thread pool.
+  /// \param start The start of the symbolic check (used for the timeout)
+  /// \param concurrency The maximum number of instantiations that are checked
+  /// at the same time in the parallel flow
+  void checkInstantiations(std::chrono::steady_clock::time_point start,
+                           std::size_t concurrency);
+
+  /// Creates the manager of a sub-problem (see `SubproblemScheduler::Factory`)
+  using SubproblemFactory =
+      std::function<std::unique_ptr<EquivalenceCheckingManager>(
+          std::size_t index, const Configuration& config)>;
+
+  /// Run `count` sub-problems created by `factory` on the given scheduler,
+  /// which is cancelled together with this manager
+  /// \return The results of the sub-problems that have been checked
+  std::vector<std::optional<Results>>
+  runSubproblems(SubproblemScheduler& scheduler, std::size_t count,
+                 const Configuration& config,
+                 const SubproblemFactory& factory);
+
+  /**
+   * @brief Check pairs of subcircuits with separate managers.
+   * @details In the parallel flow, the pairs are checked concurrently on the
+   * thread pool, and the first non-equivalent pair stops all others. The
+   * statistics and checker results of the sub-checks are added to the results
+   * (the latter tagged with the index of the pair under the given key).
+   * @param pairs The pairs of (preprocessed) subcircuits
+   * @param config The configuration of the sub-checks
+   * @param key The key under which the index of the pair is recorded
+   * @param start The start of the check (used for the timeout)
+   * @return The results of the pairs that have been checked
+   */
+  std::vector<std::optional<Results>>
+  checkSubproblems(const CircuitPairs& pairs, Configuration config,
+                   std::string_view key,
+                   std::chrono::steady_clock::time_point start);
+
+  /// Check the independent qubit components of the circuits (see
+  /// `Optimizations::decomposeComponents`). The circuits are equivalent if all
+  /// components are.
+  /// \param start The start of the check (used for the timeout)
+  void checkComponents(std::chrono::steady_clock::time_point start);
+
+  /// Check the slices of the circuits (see `Execution::slices`). The circuits
+  /// are equivalent if all slices are, while other outcomes are inconclusive.
+  /// \param start The start of the check (used for the timeout)
+  /// \return Whether the slices have decided the check
+  bool checkSlices(std::chrono::steady_clock::time_point start);
+
+  /// The time (in seconds) remaining until the timeout of a check that started
+  /// at the given time point (negative once the timeout has been reached)
+  [[nodiscard]] double
+  remainingTime(std::chrono::steady_clock::time_point start) const;
+
   /// Parallel Equivalence Check
   /// The parallel flow makes use of the available processing power by
   /// orchestrating all configured checks in a parallel fashion
   void checkParallel();
 
-  /// Signal all checker that they shall abort the computation as soon as
-  /// possible since a result has been determined
-  void setAndSignalDone() {
-    done = true;
-    for (const auto& checker : checkers) {
-      if (checker) {
-        checker->signalDone();
+  /// Update the number of threads the ZX checker with the given id may use
+  void setZXThreads(std::size_t id, std::size_t nthreads);
+
+  /// Make sure a thread pool is available for parallel runs. An owned pool is
+  /// (re-)created whenever its size does not match `Execution::nthreads`.
+  void setupThreadPool();
+
+  /// Wait for all tasks of the last parallel run to finish
+  void waitForPendingTasks() {
+    for (const auto& task : pendingTasks) {
+      if (task.valid()) {
+        task.wait();
       }
     }
+    pendingTasks.clear();
+    toleranceLease.reset();
   }
 
+  /// Create a checker of the given type and register it with the manager
+  template <class Checker> EquivalenceChecker* addChecker() {
+    const std::lock_guard checkersLock(checkersMutex);
+    return checkers
+        .emplace_back(std::make_unique<Checker>(*qc1, *qc2, configuration))
+        .get();
+  }
+
+  /// Signal all checker that they shall abort the computation as soon as
+  /// possible since a result has been determined
+  void setAndSignalDone();
+
   /// \brief Run an EquivalenceChecker asynchronously
   ///
-  /// This function is used to asynchronously run an EquivalenceChecker. It also
-  /// takes care of creating the checker if it does not exist yet. Additionally,
-  /// it takes care that the checker signals the main thread when it is done
-  /// (even in case of an exception).
+  /// This function is used to asynchronously run an EquivalenceChecker on the
+  /// thread pool. It also takes care of creating the checker if it does not
+  /// exist yet. Additionally, it takes care that the checker signals the main
+  /// thread when it is done (even in case of an exception).
   ///
   /// \tparam Checker The type of the checker (must be derived from the
   /// EquivalenceChecker class).
   /// \param id The id in the checkers vector where the checker is stored.
-  /// \param queue The queue to which the checker shall push its id
-  /// once it is done.
+  /// \param channel The channel to which the checker shall push its id and
+  /// result once it is done. It is shared with the task so that the task may
+  /// outlive the parallel check it was started from.
+  /// \param checkerConfiguration The configuration of the checker if it shall
+  /// differ from the configuration of the manager.
   /// \return A future that can be used to wait for the checker to finish.
   template <class Checker>
-  std::future<void> asyncRunChecker(const std::size_t id,
-                                    ThreadSafeQueue<std::size_t>& queue) {
+  std::future<void>
+  asyncRunChecker(const std::size_t id,
+                  std::shared_ptr<ResultChannel<Completion>> channel,
+                  std::optional<Configuration> checkerConfiguration = {}) {
     static_assert(std::is_base_of_v<EquivalenceChecker, Checker>,
                   "Checker must be derived from EquivalenceChecker");
-    return std::async(std::launch::async, [this, id, &queue]() {
+    return threadPool->submit([this, id, channel = std::move(channel),
+                               checkerConfig =
+                                   std::move(checkerConfiguration)]() {
       try {
-        auto& checker = checkers[id];
-        if (!checker) {
-          checker = std::make_unique<Checker>(qc1, qc2, configuration);
+        EquivalenceChecker* checker = nullptr;
+        {
+          const std::lock_guard checkersLock(checkersMutex);
+          auto& slot = checkers[id];
+          if (!slot) {
+            slot = std::make_unique<Checker>(
+                *qc1, *qc2, checkerConfig ? *checkerConfig : configuration);
+          }
+          checker = slot.get();
+          if constexpr (std::is_same_v<Checker, ZXEquivalenceChecker>) {
+            auto* const zx = dynamic_cast<ZXEquivalenceChecker*>(checker);
+            zx->setNumThreads(zxThreads);
+            zx->setThreadPool(threadPool);
+          }
         }
 
         if constexpr (std::is_same_v<Checker, DDSimulationChecker>) {
-          auto* const simChecker =
-              dynamic_cast<DDSimulationChecker*>(checker.get());
-          const std::lock_guard stateGeneratorLock(stateGeneratorMutex);
-          simChecker->setRandomInitialState(stateGenerator);
-        }
-
-        if (!done) {
+          runSimulationWorker(*dynamic_cast<DDSimulationChecker*>(checker));
+        } else if (!done) {
           checker->run();
         }
-        queue.push(id);
+        channel->push({id, checker->getEquivalence()});
       } catch (const std::exception& e) {
-        queue.push(id);
+        channel->push({id, EquivalenceCriterion::NoInformation});
         throw;
       }
     });
   }
 
   [[nodiscard]] bool simulationsFinished() const {
-    return results.performedSimulations == configuration.simulation.maxSims;
+    if (results.performedSimulations == configuration.simulation.maxSims) {
+      return true;
+    }
+    // once the false-negative bound has been reached, no further stimuli are
+    // claimed and the simulations are finished as soon as all claimed
+    // stimuli have been simulated
+    return confidentSimulations &&
+           results.performedSimulations == claimedSimulations;
   }
+
+  /// Whether every basis state has been simulated and each simulation yielded
+  /// exactly the same output state for both circuits (including the phase).
+  /// By linearity, this proves that both circuits are equivalent.
+  [[nodiscard]] bool exhaustivelySimulated() const {
+    return configuration.simulation.exhaustive && simulationsFinished() &&
+           !inexactSimulations;
+  }
+
+  /// Claim the stimuli for the next simulation run. Returns the index of the
+  /// first claimed stimulus and the number of claimed stimuli (which is 0 if
+  /// all simulations have already been claimed or the false-negative bound
+  /// has been reached).
+  std::pair<std::size_t, std::size_t> claimSimulationStimuli();
+
+  /// Record the counterexample found by the last run of the given checker
+  void recordCounterexample(const DDSimulationChecker& checker);
+
+  /// Drop the counterexample DDs and release the checkers (and their DD
+  /// packages) that are not winding down anymore
+  void releaseFinishedCheckers();
+
+  /// The type of stimuli to use for the next simulation run
+  [[nodiscard]] StateType nextSimulationStateType();
+
+  /// Account for a successful simulation run
+  void recordSimulations(StateType type, std::size_t stimuli, double time);
+
+  /// Reset the simulation bookkeeping before a check
+  void resetSimulations();
+
+  /// Run simulations on the given checker until all stimuli have been claimed,
+  /// the check is done, or non-equivalence has been shown. The checker keeps
+  /// its package, including the gate DDs and compute tables, between runs.
+  void runSimulationWorker(DDSimulationChecker& checker);
 };
 } // namespace ec
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ec {
+
+/**
+ * @brief Re-verify a pair of circuits after small edits of the second circuit.
+ * @details The manager keeps the last checked version of the second circuit
+ * together with its results. Once the pair has been shown equivalent, an
+ * edited version of the second circuit is checked against the previous one
+ * instead of the first circuit. Since both versions share all operations
+ * before and after the edited window, it suffices to check the window of both
+ * versions, which takes about as long as verifying the edited region. Whenever
+ * this shortcut does not apply (e.g., the previous pair has not been shown
+ * equivalent, the layouts of the versions differ, or the window contains
+ * non-unitary operations) or the window check is inconclusive for the full
+ * pair, the full pair is checked from scratch.
+ */
+class IncrementalEquivalenceCheckingManager {
+public:
+  using Results = EquivalenceCheckingManager::Results;
+
+  IncrementalEquivalenceCheckingManager(const qc::QuantumComputation& circ1,
+                                        const qc::QuantumComputation& circ2,
+                                        Configuration config = Configuration{})
+      : qc1(std::make_shared<const qc::QuantumComputation>(circ1)),
+        qc2(std::make_shared<const qc::QuantumComputation>(circ2)),
+        configuration(std::move(config)) {}
+
+  /// Check the current pair from scratch
+  const Results& run();
+
+  /**
+   * @brief Replace the second circuit with an edited version and re-verify.
+   * @details The edited window spans from the first to the last operation in
+   * which both versions of the second circuit differ.
+   * @param circ2 The edited version of the second circuit
+   * @return The results of the edited pair
+   */
+  const Results& update(const qc::QuantumComputation& circ2);
+
+  /**
+   * @brief Replace the second circuit with an edited version and re-verify.
+   * @param circ2 The edited version of the second circuit
+   * @param begin The index of the first edited operation
+   * @param end The index past the last edited operation of the previous
+   * version. The operations `[begin, end)` of the previous version have been
+   * replaced by the operations `[begin, end + circ2.size() - previous size)`
+   * of the edited version.
+   * @return The results of the edited pair
+   * @throws std::invalid_argument if the range is invalid or both versions
+   * differ outside of it
+   */
+  const Results& update(const qc::QuantumComputation& circ2, std::size_t begin,
+                        std::size_t end);
+
+  [[nodiscard]] auto getResults() const -> const auto& { return results; }
+
+  /// Whether the last check has been decided on the edited window alone
+  [[nodiscard]] bool decidedIncrementally() const noexcept {
+    return incremental;
+  }
+  /// The numbers of operations in the edited window of the previous and the
+  /// edited version of the second circuit (in the last update)
+  [[nodiscard]] auto getWindowSize() const -> const auto& { return window; }
+
+  [[nodiscard]] auto getFirstCircuit() const -> const auto& { return *qc1; }
+  [[nodiscard]] auto getSecondCircuit() const -> const auto& { return *qc2; }
+
+  /// Returns a mutable reference to the used configuration
+  [[nodiscard]] auto getConfiguration() -> auto& { return configuration; }
+
+private:
+  /// Re-verify after the operations `[begin, end)` of the second circuit have
+  /// been replaced by the operations `[begin, editedEnd)` of `circ2`
+  const Results& recheck(std::shared_ptr<const qc::QuantumComputation> circ2,
+                         std::size_t begin, std::size_t end,
+                         std::size_t editedEnd);
+
+  /// Check the window of both versions. Returns whether the check has been
+  /// decided for the full pair.
+  bool checkWindow(const qc::QuantumComputation& edited, std::size_t begin,
+                   std::size_t end, std::size_t editedEnd);
+
+  std::shared_ptr<const qc::QuantumComputation> qc1;
+  std::shared_ptr<const qc::QuantumComputation> qc2;
+  Configuration configuration;
+
+  Results results{};
+  bool incremental = false;
+  std::pair<std::size_t, std::size_t> window{};
+};
+} // namespace ec
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace ec {
+/// Returns the current resident set size of the process in bytes (or 0 if it
+/// cannot be determined on the current platform)
+[[nodiscard]] std::size_t getCurrentRSS() noexcept;
+
+/// Returns the peak resident set size of the process in bytes (or 0 if it
+/// cannot be determined on the current platform)
+[[nodiscard]] std::size_t getPeakRSS() noexcept;
+} // namespace ec
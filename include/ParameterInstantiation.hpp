@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Expression.hpp"
+#include "ir/operations/SymbolicOperation.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief Instantiations of the parameters of a pair of symbolic circuits.
+ * @details The (linear) symbolic expressions occurring in the operations of
+ * both circuits form a system of equations `A x + c = b` in the variables
+ * `x`. Instantiations are obtained by choosing the values `b` the expressions
+ * should take and solving the system in the least-squares sense. Since the
+ * system only depends on the circuits, its pseudo-inverse is computed once
+ * and shared by all instantiations.
+ */
+class ParameterInstantiation {
+public:
+  ParameterInstantiation(const qc::QuantumComputation& qc1,
+                         const qc::QuantumComputation& qc2);
+
+  /// The instantiation for which all expressions are (close to) zero
+  [[nodiscard]] qc::VariableAssignment zero() const;
+
+  /// An instantiation for which every expression takes a random value from
+  /// {0, pi, pi/2, -pi/2, pi/4, -pi/4}
+  [[nodiscard]] qc::VariableAssignment
+  randomPhases(std::mt19937_64& mt) const;
+
+  /// An instantiation with uniformly random values in [0, 2pi)
+  [[nodiscard]] qc::VariableAssignment random(std::mt19937_64& mt) const;
+
+  /**
+   * @brief Instantiate a circuit.
+   * @param qc The circuit to instantiate
+   * @param assignment The values of the variables
+   * @param tolerance Parameters whose magnitude is below this tolerance are
+   * set to zero
+   * @return The instantiated circuit
+   */
+  [[nodiscard]] static qc::QuantumComputation
+  instantiate(const qc::QuantumComputation& qc,
+              const qc::VariableAssignment& assignment, double tolerance);
+
+  [[nodiscard]] const std::vector<sym::Variable>& getVariables() const {
+    return variables;
+  }
+
+  /// The number of (non-constant) symbolic expressions in both circuits
+  [[nodiscard]] std::size_t getNumExpressions() const {
+    return offsets.size();
+  }
+
+private:
+  std::vector<sym::Variable> variables;
+  // the negated constant part of each expression
+  std::vector<double> offsets;
+  // the pseudo-inverse of the coefficient matrix (variables x expressions)
+  std::vector<std::vector<double>> pseudoInverse;
+
+  [[nodiscard]] qc::VariableAssignment
+  solve(const std::vector<double>& values) const;
+};
+} // namespace ec
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief Content-addressed cache for preprocessed circuits.
+ * @details Entries are identified by the hash of the original circuits
+ * together with the optimization options used for preprocessing them. This
+ * allows to skip the preprocessing whenever the same circuit is checked
+ * repeatedly (e.g., against many compiled variants). Entries are kept in
+ * memory and, if a directory is given, are additionally persisted to disk
+ * (as OpenQASM 3 together with a JSON file describing the qubit layout and
+ * the compound operations), so that they survive the process. Entries that
+ * cannot be represented this way (e.g., nested compound operations) are only
+ * kept in memory. Cached circuits are immutable.
+ */
+class PreprocessingCache {
+public:
+  using Circuits = std::vector<std::shared_ptr<const qc::QuantumComputation>>;
+
+  static constexpr std::size_t DEFAULT_CAPACITY = 256U;
+
+  explicit PreprocessingCache(const std::size_t capacity = DEFAULT_CAPACITY)
+      : maxEntries(capacity) {}
+
+  /// The cache shared by all equivalence checking managers of the process
+  static PreprocessingCache& global();
+
+  /// Stable hash of the contents of a circuit (including its qubit layout)
+  [[nodiscard]] static std::uint64_t hash(const qc::QuantumComputation& qc);
+
+  /// Key of the optimized version of a single circuit
+  [[nodiscard]] static std::string
+  circuitKey(std::uint64_t circuitHash,
+             const Configuration::Optimizations& optimizations);
+
+  /// Key of the fully preprocessed versions of a pair of circuits
+  [[nodiscard]] static std::string
+  pairKey(std::uint64_t hash1, std::uint64_t hash2,
+          const Configuration::Optimizations& optimizations, bool optimized1,
+          bool optimized2);
+
+  /**
+   * @brief Look up an entry.
+   * @param key The key of the entry
+   * @param directory The directory of the persistent cache (if any)
+   * @return The cached circuits or `std::nullopt` if there is no such entry
+   */
+  [[nodiscard]] std::optional<Circuits>
+  lookup(const std::string& key, const std::string& directory = {});
+
+  /**
+   * @brief Store an entry.
+   * @details Failing to persist an entry to disk is not considered an error.
+   * @param key The key of the entry
+   * @param circuits The preprocessed circuits
+   * @param directory The directory of the persistent cache (if any)
+   */
+  void store(const std::string& key, const Circuits& circuits,
+             const std::string& directory = {});
+
+  [[nodiscard]] std::size_t size() const;
+  [[nodiscard]] std::size_t getHits() const;
+  [[nodiscard]] std::size_t getMisses() const;
+
+  /// Remove all entries kept in memory
+  void clear();
+
+private:
+  mutable std::mutex mutex;
+  std::unordered_map<std::string, Circuits> entries;
+  // insertion order of the entries for evicting the oldest ones
+  std::deque<std::string> order;
+  std::size_t maxEntries;
+  std::size_t hits = 0U;
+  std::size_t misses = 0U;
+
+  void insert(const std::string& key, const Circuits& circuits);
+};
+} // namespace ec
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace ec {
+/// A pair of subcircuits acting on the same set of logical qubits
+using ComponentPair = std::pair<qc::QuantumComputation, qc::QuantumComputation>;
+
+/**
+ * @brief Split a pair of circuits into independent qubit components.
+ * @details Two logical qubits belong to the same component if an operation of
+ * either circuit acts on both of them or if a physical qubit of either circuit
+ * carries one of them at its input and the other one at its output. The
+ * functionality of each circuit is then the tensor product of its restrictions
+ * to the components, so the circuits are equivalent if and only if all pairs
+ * of restrictions are. The global phase of both circuits is assigned to the
+ * first component. Both circuits need to have the same number of qubits, a
+ * complete output permutation, and only unitary operations (barriers are
+ * ignored); otherwise, no decomposition is attempted.
+ * @param qc1 The first (preprocessed) circuit
+ * @param qc2 The second (preprocessed) circuit
+ * @return The components ordered by increasing number of qubits or nothing if
+ * the circuits do not decompose into (at least) two components
+ */
+[[nodiscard]] std::vector<ComponentPair>
+splitIntoComponents(const qc::QuantumComputation& qc1,
+                    const qc::QuantumComputation& qc2);
+} // namespace ec
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+namespace ec {
+/**
+ * @brief A bounded multi-producer single-consumer channel.
+ * @details Values are stored in a ring buffer that is allocated once on
+ * construction, such that pushing and popping never allocates. Producers
+ * claim a slot by advancing the tail and publish it via the slot's sequence
+ * number. The consumer blocks on an atomic counter of published values
+ * (which maps onto a futex on Linux), or on a condition variable if it waits
+ * with a deadline. The buffer has to be large enough for all values that are
+ * pushed but not yet popped; producers spin until a slot becomes available
+ * otherwise.
+ * @tparam T The type of the values (must be trivially copyable)
+ */
+template <typename T> class ResultChannel {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Values must be trivially copyable");
+
+public:
+  /// Create a channel with room for (at least) the given number of values
+  explicit ResultChannel(const std::size_t capacity)
+      : mask(std::bit_ceil(std::max<std::size_t>(capacity, 1U)) - 1U),
+        slots(std::make_unique<Slot[]>(mask + 1U)) {
+    for (std::size_t i = 0U; i <= mask; ++i) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ResultChannel(const ResultChannel& other) = delete;
+
+  ResultChannel& operator=(const ResultChannel& other) = delete;
+
+  void push(const T& value) {
+    auto position = tail.load(std::memory_order_relaxed);
+    while (true) {
+      auto& slot = slots[position & mask];
+      const auto sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == position) {
+        if (tail.compare_exchange_weak(position, position + 1U,
+                                       std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(position + 1U, std::memory_order_release);
+          break;
+        }
+      } else {
+        if (sequence < position) {
+          // the buffer is full, so wait for the consumer to catch up
+          std::this_thread::yield();
+        }
+        position = tail.load(std::memory_order_relaxed);
+      }
+    }
+    published.fetch_add(1U, std::memory_order_seq_cst);
+    published.notify_one();
+    if (timedWaiting.load(std::memory_order_seq_cst)) {
+      // synchronize with a consumer that is about to wait
+      {
+        const std::lock_guard lock(waitMutex);
+      }
+      waitCond.notify_one();
+    }
+  }
+
+  /// Pop a value if one is available (consumer only)
+  [[nodiscard]] std::optional<T> tryPop() {
+    auto& slot = slots[head & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != head + 1U) {
+      return std::nullopt;
+    }
+    const T value = slot.value;
+    // hand the slot back to the producers for the next round
+    slot.sequence.store(head + mask + 1U, std::memory_order_release);
+    ++head;
+    return value;
+  }
+
+  /// Wait until a value is available and pop it (consumer only)
+  [[nodiscard]] T waitAndPop() {
+    while (true) {
+      if (auto value = tryPop()) {
+        return *value;
+      }
+      const auto observed = published.load(std::memory_order_acquire);
+      if (observed == static_cast<std::uint32_t>(head)) {
+        published.wait(observed, std::memory_order_acquire);
+      }
+    }
+  }
+
+  /**
+   * @brief Wait until a value is available or the time point is reached.
+   * @details Atomic waits cannot time out, so the consumer waits on a
+   * condition variable instead, which producers only notify while a consumer
+   * announced to be waiting on it.
+   * @return The popped value or nothing if the time point has been reached
+   */
+  template <typename Clock, typename Dur>
+  [[nodiscard]] std::optional<T>
+  waitAndPopUntil(const std::chrono::time_point<Clock, Dur>& timepoint) {
+    while (true) {
+      if (auto value = tryPop()) {
+        return value;
+      }
+      std::unique_lock lock(waitMutex);
+      timedWaiting.store(true, std::memory_order_seq_cst);
+      const auto available = waitCond.wait_until(lock, timepoint, [this] {
+        return published.load(std::memory_order_seq_cst) !=
+               static_cast<std::uint32_t>(head);
+      });
+      timedWaiting.store(false, std::memory_order_relaxed);
+      if (!available) {
+        return tryPop();
+      }
+    }
+  }
+
+  [[nodiscard]] bool empty() const {
+    return published.load(std::memory_order_acquire) ==
+           static_cast<std::uint32_t>(head);
+  }
+
+  [[nodiscard]] std::size_t capacity() const noexcept { return mask + 1U; }
+
+private:
+  static constexpr std::size_t CACHE_LINE = 64U;
+
+  struct alignas(CACHE_LINE) Slot {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  std::size_t mask;
+  std::unique_ptr<Slot[]> slots;
+
+  // producers and consumer work on separate cache lines
+  alignas(CACHE_LINE) std::atomic<std::size_t> tail{0U};
+  alignas(CACHE_LINE) std::size_t head{0U};
+  // the number of published values (modulo 2^32), used as the futex word
+  std::atomic<std::uint32_t> published{0U};
+
+  // used by the consumer to wait with a deadline
+  std::atomic<bool> timedWaiting{false};
+  std::mutex waitMutex;
+  std::condition_variable waitCond;
+};
+} // namespace ec
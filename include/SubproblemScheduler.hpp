@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+/**
+ * @brief Check a number of sub-problems with separate managers.
+ * @details The sub-problems (e.g., instantiations of symbolic circuits,
+ * independent components, slices, or the pairs of a batch) are checked by
+ * managers created on demand, up to `Options::concurrency` of them at a time.
+ * The calling thread checks sub-problems itself and the remaining ones are
+ * checked on the thread pool, so that at most `concurrency` threads are busy
+ * with the sub-problems. Depending on `Options::cancellation`, a sub-problem
+ * that is shown to be non-equivalent cancels the others.
+ */
+class SubproblemScheduler {
+public:
+  using Results = EquivalenceCheckingManager::Results;
+
+  /// Create the manager of the sub-problem with the given index from the given
+  /// configuration (or return `nullptr` to skip the sub-problem)
+  using Factory = std::function<std::unique_ptr<EquivalenceCheckingManager>(
+      std::size_t index, const Configuration& config)>;
+
+  /// Callback invoked (serialized) with the index and results of each
+  /// sub-problem as soon as it has been checked
+  using ResultCallback =
+      std::function<void(std::size_t index, const Results& results)>;
+
+  /// The sub-problems cancelled by a non-equivalent sub-problem
+  enum class Cancellation : std::uint8_t {
+    /// The sub-problems are independent of each other
+    None,
+    /// All sub-problems with a larger index are cancelled
+    Later,
+    /// All other sub-problems are cancelled
+    All,
+  };
+
+  struct Options {
+    /// The number of sub-problems checked concurrently (a thread pool is
+    /// required if it is larger than one)
+    std::size_t concurrency = 1U;
+    std::shared_ptr<ThreadPool> threadPool;
+    Cancellation cancellation = Cancellation::None;
+    /// If positive, all sub-problems together have to finish within this time
+    /// (in seconds) after `start`, and each of them only gets the remaining
+    /// time as its timeout
+    double timeout = 0.;
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+  };
+
+  explicit SubproblemScheduler(Options opts) : options(std::move(opts)) {}
+
+  /**
+   * @brief Check the given number of sub-problems.
+   * @details The counterexample DDs are not retained in the results since they
+   * live in the DD package of the individual managers. If the check of any
+   * sub-problem throws, the first exception is rethrown once all running
+   * sub-problems have finished.
+   * @param count The number of sub-problems
+   * @param config The configuration passed to the factory
+   * @param factory The factory creating the managers of the sub-problems
+   * @param callback Optional callback to stream the results
+   * @return The results of all sub-problems that have been checked
+   */
+  std::vector<std::optional<Results>>
+  run(std::size_t count, const Configuration& config, const Factory& factory,
+      const ResultCallback& callback = {});
+
+  /// Cancel all running sub-problems and skip all remaining ones
+  void cancel();
+
+  /// The index of the first sub-problem shown to be non-equivalent (if any)
+  [[nodiscard]] std::optional<std::size_t> firstDisproof() const;
+
+  /// The number of sub-problems that have been checked in the last run
+  [[nodiscard]] std::size_t checked() const noexcept { return numChecked; }
+
+private:
+  Options options;
+
+  std::atomic<bool> cancelled{false};
+  std::atomic<std::size_t> disproof{0U};
+  std::atomic<std::size_t> numChecked{0U};
+  std::size_t numSubproblems = 0U;
+
+  /// Managers that currently check a sub-problem (indexed by the sub-problem)
+  std::vector<EquivalenceCheckingManager*> active;
+  std::mutex activeMutex;
+
+  /// Whether the sub-problem with the given index shall (still) be checked
+  [[nodiscard]] bool pending(std::size_t index) const;
+
+  /// Record that the sub-problem with the given index is non-equivalent and
+  /// cancel the affected sub-problems
+  void disprove(std::size_t index);
+};
+} // namespace ec
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief A work-stealing pool of long-lived worker threads.
+ * @details Each worker owns a local task deque. Tasks submitted from outside
+ * the pool are distributed round-robin over the workers, while tasks submitted
+ * from within a worker are pushed to the worker's own deque. Idle workers
+ * first drain their own deque (LIFO) and then try to steal from the other
+ * workers (FIFO). A pool may be shared between multiple
+ * EquivalenceCheckingManager instances.
+ */
+class ThreadPool {
+public:
+  /// Create a pool with the given number of workers (at least one)
+  explicit ThreadPool(std::size_t nthreads);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  /// Finish all pending tasks and join the worker threads
+  ~ThreadPool();
+
+  /**
+   * @brief Schedule a task for execution on one of the workers.
+   * @details In contrast to `std::async`, the destructor of the returned future
+   * does not block. Callers have to make sure that all data referenced by the
+   * task outlives its execution.
+   * @param f The task to execute
+   * @return A future holding the result (or exception) of the task
+   */
+  template <class F>
+  [[nodiscard]] auto submit(F&& f) -> std::future<std::invoke_result_t<F>> {
+    using R = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+    auto future = task->get_future();
+    enqueue([task = std::move(task)] { (*task)(); });
+    return future;
+  }
+
+  /// The number of worker threads
+  [[nodiscard]] std::size_t size() const noexcept { return workers.size(); }
+
+  /**
+   * @brief Execute a single pending task on the calling thread (if any).
+   * @details This allows threads that block on results of the pool to help
+   * instead of idling, which prevents deadlocks when waiting from within a
+   * worker.
+   * @return Whether a task has been executed
+   */
+  bool runPendingTask();
+
+private:
+  using Task = std::function<void()>;
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  std::vector<std::thread> workers;
+
+  std::mutex sleepMutex;
+  std::condition_variable sleepCond;
+  std::size_t pending = 0U;
+  std::size_t nextQueue = 0U;
+  bool stopping = false;
+
+  void enqueue(Task task);
+  bool tryPop(std::size_t index, Task& task);
+  void workerLoop(std::size_t index);
+};
+} // namespace ec
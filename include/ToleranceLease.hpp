@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/DDDefinitions.hpp"
+
+namespace ec {
+/**
+ * @brief A claim on the numerical tolerance of the DD package.
+ * @details The tolerance is a process-wide setting of the DD package, so all
+ * checks running at the same time have to agree on it. The first lease sets
+ * the tolerance, while further (shared) leases are only granted for the same
+ * tolerance. An exclusive lease is only granted while no other lease is held
+ * and is the only one that may change the tolerance afterwards, e.g., for each
+ * checker of a sequential check. Conflicting leases are rejected instead of
+ * changing the tolerance under a running check.
+ */
+class ToleranceLease {
+public:
+  /**
+   * @brief Acquire a lease and set the tolerance (if no other lease is held).
+   * @param tolerance The tolerance the check requires
+   * @param exclusive Whether the tolerance shall be changed later on
+   * @throws std::runtime_error If the lease conflicts with a held one
+   */
+  ToleranceLease(dd::fp tolerance, bool exclusive);
+
+  ToleranceLease(const ToleranceLease&) = delete;
+  ToleranceLease& operator=(const ToleranceLease&) = delete;
+  ToleranceLease(ToleranceLease&&) = delete;
+  ToleranceLease& operator=(ToleranceLease&&) = delete;
+
+  ~ToleranceLease();
+
+  [[nodiscard]] bool isExclusive() const noexcept { return exclusive; }
+
+  /// Switch to another tolerance (only has an effect for exclusive leases)
+  void use(dd::fp tolerance) const;
+
+private:
+  bool exclusive;
+};
+} // namespace ec
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <cstddef>
 #include <nlohmann/json_fwd.hpp>
+#include <string_view>
 #include <utility>
 
 namespace ec {
@@ -41,11 +42,51 @@ public:
 
   virtual void json(nlohmann::json& j) const noexcept;
 
+  /// The name of the checker (as reported in its JSON output)
+  [[nodiscard]] virtual std::string_view getName() const noexcept = 0;
+
+  /// A snapshot of the progress of a checker
+  struct Progress {
+    /// Number of gates of the first and second circuit applied so far
+    std::size_t gates1 = 0U;
+    std::size_t gates2 = 0U;
+    /// Size of the DD (or number of vertices of the ZX-diagram) when it was
+    /// last sampled
+    std::size_t nodes = 0U;
+    /// Number of rewrites applied to the ZX-diagram
+    std::size_t rewrites = 0U;
+  };
+
+  /// The current progress of the checker. This may be called from other
+  /// threads while the checker is running.
+  [[nodiscard]] Progress getProgress() const noexcept {
+    return {progress.gates1.load(std::memory_order_relaxed),
+            progress.gates2.load(std::memory_order_relaxed),
+            progress.nodes.load(std::memory_order_relaxed),
+            progress.rewrites.load(std::memory_order_relaxed)};
+  }
+
+  /// Request the checker to sample the size of its data structure at its next
+  /// cancellation point. Determining the size requires a traversal, so it is
+  /// only done on request.
+  void requestProgress() noexcept {
+    progressRequested.store(true, std::memory_order_relaxed);
+  }
+
+  /// Request the checker to stop as soon as possible. Checkers poll this flag
+  /// at their cancellation points (e.g., between the application of two gates)
+  /// and return without a result once it is set.
   void signalDone() { done.store(true, std::memory_order_relaxed); }
   [[nodiscard]] auto isDone() const {
     return done.load(std::memory_order_relaxed);
   }
 
+  /// Whether the checker stopped without a result because it exceeded its
+  /// memory budget
+  [[nodiscard]] virtual bool exceededMemoryLimit() const noexcept {
+    return false;
+  }
+
 protected:
   qc::QuantumComputation const* qc1;
   qc::QuantumComputation const* qc2;
@@ -57,8 +98,34 @@ protected:
   EquivalenceCriterion equivalence = EquivalenceCriterion::NoInformation;
   double runtime{};
 
+  /// Counters backing `getProgress()`, which are only written by the thread
+  /// running the checker
+  struct ProgressCounters {
+    std::atomic<std::size_t> gates1{0U};
+    std::atomic<std::size_t> gates2{0U};
+    std::atomic<std::size_t> nodes{0U};
+    std::atomic<std::size_t> rewrites{0U};
+  };
+  ProgressCounters progress;
+
+  /// Whether a sample of the size has been requested (clears the request)
+  [[nodiscard]] bool progressSampleRequested() noexcept {
+    return progressRequested.load(std::memory_order_relaxed) &&
+           progressRequested.exchange(false, std::memory_order_relaxed);
+  }
+  void reportNodes(const std::size_t nodes) noexcept {
+    progress.nodes.store(nodes, std::memory_order_relaxed);
+  }
+
+  /// The flag set by `signalDone()`, which can be handed to helper objects
+  /// (e.g., task managers) that need to observe cancellation requests.
+  [[nodiscard]] const std::atomic<bool>& getDoneFlag() const noexcept {
+    return done;
+  }
+
 private:
   std::atomic<bool> done{false};
+  std::atomic<bool> progressRequested{false};
 };
 
 } // namespace ec
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/EquivalenceChecker.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief Checks pairs of Clifford circuits by means of stabilizer tableaux.
+ * @details The maximally entangled state of the data qubits with as many
+ * reference qubits (with all ancillary qubits in |0>) is passed through the
+ * first circuit and, afterwards, through the inverse of the second circuit.
+ * Both circuits are equivalent up to a global phase iff the state is left
+ * unchanged, which is decided on the stabilizer tableau of the state in time
+ * polynomial in the number of qubits. In contrast to the ZX checker, the
+ * verdict is complete, also in the presence of ancillary qubits. Since
+ * stabilizer tableaux do not capture global phases, equivalent circuits are
+ * reported as equivalent up to a global phase.
+ */
+class CliffordEquivalenceChecker : public EquivalenceChecker {
+public:
+  CliffordEquivalenceChecker(const qc::QuantumComputation& circ1,
+                             const qc::QuantumComputation& circ2,
+                             Configuration config) noexcept
+      : EquivalenceChecker(circ1, circ2, std::move(config)) {}
+
+  EquivalenceCriterion run() override;
+
+  /// Whether both circuits only consist of (supported) Clifford operations
+  /// and agree in their qubits and ancillary qubits
+  static bool canHandle(const qc::QuantumComputation& qc1,
+                        const qc::QuantumComputation& qc2);
+
+  void json(nlohmann::basic_json<>& j) const noexcept override;
+
+  [[nodiscard]] std::string_view getName() const noexcept override {
+    return "clifford";
+  }
+
+  /**
+   * @brief The stabilizer generators of a state on a number of qubits.
+   * @details Following Aaronson and Gottesman, each generator is a Pauli
+   * string with a sign. The X and Z components are stored per qubit as
+   * bitsets over all generators, so that applying a gate only touches the
+   * columns of its qubits.
+   */
+  class Tableau {
+  public:
+    /// The tableau of the all-zero state
+    explicit Tableau(std::size_t nqubits);
+
+    void h(std::size_t q);
+    void s(std::size_t q);
+    void sdg(std::size_t q);
+    void x(std::size_t q);
+    void y(std::size_t q);
+    void z(std::size_t q);
+    void cx(std::size_t control, std::size_t target);
+    void swap(std::size_t q0, std::size_t q1);
+
+    /// Move qubit `q` to position `permutation[q]` (for all qubits covered by
+    /// the permutation)
+    void permute(const std::vector<std::size_t>& permutation);
+
+    /**
+     * @brief Whether the state is the maximally entangled state of the given
+     * qubits with the reference qubits (with all other qubits in |0>).
+     * @param references The reference qubit of each qubit, or the number of
+     * qubits for qubits that are in |0>
+     */
+    [[nodiscard]] bool
+    isChoiState(const std::vector<std::size_t>& references) const;
+
+    [[nodiscard]] std::size_t getNqubits() const noexcept {
+      return xs.size();
+    }
+
+  private:
+    using Column = std::vector<std::uint64_t>;
+    std::vector<Column> xs;
+    std::vector<Column> zs;
+    Column signs;
+  };
+
+private:
+  /// The gates the operations of the circuits are decomposed into
+  enum class Gate : std::uint8_t { H, S, Sdg, X, Y, Z, CX, SWAP };
+  struct Step {
+    Gate gate;
+    qc::Qubit q0;
+    qc::Qubit q1;
+  };
+
+  /// Append the decomposition of the operation into the gates above to the
+  /// given steps. Returns false if the operation is not (a supported) Clifford.
+  static bool decompose(const qc::Operation& op, std::vector<Step>& steps);
+
+  /// Apply all operations of the circuit (or their inverses in reverse order)
+  /// to the tableau. Returns false if the check has been aborted.
+  bool apply(const qc::QuantumComputation& qc, Tableau& tableau, bool inverse,
+             std::atomic<std::size_t>& gates);
+
+  std::size_t tableauQubits = 0U;
+  std::size_t appliedGates = 0U;
+};
+} // namespace ec
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief The state of a DD-based checker from which a check can be resumed.
+ * @details A checkpoint file starts with a line identifying the format,
+ * followed by a line of JSON describing the checker, the circuits (by their
+ * content hash as well as their ancillary and garbage qubits), and the
+ * positions and permutations of both task managers. The rest of the file
+ * holds the accumulated DD in the binary serialization format of the DD
+ * package, so that checkpoints can be moved between machines.
+ */
+struct Checkpoint {
+  static constexpr std::uint64_t FORMAT_VERSION = 2U;
+
+  std::string checker;
+  std::string scheme;
+  std::uint64_t hash1{};
+  std::uint64_t hash2{};
+  std::size_t nqubits{};
+  // the ancillary and garbage qubits of both circuits
+  std::array<std::vector<bool>, 2> ancillary{};
+  std::array<std::vector<bool>, 2> garbage{};
+  std::array<std::size_t, 2> positions{};
+  std::array<qc::Permutation, 2> permutations{};
+
+  /// Describe the check that is performed on the given circuits
+  Checkpoint(std::string checkerName, std::string schemeName,
+             const qc::QuantumComputation& qc1,
+             const qc::QuantumComputation& qc2);
+
+  /// Whether the checkpoint belongs to the same check as the other one
+  [[nodiscard]] bool matches(const Checkpoint& other) const noexcept {
+    return checker == other.checker && scheme == other.scheme &&
+           hash1 == other.hash1 && hash2 == other.hash2 &&
+           nqubits == other.nqubits && ancillary == other.ancillary &&
+           garbage == other.garbage;
+  }
+
+  /**
+   * @brief Write the checkpoint together with the given DD.
+   * @details The file is written to a temporary location first and then moved
+   * into place, so that an interrupted write never corrupts an existing
+   * checkpoint.
+   * @return Whether the checkpoint has been written
+   */
+  bool save(const std::string& filename, const dd::MatrixDD& dd) const;
+
+  /**
+   * @brief Read a checkpoint of the same check as this one.
+   * @details Missing, corrupt, and non-matching checkpoints are ignored, as
+   * are checkpoints whose DD does not fit the package or the circuits.
+   * @param filename The checkpoint file
+   * @param package The package the DD is reconstructed in
+   * @return The stored checkpoint and DD (with a reference added) or nothing
+   */
+  [[nodiscard]] std::optional<std::pair<Checkpoint, dd::MatrixDD>>
+  load(const std::string& filename, dd::Package& package) const;
+
+private:
+  Checkpoint() = default;
+};
+} // namespace ec
@@ -12,10 +12,15 @@
 
 #include "DDEquivalenceChecker.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "checker/dd/Checkpoint.hpp"
 #include "dd/Node.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <chrono>
+#include <cstddef>
 #include <nlohmann/json_fwd.hpp>
+#include <optional>
+#include <string_view>
 
 namespace qc {
 class QuantumComputation;
@@ -32,6 +37,10 @@ public:
 
   void json(nlohmann::json& j) const noexcept override;
 
+  [[nodiscard]] std::string_view getName() const noexcept override {
+    return "decision_diagram_alternating";
+  }
+
   /// a function to determine whether the alternating checker can handle
   /// checking both circuits. In particular, it checks whether both circuits
   /// contain non-idle ancillaries.
@@ -41,12 +50,29 @@ public:
 private:
   dd::MatrixDD functionality{};
 
+  // the description of the check if checkpoints are enabled
+  std::optional<Checkpoint> checkpoint;
+  std::chrono::steady_clock::time_point lastCheckpoint;
+  bool resumed = false;
+  std::size_t checkpointsWritten = 0U;
+
+  /// Continue from the configured checkpoint file if it belongs to this check
+  void resumeFromCheckpoint();
+  /// Write the current state to the configured checkpoint file
+  void writeCheckpoint();
+  /// Write a checkpoint if the checkpoint interval has passed
+  void writeCheckpointIfDue();
+
   void initialize() override;
   void execute() override;
   void finish() override;
   void postprocess() override;
   EquivalenceCriterion checkEquivalence() override;
 
+  [[nodiscard]] std::size_t currentNodes() const override {
+    return functionality.size();
+  }
+
   // at some point this routine should probably make its way into the QFR
   // library
   [[nodiscard]] bool gatesAreIdentical() const;
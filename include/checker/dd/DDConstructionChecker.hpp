@@ -14,7 +14,9 @@
 #include "checker/dd/TaskManager.hpp"
 #include "dd/Node.hpp"
 
+#include <cstddef>
 #include <nlohmann/json_fwd.hpp>
+#include <string_view>
 
 namespace qc {
 class QuantumComputation;
@@ -31,7 +33,30 @@ public:
 
   void json(nlohmann::json& j) const noexcept override;
 
+  [[nodiscard]] std::string_view getName() const noexcept override {
+    return "decision_diagram_construction";
+  }
+
 private:
+  /// The number of segments each circuit has been split into (0 if the
+  /// functionality has been built gate by gate)
+  std::size_t segments1 = 0U;
+  std::size_t segments2 = 0U;
+
   void initializeTask(TaskManager<dd::MatrixDD>& taskManager) override;
+  void execute() override;
+
+  /**
+   * @brief Build the functionality of a circuit from segments in parallel.
+   * @details The circuit is split into (at most) `constructionThreads`
+   * segments of consecutive operations. Their unitaries are built
+   * concurrently in separate DD packages and multiplied in a balanced tree,
+   * where each product is computed in the package of the earlier segment.
+   * The result is then applied to the internal state of the task, such that
+   * the task ends up in the same state as after applying all gates.
+   * @param task The task to build
+   * @return The number of segments (0 if the task was built gate by gate)
+   */
+  std::size_t executeSegmented(TaskManager<dd::MatrixDD>& task);
 };
 } // namespace ec
@@ -11,7 +11,10 @@
 #pragma once
 
 #include "Configuration.hpp"
+#include "DDPackageConfigs.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "GarbageCollector.hpp"
+#include "GateDDCache.hpp"
 #include "TaskManager.hpp"
 #include "applicationscheme/ApplicationScheme.hpp"
 #include "checker/EquivalenceChecker.hpp"
@@ -19,6 +22,7 @@
 #include "dd/Package.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <nlohmann/json_fwd.hpp>
@@ -27,25 +31,70 @@
 namespace ec {
 template <class DDType> class DDEquivalenceChecker : public EquivalenceChecker {
 public:
-  DDEquivalenceChecker(
-      const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
-      Configuration config,
-      const dd::DDPackageConfig& packageConfig = dd::DDPackageConfig{})
+  DDEquivalenceChecker(const qc::QuantumComputation& circ1,
+                       const qc::QuantumComputation& circ2,
+                       Configuration config,
+                       const DDPackageConfigFactory makePackageConfig)
       : EquivalenceChecker(circ1, circ2, std::move(config)),
-        dd(std::make_unique<dd::Package>(nqubits, packageConfig)),
+        packageConfiguration(
+            makePackageConfig(circ1, circ2, configuration.execution)),
+        dd(std::make_unique<dd::Package>(nqubits, packageConfiguration)),
+        gateCache(*dd),
+        garbageCollector(*dd, configuration.execution.gcInterval,
+                         configuration.execution.gcMemoryThreshold),
         taskManager1(TaskManager<DDType>(circ1, *dd)),
-        taskManager2(TaskManager<DDType>(circ2, *dd)) {}
+        taskManager2(TaskManager<DDType>(circ2, *dd)) {
+    taskManager1.setStopFlag(&getDoneFlag());
+    taskManager2.setStopFlag(&getDoneFlag());
+    taskManager1.setProgressCounter(&progress.gates1);
+    taskManager2.setProgressCounter(&progress.gates2);
+    // both circuits share the gate DDs of the package
+    taskManager1.setGateCache(&gateCache);
+    taskManager2.setGateCache(&gateCache);
+    taskManager1.setGarbageCollector(&garbageCollector);
+    taskManager2.setGarbageCollector(&garbageCollector);
+    garbageCollector.setMemoryLimits(
+        configuration.execution.checkerMemoryLimit,
+        configuration.execution.memoryLimit, [this] { signalDone(); });
+  }
 
   EquivalenceCriterion run() override;
 
+  void json(nlohmann::json& j) const noexcept override;
+
+  [[nodiscard]] bool exceededMemoryLimit() const noexcept override {
+    return garbageCollector.memoryLimitExceeded();
+  }
+
 protected:
+  /// Configuration the package has been created with
+  dd::DDPackageConfig packageConfiguration;
   std::unique_ptr<dd::Package> dd;
 
+  /// Memoized gate DDs shared by both task managers
+  GateDDCache gateCache;
+
+  /// Garbage collection policy shared by both task managers
+  GarbageCollector garbageCollector;
+
   TaskManager<DDType> taskManager1;
   TaskManager<DDType> taskManager2;
 
   std::unique_ptr<ApplicationScheme<DDType>> applicationScheme;
 
+  // time spent in the individual phases of the check and the sizes of the DDs
+  // (accumulated over all runs, only recorded if instrumentation is enabled)
+  struct PhaseTimes {
+    double initialize = 0.;
+    double execute = 0.;
+    double finish = 0.;
+    double postprocess = 0.;
+    double checkEquivalence = 0.;
+  };
+  PhaseTimes phaseTimes{};
+  std::size_t peakNodes = 0U;
+  std::size_t finalNodes = 0U;
+
   void initializeApplicationScheme(ApplicationSchemeType scheme);
 
   // at some point this routine should probably make its way into the DD package
@@ -59,6 +108,25 @@ protected:
   virtual void postprocessTask(TaskManager<DDType>& task);
   virtual void postprocess();
   virtual EquivalenceCriterion checkEquivalence();
+
+  /// The number of nodes of the DDs the checker currently works on
+  [[nodiscard]] virtual std::size_t currentNodes() const {
+    return taskManager1.getInternalState().size() +
+           taskManager2.getInternalState().size();
+  }
+  /// Report the current number of nodes if a sample has been requested and
+  /// track the peak number of nodes if instrumentation is enabled
+  void sampleProgress() {
+    const auto requested = progressSampleRequested();
+    if (!requested && !configuration.execution.instrumentation) {
+      return;
+    }
+    const auto nodes = currentNodes();
+    peakNodes = std::max(peakNodes, nodes);
+    if (requested) {
+      reportNodes(nodes);
+    }
+  }
 };
 
 } // namespace ec
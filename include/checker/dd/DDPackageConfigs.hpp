@@ -10,68 +10,64 @@
 
 #pragma once
 
+#include "Configuration.hpp"
 #include "dd/DDpackageConfig.hpp"
+#include "ir/QuantumComputation.hpp"
 
 #include <cstddef>
+#include <nlohmann/json_fwd.hpp>
 
 namespace ec {
-struct SimulationDDPackageConfig : public dd::DDPackageConfig {
-  // simulation requires more resources for vectors.
-  static constexpr std::size_t UT_VEC_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 32'768U;
-
-  // simulation only needs matrices for representing operations. Hence, very
-  // little is needed here.
-  static constexpr std::size_t UT_MAT_NBUCKET = 128U;
-  static constexpr std::size_t UT_MAT_INITIAL_ALLOCATION_SIZE = 32U;
-
-  // simulation needs no matrix addition, conjugate transposition, matrix-matrix
-  // multiplication, or kronecker products.
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_CONJ_TRANS_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
+/// Number of buckets of the unique and compute tables predominantly used by a
+/// DD-based checker
+struct DDPackageSizes {
+  std::size_t uniqueTableBuckets{};
+  std::size_t computeTableBuckets{};
 };
 
-struct ConstructionDDPackageConfig : public dd::DDPackageConfig {
-  // construction requires more resources for matrices.
-  static constexpr std::size_t UT_MAT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_CONJ_TRANS_NBUCKET = 32'768U;
+/**
+ * @brief Determine the sizes of the tables of a DD package for a check.
+ * @details Sizes configured explicitly in the execution options take
+ * precedence. Otherwise, the sizes are derived from the number of qubits and
+ * the number of gates of the circuits. If the number of distinct nodes is
+ * bounded by the dimension of the represented objects (which is the case for
+ * small circuits), the tables are not made any larger than that. All sizes
+ * are powers of two.
+ * @param nqubits The number of qubits of the check
+ * @param ngates The total number of gates of both circuits
+ * @param matrices Whether the tables hold matrix (or vector) nodes
+ * @param execution The execution options holding explicit sizes
+ * @return The sizes of the tables
+ */
+[[nodiscard]] DDPackageSizes
+estimateDDPackageSizes(std::size_t nqubits, std::size_t ngates, bool matrices,
+                       const Configuration::Execution& execution) noexcept;
 
-  // construction does not need any vector nodes
-  static constexpr std::size_t UT_VEC_NBUCKET = 1U;
-  static constexpr std::size_t UT_VEC_INITIAL_ALLOCATION_SIZE = 1U;
+/// Derives the package configuration of a checker from its circuits
+using DDPackageConfigFactory = dd::DDPackageConfig (*)(
+    const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
+    const Configuration::Execution& execution);
 
-  // construction needs no vector addition, matrix-vector multiplication,
-  // kronecker products, or inner products.
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 1U;
-};
+/// Package configuration for simulation, which mostly requires resources for
+/// vectors
+[[nodiscard]] dd::DDPackageConfig
+makeSimulationDDPackageConfig(const qc::QuantumComputation& circ1,
+                              const qc::QuantumComputation& circ2,
+                              const Configuration::Execution& execution);
 
-struct AlternatingDDPackageConfig : public dd::DDPackageConfig {
-  // The alternating checker requires more resources for matrices.
-  static constexpr std::size_t UT_MAT_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_ADD_NBUCKET = 65'536U;
-  static constexpr std::size_t CT_MAT_MAT_MULT_NBUCKET = 65'536U;
+/// Package configuration for construction, which only requires matrices
+[[nodiscard]] dd::DDPackageConfig
+makeConstructionDDPackageConfig(const qc::QuantumComputation& circ1,
+                                const qc::QuantumComputation& circ2,
+                                const Configuration::Execution& execution);
 
-  // The alternating checker does not need any vector nodes
-  static constexpr std::size_t UT_VEC_NBUCKET = 1U;
-  static constexpr std::size_t UT_VEC_INITIAL_ALLOCATION_SIZE = 1U;
+/// Package configuration for the alternating scheme, which only requires
+/// matrices
+[[nodiscard]] dd::DDPackageConfig
+makeAlternatingDDPackageConfig(const qc::QuantumComputation& circ1,
+                               const qc::QuantumComputation& circ2,
+                               const Configuration::Execution& execution);
 
-  // The alternating needs no vector addition, matrix-vector multiplication,
-  // kronecker products, or inner products.
-  static constexpr std::size_t CT_VEC_ADD_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_VEC_MULT_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_MAT_KRON_NBUCKET = 1U;
-  static constexpr std::size_t CT_VEC_INNER_PROD_NBUCKET = 1U;
-};
+/// Report the table sizes of a package configuration
+void toJson(const dd::DDPackageConfig& config, nlohmann::json& j);
 } // namespace ec
@@ -13,9 +13,14 @@
 #include "DDEquivalenceChecker.hpp"
 #include "EquivalenceCriterion.hpp"
 #include "checker/dd/TaskManager.hpp"
+#include "checker/dd/simulation/StateType.hpp"
 #include "dd/Node.hpp"
 
+#include <cstddef>
 #include <nlohmann/json_fwd.hpp>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace qc {
 class QuantumComputation;
@@ -33,6 +38,55 @@ public:
 
   void setRandomInitialState(StateGenerator& generator);
 
+  /**
+   * @brief Set up a batch of random stimuli for the next run.
+   * @details If more than one stimulus is requested, the next run propagates
+   * all of them through both circuits in lockstep. Each gate DD is then only
+   * constructed once per circuit for the whole batch and all states share the
+   * unique and compute tables of the package. Once a stimulus shows
+   * non-equivalence, it (and the corresponding output states) is reported via
+   * `getInitialState`, `getInternalState1`, and `getInternalState2`.
+   * @param generator The generator used for the stimuli
+   * @param count The number of stimuli
+   */
+  void setRandomInitialStates(StateGenerator& generator, std::size_t count);
+
+  /**
+   * @brief Set up the stimuli with indices `first, ..., first + count - 1`.
+   * @details The stimuli only depend on the seed of the generator and their
+   * indices (see `StateGenerator::generateState`). Hence, checkers running in
+   * parallel can share a single generator without any synchronization as
+   * long as they use disjoint ranges of indices.
+   * @param generator The generator used for the stimuli
+   * @param first The index of the first stimulus
+   * @param count The number of stimuli
+   * @param type The type of stimuli
+   */
+  void setInitialStates(const StateGenerator& generator, std::size_t first,
+                        std::size_t count, StateType type);
+
+  /// Returns the index of the stimulus that showed non-equivalence in the last
+  /// run (if its stimuli have been set up by index)
+  [[nodiscard]] std::optional<std::size_t>
+  getCounterexampleStimulus() const noexcept {
+    if (!firstStimulus || equivalence != EquivalenceCriterion::NotEquivalent) {
+      return std::nullopt;
+    }
+    return *firstStimulus + counterexampleOffset;
+  }
+
+  /// Returns the type of the stimuli of the (next) run
+  [[nodiscard]] StateType getStimulusType() const noexcept {
+    return stimulusType;
+  }
+
+  /// Returns the number of stimuli considered in the (next) run
+  [[nodiscard]] std::size_t getNumStimuli() const noexcept {
+    return numStimuli;
+  }
+
+  EquivalenceCriterion run() override;
+
   /// Returns the initial state used for simulation
   [[nodiscard]] auto getInitialState() const -> const auto& {
     return initialState;
@@ -49,11 +103,38 @@ public:
 
   void json(nlohmann::basic_json<>& j) const noexcept override;
 
+  [[nodiscard]] std::string_view getName() const noexcept override {
+    return "decision_diagram_simulation";
+  }
+
+  /// Returns the number of runs the checker has completed
+  [[nodiscard]] std::size_t getNumRuns() const noexcept { return runs; }
+
 private:
   // the initial state used for simulation. defaults to the all-zero state
   // |0...0>
   dd::VectorDD initialState{};
 
+  // the batch of initial states used in a batched run
+  std::vector<dd::VectorDD> initialStates;
+  std::size_t numStimuli = 1U;
+  // the index of the first stimulus (only known for indexed stimuli) and the
+  // position of the counterexample within the batch
+  std::optional<std::size_t> firstStimulus;
+  std::size_t counterexampleOffset = 0U;
+  StateType stimulusType = StateType::ComputationalBasis;
+
+  // latencies of the completed runs. The checker (and with it, its package)
+  // is reused across runs, so later runs should be faster than the first.
+  std::size_t runs = 0U;
+  double firstRunTime = 0.;
+  double totalRunTime = 0.;
+  double minRunTime = 0.;
+  double maxRunTime = 0.;
+
+  // propagate all states of the batch through both circuits
+  EquivalenceCriterion runBatch();
+
   void initializeTask(TaskManager<dd::VectorDD>& taskManager) override;
   EquivalenceCriterion checkEquivalence() override;
 };
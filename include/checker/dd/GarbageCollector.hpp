@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "MemoryUsage.hpp"
+#include "dd/Package.hpp"
+#include "dd/statistics/PackageStatistics.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <utility>
+
+namespace ec {
+/**
+ * @brief Decides when garbage collection is triggered in a DD package.
+ * @details Instead of invoking the garbage collection of the package after each
+ * gate, the collector only does so every `interval` gates (where `0` disables
+ * periodic collection). Additionally, whenever the resident set size of the
+ * process exceeds `memoryThreshold` bytes (if non-zero), a collection is
+ * forced. The collector keeps track of how often and how long it ran.
+ *
+ * Optionally, the collector enforces memory limits on the package and on the
+ * process. If a limit is still exceeded after a forced collection, the
+ * registered callback is invoked so that the check can be aborted.
+ */
+class GarbageCollector {
+public:
+  explicit GarbageCollector(dd::Package& dd, const std::size_t gcInterval = 1U,
+                            const std::size_t gcMemoryThreshold = 0U) noexcept
+      : package(&dd), interval(gcInterval), memoryThreshold(gcMemoryThreshold) {
+  }
+
+  /**
+   * @brief Enforce memory limits during the check.
+   * @param packageBytes Limit on the memory of the nodes in the package
+   * @param processBytes Limit on the resident set size of the process
+   * @param onExceeded Callback invoked once a limit is exceeded
+   * @note A limit of `0` means that no limit is enforced.
+   */
+  void setMemoryLimits(const std::size_t packageBytes,
+                       const std::size_t processBytes,
+                       std::function<void()> onExceeded) {
+    packageLimit = packageBytes;
+    processLimit = processBytes;
+    onLimitExceeded = std::move(onExceeded);
+  }
+
+  /// Notify the collector that a gate has been applied
+  void step() {
+    ++steps;
+    bool force = false;
+    if (steps % MEMORY_CHECK_INTERVAL == 0U) {
+      force = underMemoryPressure();
+    }
+    if (force || (interval > 0U && steps % interval == 0U)) {
+      collect(force);
+    }
+    if (force && !limitExceeded && exceedsLimit()) {
+      limitExceeded = true;
+      if (onLimitExceeded) {
+        onLimitExceeded();
+      }
+    }
+  }
+
+  /// Run the garbage collection of the package
+  void collect(const bool force = false) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto collected = package->garbageCollect(force);
+    const auto end = std::chrono::steady_clock::now();
+    time += std::chrono::duration<double>(end - start).count();
+    ++invocations;
+    if (collected) {
+      ++collections;
+    }
+    if (force) {
+      ++forcedCollections;
+    }
+  }
+
+  [[nodiscard]] std::size_t getInvocations() const noexcept {
+    return invocations;
+  }
+  [[nodiscard]] std::size_t getCollections() const noexcept {
+    return collections;
+  }
+  [[nodiscard]] double getTime() const noexcept { return time; }
+  [[nodiscard]] bool memoryLimitExceeded() const noexcept {
+    return limitExceeded;
+  }
+
+  /// Memory (in bytes) occupied by the nodes currently alive in the package
+  [[nodiscard]] std::size_t packageMemory() const {
+    return static_cast<std::size_t>(dd::computeActiveMemoryMiB(*package) *
+                                    static_cast<double>(MIB));
+  }
+  /// Peak memory (in bytes) occupied by nodes of the package
+  [[nodiscard]] std::size_t peakPackageMemory() const {
+    return static_cast<std::size_t>(dd::computePeakMemoryMiB(*package) *
+                                    static_cast<double>(MIB));
+  }
+
+  void json(nlohmann::json& j) const {
+    j["interval"] = interval;
+    j["memory_threshold"] = memoryThreshold;
+    j["invocations"] = invocations;
+    j["collections"] = collections;
+    j["forced_collections"] = forcedCollections;
+    j["time"] = time;
+  }
+
+  void memoryJson(nlohmann::json& j) const {
+    j["package_limit"] = packageLimit;
+    j["process_limit"] = processLimit;
+    j["limit_exceeded"] = limitExceeded;
+    j["peak_package_memory"] = peakPackageMemory();
+  }
+
+private:
+  // how often (in gates) the memory consumption is checked
+  static constexpr std::size_t MEMORY_CHECK_INTERVAL = 64U;
+  static constexpr std::size_t MIB = 1U << 20U;
+
+  dd::Package* package;
+  std::size_t interval;
+  std::size_t memoryThreshold;
+
+  std::size_t packageLimit = 0U;
+  std::size_t processLimit = 0U;
+  std::function<void()> onLimitExceeded;
+  bool limitExceeded = false;
+
+  std::size_t steps = 0U;
+  std::size_t invocations = 0U;
+  std::size_t collections = 0U;
+  std::size_t forcedCollections = 0U;
+  double time = 0.;
+
+  // whether any threshold or limit is exceeded
+  [[nodiscard]] bool underMemoryPressure() const {
+    if (packageLimit > 0U && packageMemory() > packageLimit) {
+      return true;
+    }
+    if (memoryThreshold == 0U && processLimit == 0U) {
+      return false;
+    }
+    const auto rss = getCurrentRSS();
+    return (memoryThreshold > 0U && rss > memoryThreshold) ||
+           (processLimit > 0U && rss > processLimit);
+  }
+
+  // whether any limit is exceeded
+  [[nodiscard]] bool exceedsLimit() const {
+    return (packageLimit > 0U && packageMemory() > packageLimit) ||
+           (processLimit > 0U && getCurrentRSS() > processLimit);
+  }
+};
+} // namespace ec
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace ec {
+/**
+ * @brief Memoizes the decision diagrams of gates within a single DD package.
+ * @details Compiled circuits frequently consist of many repetitions of the
+ * same few gates acting on the same qubits. Instead of rebuilding the DD of
+ * each of these gates whenever it is applied, the DD is constructed once and
+ * looked up afterwards. Gates are identified by their type, parameters, and
+ * the qubits they act on (before and after applying the current permutation).
+ * Cached DDs are kept alive by holding a reference on them, so a cache must
+ * not outlive its package. Once the cache is full, the least recently used
+ * DD is released to make room for a new one. Only standard operations acting
+ * on at most `MAX_QUBITS` qubits are cached.
+ */
+class GateDDCache {
+public:
+  static constexpr std::size_t DEFAULT_CAPACITY = 4096U;
+  static constexpr std::size_t MAX_QUBITS = 8U;
+  static constexpr std::size_t MAX_PARAMETERS = 3U;
+
+  explicit GateDDCache(dd::Package& dd,
+                       const std::size_t capacity = DEFAULT_CAPACITY)
+      : package(&dd), maxEntries(capacity) {}
+
+  GateDDCache(const GateDDCache&) = delete;
+  GateDDCache& operator=(const GateDDCache&) = delete;
+  GateDDCache(GateDDCache&&) = default;
+  GateDDCache& operator=(GateDDCache&&) = default;
+  ~GateDDCache() = default;
+
+  /**
+   * @brief Get the DD of an operation (or its inverse) from the cache.
+   * @param op The operation
+   * @param permutation The current permutation of the qubits
+   * @param inverse Whether the inverse of the operation is requested
+   * @param build Callable constructing the DD in case of a cache miss
+   * @return The (cached) DD of the operation
+   */
+  template <class Builder>
+  dd::MatrixDD get(const qc::Operation& op, const qc::Permutation& permutation,
+                   const bool inverse, Builder&& build) {
+    Key key{};
+    if (!op.isStandardOperation() ||
+        !makeKey(static_cast<const qc::StandardOperation&>(op), permutation,
+                 inverse, key)) {
+      ++misses;
+      return build();
+    }
+    if (const auto it = index.find(key); it != index.end()) {
+      ++hits;
+      // move the entry to the front of the recency list
+      entries.splice(entries.begin(), entries, it->second);
+      return it->second->second;
+    }
+    ++misses;
+    const auto e = build();
+    if (maxEntries == 0U) {
+      return e;
+    }
+    if (entries.size() >= maxEntries) {
+      // evict the least recently used entry
+      auto& [oldKey, oldDD] = entries.back();
+      package->decRef(oldDD);
+      index.erase(oldKey);
+      entries.pop_back();
+      ++evictions;
+    }
+    package->incRef(e);
+    entries.emplace_front(key, e);
+    index.emplace(key, entries.begin());
+    return e;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return entries.size(); }
+  [[nodiscard]] std::size_t getHits() const noexcept { return hits; }
+  [[nodiscard]] std::size_t getMisses() const noexcept { return misses; }
+  [[nodiscard]] std::size_t getEvictions() const noexcept {
+    return evictions;
+  }
+
+  /// Release all cached DDs
+  void clear() {
+    for (auto& [key, e] : entries) {
+      package->decRef(e);
+    }
+    index.clear();
+    entries.clear();
+  }
+
+private:
+  // fixed-size key, so that looking up a gate does not allocate. The header
+  // packs the type, the inverse flag, the number of targets and controls, and
+  // the polarity of the controls. Each qubit word holds the qubit and its
+  // permuted counterpart. Unused words are zero.
+  struct Key {
+    std::uint64_t header = 0U;
+    std::array<std::uint64_t, MAX_QUBITS> qubits{};
+    std::array<std::uint64_t, MAX_PARAMETERS> parameters{};
+
+    bool operator==(const Key& other) const noexcept = default;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const noexcept {
+      // FNV-1a style combination of all words of the key
+      std::uint64_t h = 14'695'981'039'346'656'037ULL;
+      const auto combine = [&h](const std::uint64_t word) {
+        h ^= word;
+        h *= 1'099'511'628'211ULL;
+      };
+      combine(key.header);
+      for (const auto word : key.qubits) {
+        combine(word);
+      }
+      for (const auto word : key.parameters) {
+        combine(word);
+      }
+      return static_cast<std::size_t>(h ^ (h >> 32U));
+    }
+  };
+
+  using Entries = std::list<std::pair<Key, dd::MatrixDD>>;
+
+  dd::Package* package;
+  std::size_t maxEntries;
+  // cached DDs ordered from the most to the least recently used one
+  Entries entries;
+  std::unordered_map<Key, Entries::iterator, KeyHash> index;
+  std::size_t hits = 0U;
+  std::size_t misses = 0U;
+  std::size_t evictions = 0U;
+
+  static std::uint64_t qubitWord(const qc::Permutation& permutation,
+                                 const qc::Qubit q) {
+    auto mapped = std::numeric_limits<std::uint32_t>::max();
+    if (const auto it = permutation.find(q); it != permutation.end()) {
+      mapped = static_cast<std::uint32_t>(it->second);
+    }
+    return (static_cast<std::uint64_t>(q) << 32U) | mapped;
+  }
+
+  /// Fill in the key of the operation (unless it acts on too many qubits or
+  /// has too many parameters to be cached)
+  static bool makeKey(const qc::StandardOperation& op,
+                      const qc::Permutation& permutation, const bool inverse,
+                      Key& key) {
+    const auto& targets = op.getTargets();
+    const auto& controls = op.getControls();
+    const auto& parameters = op.getParameter();
+    if (targets.size() + controls.size() > MAX_QUBITS ||
+        parameters.size() > MAX_PARAMETERS) {
+      return false;
+    }
+    std::uint64_t polarity = 0U;
+    std::size_t i = 0U;
+    for (const auto t : targets) {
+      key.qubits[i++] = qubitWord(permutation, t);
+    }
+    for (const auto& c : controls) {
+      if (c.type == qc::Control::Type::Pos) {
+        polarity |= 1ULL << i;
+      }
+      key.qubits[i++] = qubitWord(permutation, c.qubit);
+    }
+    for (std::size_t j = 0U; j < parameters.size(); ++j) {
+      key.parameters[j] = std::bit_cast<std::uint64_t>(parameters[j]);
+    }
+    key.header = static_cast<std::uint64_t>(op.getType()) |
+                 (static_cast<std::uint64_t>(inverse) << 8U) |
+                 (static_cast<std::uint64_t>(targets.size()) << 16U) |
+                 (static_cast<std::uint64_t>(controls.size()) << 24U) |
+                 (polarity << 32U);
+    return true;
+  }
+};
+} // namespace ec
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "checker/dd/GarbageCollector.hpp"
+#include "checker/dd/GateDDCache.hpp"
 #include "dd/DDpackageConfig.hpp"
 #include "dd/Node.hpp"
 #include "dd/Operations.hpp"
@@ -18,10 +20,13 @@
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/Operation.hpp"
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ec {
 enum class Direction : bool { Left = true, Right = false };
@@ -38,11 +43,43 @@ public:
 
   void reset() noexcept {
     iterator = qc->begin();
+    position = 0U;
     permutation = qc->initialLayout;
+    if (progressCounter != nullptr) {
+      progressCounter->store(0U, std::memory_order_relaxed);
+    }
   }
 
   [[nodiscard]] bool finished() const noexcept { return iterator == end; }
 
+  /// Continue at the given operation with the given (tracked) permutation,
+  /// e.g., when resuming from a checkpoint
+  void seek(const std::size_t target, const qc::Permutation& perm) {
+    assert(target <= qc->getNops());
+    iterator = qc->begin() + static_cast<std::ptrdiff_t>(target);
+    position = target;
+    permutation = perm;
+    if (progressCounter != nullptr) {
+      progressCounter->store(position, std::memory_order_relaxed);
+    }
+  }
+
+  /// Register a flag that is polled before each gate application and before
+  /// each garbage collection. Once the flag is set, `advance` and `finish`
+  /// return early, which bounds the latency of a cancellation request by the
+  /// cost of a single gate. The application of a gate itself (e.g., a
+  /// multiplication with a very large DD) is not interrupted.
+  void setStopFlag(const std::atomic<bool>* flag) noexcept { stopFlag = flag; }
+  [[nodiscard]] bool stopRequested() const noexcept {
+    return stopFlag != nullptr && stopFlag->load(std::memory_order_relaxed);
+  }
+
+  /// Register a counter that mirrors the position in the circuit, such that
+  /// the progress can be observed from other threads
+  void setProgressCounter(std::atomic<std::size_t>* counter) noexcept {
+    progressCounter = counter;
+  }
+
   const std::unique_ptr<qc::Operation>& operator()() const { return *iterator; }
 
   [[nodiscard]] const DDType& getInternalState() const noexcept {
@@ -57,10 +94,31 @@ public:
     }
   }
 
+  /// Use the given cache for looking up gate DDs. The cache has to belong to
+  /// the same package and may be shared with other task managers.
+  void setGateCache(GateDDCache* cache) noexcept { gateCache = cache; }
+
+  /// Use the given collector to decide when to collect garbage after a gate
+  /// has been applied. Without a collector, garbage is collected after each
+  /// gate.
+  void setGarbageCollector(GarbageCollector* collector) noexcept {
+    garbageCollector = collector;
+  }
+
   [[nodiscard]] dd::MatrixDD getDD() {
+    if (gateCache != nullptr) {
+      return gateCache->get(**iterator, permutation, false, [this] {
+        return dd::getDD(**iterator, *package, permutation);
+      });
+    }
     return dd::getDD(**iterator, *package, permutation);
   }
   [[nodiscard]] dd::MatrixDD getInverseDD() {
+    if (gateCache != nullptr) {
+      return gateCache->get(**iterator, permutation, true, [this] {
+        return dd::getInverseDD(**iterator, *package, permutation);
+      });
+    }
     return dd::getInverseDD(**iterator, *package, permutation);
   }
 
@@ -68,11 +126,68 @@ public:
     return qc;
   }
 
+  /// The permutation tracked up to the current operation
+  [[nodiscard]] const qc::Permutation& getPermutation() const noexcept {
+    return permutation;
+  }
+
   qc::QuantumComputation::const_iterator getIterator() const {
     return iterator;
   }
 
-  void advanceIterator() { ++iterator; }
+  /// Index of the current operation in the circuit
+  [[nodiscard]] std::size_t getPosition() const noexcept { return position; }
+  /// Number of operations that have not been applied yet
+  [[nodiscard]] std::size_t getRemaining() const noexcept {
+    return qc->getNops() - position;
+  }
+
+  /// Precompute the number of qubits used by each operation of the circuit so
+  /// that `getUsedQubitCount` does not need to construct the set of qubits
+  void computeUsedQubitCounts() {
+    if (usedQubitCounts.size() == qc->getNops()) {
+      return;
+    }
+    usedQubitCounts.clear();
+    usedQubitCounts.reserve(qc->getNops());
+    for (const auto& op : *qc) {
+      usedQubitCounts.emplace_back(op->getUsedQubits().size());
+    }
+  }
+  /// Number of qubits used by the current operation (requires
+  /// `computeUsedQubitCounts` to have been called)
+  [[nodiscard]] std::size_t getUsedQubitCount() const {
+    assert(position < usedQubitCounts.size());
+    return usedQubitCounts[position];
+  }
+
+  /// Precompute the prefix sums of the costs of the operations of the circuit,
+  /// i.e., the i-th entry is the total cost of the first i operations
+  template <class CostFun> void computeCostPrefixSums(CostFun&& cost) {
+    costPrefixSums.clear();
+    costPrefixSums.reserve(qc->getNops() + 1U);
+    costPrefixSums.emplace_back(0U);
+    for (const auto& op : *qc) {
+      costPrefixSums.emplace_back(costPrefixSums.back() + cost(*op));
+    }
+  }
+  [[nodiscard]] const std::vector<std::size_t>&
+  getCostPrefixSums() const noexcept {
+    return costPrefixSums;
+  }
+  /// Cost of the current operation (requires `computeCostPrefixSums` to have
+  /// been called)
+  [[nodiscard]] std::size_t getCurrentCost() const {
+    assert(position + 1U < costPrefixSums.size());
+    return costPrefixSums[position + 1U] - costPrefixSums[position];
+  }
+  /// Total cost of the operations that have not been applied yet
+  [[nodiscard]] std::size_t getRemainingCost() const {
+    assert(position < costPrefixSums.size());
+    return costPrefixSums.back() - costPrefixSums[position];
+  }
+
+  void advanceIterator() { step(); }
 
   void applyGate(DDType& to) {
     auto saved = to;
@@ -88,24 +203,55 @@ public:
     }
     package->incRef(to);
     package->decRef(saved);
-    package->garbageCollect();
-    ++iterator;
+    collectGarbage();
+    step();
+  }
+
+  /// Apply the current gate to each of the given states. The DD of the gate is
+  /// only constructed once for the whole batch.
+  void applyGate(std::vector<DDType>& states) {
+    const bool left = std::is_same_v<DDType, dd::VectorDD> ||
+                      direction == Direction::Left;
+    const auto gate = left ? getDD() : getInverseDD();
+    for (auto& to : states) {
+      auto saved = to;
+      if (left) {
+        to = package->multiply(gate, to);
+      } else {
+        if constexpr (std::is_same_v<DDType, dd::MatrixDD>) {
+          to = package->multiply(to, gate);
+        }
+      }
+      package->incRef(to);
+      package->decRef(saved);
+    }
+    collectGarbage();
+    step();
+  }
+
+  /// Track the current operation in the permutation if it is a SWAP
+  bool applySwapOperation() {
+    if (finished() || (*iterator)->getType() != qc::SWAP ||
+        (*iterator)->isControlled()) {
+      return false;
+    }
+    const auto& targets = (*iterator)->getTargets();
+    assert(targets.size() == 2);
+    const auto t1 = targets[0];
+    const auto t2 = targets[1];
+    std::swap(permutation.at(t1), permutation.at(t2));
+    step();
+    return true;
   }
 
   void applySwapOperations() {
-    while (!finished() && (*iterator)->getType() == qc::SWAP &&
-           !(*iterator)->isControlled()) {
-      const auto& targets = (*iterator)->getTargets();
-      assert(targets.size() == 2);
-      const auto t1 = targets[0];
-      const auto t2 = targets[1];
-      std::swap(permutation.at(t1), permutation.at(t2));
-      ++iterator;
+    while (applySwapOperation()) {
     }
   }
 
   void advance(DDType& state, const std::size_t steps) {
-    for (std::size_t i = 0U; i < steps && !finished(); ++i) {
+    for (std::size_t i = 0U; i < steps && !finished() && !stopRequested();
+         ++i) {
       applyGate(state);
       applySwapOperations();
     }
@@ -115,12 +261,21 @@ public:
   void advance() { advance(1U); }
 
   void finish(DDType& state) {
-    while (!finished()) {
+    while (!finished() && !stopRequested()) {
       advance(state);
     }
   }
   void finish() { finish(internalState); }
 
+  /// Apply all remaining gates to each of the given states in lockstep
+  void finish(std::vector<DDType>& states) {
+    applySwapOperations();
+    while (!finished() && !stopRequested()) {
+      applyGate(states);
+      applySwapOperations();
+    }
+  }
+
   void changePermutation(DDType& state) {
     dd::changePermutation(state, permutation, qc->outputPermutation, *package,
                           static_cast<bool>(direction));
@@ -156,12 +311,40 @@ public:
   void decRef() { decRef(internalState); }
 
 private:
+  void step() {
+    ++iterator;
+    ++position;
+    if (progressCounter != nullptr) {
+      progressCounter->store(position, std::memory_order_relaxed);
+    }
+  }
+
+  void collectGarbage() {
+    // a collection after the gate that has been applied despite a pending
+    // stop request would only delay the return further
+    if (stopRequested()) {
+      return;
+    }
+    if (garbageCollector != nullptr) {
+      garbageCollector->step();
+    } else {
+      package->garbageCollect();
+    }
+  }
+
   const qc::QuantumComputation* qc{};
   dd::Package* package;
   Direction direction = Direction::Left;
   qc::Permutation permutation{};
   decltype(qc->begin()) iterator;
   decltype(qc->end()) end;
+  std::size_t position = 0U;
+  std::vector<std::size_t> usedQubitCounts;
+  std::vector<std::size_t> costPrefixSums;
   DDType internalState{};
+  const std::atomic<bool>* stopFlag{};
+  std::atomic<std::size_t>* progressCounter{};
+  GateDDCache* gateCache{};
+  GarbageCollector* garbageCollector{};
 };
 } // namespace ec
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ApplicationScheme.hpp"
+#include "checker/dd/TaskManager.hpp"
+#include "dd/Node.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <utility>
+#include <vector>
+
+namespace ec {
+/**
+ * @brief An application scheme that adapts to the size of the alternating DD.
+ * @details After each step, the scheme observes the number of nodes of the
+ * internal state. As long as it is as small as the identity it started from,
+ * the gates of both circuits are applied in proportion to the size of the
+ * circuits. Once the DD grows, the scheme switches to the other circuit,
+ * whose gates should cancel the ones that caused the growth, and keeps
+ * applying gates from that circuit as long as the DD does not grow any
+ * further. To avoid running far ahead in one of the circuits, the relative
+ * progress in both circuits never differs by more than `MAX_LEAD`.
+ */
+class AdaptiveApplicationScheme final : public ApplicationScheme<dd::MatrixDD> {
+public:
+  /// The maximal difference in relative progress between both circuits
+  static constexpr double MAX_LEAD = 0.1;
+  /// The maximal number of decisions recorded
+  static constexpr std::size_t MAX_DECISIONS = 1024U;
+
+  AdaptiveApplicationScheme(TaskManager<dd::MatrixDD>& tm1,
+                            TaskManager<dd::MatrixDD>& tm2) noexcept;
+
+  void setInternalState(dd::MatrixDD& state) noexcept;
+
+  std::pair<size_t, size_t> operator()() override;
+
+  void json(nlohmann::json& j) const;
+
+private:
+  enum class Side : std::uint8_t { None, First, Second };
+
+  // the reason for choosing a side: the DD is as small as initially, it has
+  // grown during the last step, it has not grown, or one circuit is too far
+  // ahead of the other
+  enum class Reason : std::uint8_t { Balanced, Grown, Stable, Lead };
+
+  struct Decision {
+    std::size_t position1;
+    std::size_t position2;
+    std::size_t nodes;
+    Side side;
+    Reason reason;
+  };
+
+  dd::MatrixDD* internalState{};
+
+  Side lastSide = Side::None;
+  std::size_t lastSize = 0U;
+  // the size of the internal state before any gate has been applied
+  std::size_t baseline = 0U;
+  std::size_t peak = 0U;
+
+  std::size_t steps1 = 0U;
+  std::size_t steps2 = 0U;
+  std::size_t switches = 0U;
+  std::size_t corrections = 0U;
+  // decisions are only recorded whenever the side changes
+  std::vector<Decision> decisions;
+
+  [[nodiscard]] Side choose(std::size_t size, Reason& reason) const;
+  void record(Side side, Reason reason, std::size_t size);
+};
+} // namespace ec
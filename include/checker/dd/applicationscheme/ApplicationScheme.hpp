@@ -25,7 +25,8 @@ enum class ApplicationSchemeType : std::uint8_t {
   OneToOne = 1,
   Lookahead = 2,
   GateCost = 3,
-  Proportional = 4
+  Proportional = 4,
+  Adaptive = 5
 };
 
 inline std::string
@@ -39,6 +40,8 @@ toString(const ApplicationSchemeType& applicationScheme) noexcept {
     return "lookahead";
   case ApplicationSchemeType::GateCost:
     return "gate_cost";
+  case ApplicationSchemeType::Adaptive:
+    return "adaptive";
   default:
     return "proportional";
   }
@@ -64,6 +67,9 @@ applicationSchemeFromString(const std::string& applicationScheme) noexcept {
   if ((applicationScheme == "proportional") || (applicationScheme == "4")) {
     return ApplicationSchemeType::Proportional;
   }
+  if ((applicationScheme == "adaptive") || (applicationScheme == "5")) {
+    return ApplicationSchemeType::Adaptive;
+  }
   std::cerr << "Unknown application scheme: " << applicationScheme
             << ". Defaulting to proportional!\n";
   return ApplicationSchemeType::Proportional;
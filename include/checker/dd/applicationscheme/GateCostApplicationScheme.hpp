@@ -11,36 +11,19 @@
 #pragma once
 
 #include "ApplicationScheme.hpp"
+#include "GateCostProfile.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "ir/QuantumComputation.hpp"
-#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
 
+#include <algorithm>
 #include <cstddef>
-#include <fstream>
-#include <functional>
-#include <istream>
-#include <sstream>
-#include <stdexcept>
+#include <iterator>
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
-template <> struct std::hash<std::pair<qc::OpType, std::size_t>> {
-  std::size_t
-  operator()(pair<qc::OpType, std::size_t> const& key) const noexcept {
-    const std::size_t h1 = hash<decltype(key.first)>{}(key.first);
-    const std::size_t h2 = hash<decltype(key.second)>{}(key.second);
-    return h1 ^ (h2 << 1);
-  }
-}; // namespace std
-
 namespace ec {
-using GateCostLookupTableKeyType = std::pair<qc::OpType, std::size_t>;
-using GateCostLookupTable =
-    std::unordered_map<GateCostLookupTableKeyType, std::size_t>;
-using CostFunction =
-    std::function<std::size_t(const GateCostLookupTableKeyType&)>;
-
 template <class DDType>
 class GateCostApplicationScheme final : public ApplicationScheme<DDType> {
 public:
@@ -49,83 +32,100 @@ public:
                             const bool singleQubitGateFusion)
       : ApplicationScheme<DDType>(tm1, tm2),
         singleQubitGateFusionEnabled(singleQubitGateFusion) {
-    populateLookupTable(costFunction, tm1.getCircuit());
-    populateLookupTable(costFunction, tm2.getCircuit());
+    GateCostLookupTable table{};
+    populateLookupTable(table, costFunction, tm1.getCircuit());
+    populateLookupTable(table, costFunction, tm2.getCircuit());
+    profile = std::make_shared<const GateCostProfile>(table);
+    precompute(tm1);
   }
 
   GateCostApplicationScheme(TaskManager<DDType>& tm1, TaskManager<DDType>& tm2,
                             const std::string& filename,
                             const bool singleQubitGateFusion)
       : ApplicationScheme<DDType>(tm1, tm2),
+        profile(GateCostProfile::load(filename)),
+        singleQubitGateFusionEnabled(singleQubitGateFusion) {
+    precompute(tm1);
+  }
+
+  /// Use a profile that has already been loaded (and may be shared)
+  GateCostApplicationScheme(TaskManager<DDType>& tm1, TaskManager<DDType>& tm2,
+                            std::shared_ptr<const GateCostProfile> gateCosts,
+                            const bool singleQubitGateFusion)
+      : ApplicationScheme<DDType>(tm1, tm2), profile(std::move(gateCosts)),
         singleQubitGateFusionEnabled(singleQubitGateFusion) {
-    populateLookupTable(filename);
+    precompute(tm1);
   }
 
   std::pair<size_t, size_t> operator()() override {
-    if (gateCostLookupTable.empty()) {
+    if (profile->empty()) {
       return {1U, 1U};
     }
 
-    const auto& op = (*this->taskManager1)();
-    if (singleQubitGateFusionEnabled && op->getUsedQubits().size() == 1U) {
+    const auto& prefixSums = this->taskManager1->getCostPrefixSums();
+    const auto position = this->taskManager1->getPosition();
+    if (singleQubitGateFusionEnabled &&
+        this->taskManager1->getUsedQubitCount() == 1U) {
       // when single qubit gates are fused, any single-qubit gate should have a
       // single (compound) gate in the other circuit as a counterpart.
       return {1U, 1U};
     }
 
-    const auto key =
-        GateCostLookupTableKeyType{op->getType(), op->getNcontrols()};
-    std::size_t cost = 1U;
-    if (const auto it = gateCostLookupTable.find(key);
-        it != gateCostLookupTable.end()) {
-      cost = it->second;
+    // circuit 2 is scheduled such that the gates of circuit 1 up to (and
+    // including) the current one are matched by as many gates as they cost.
+    // Gates without cost are matched together with the next gate that has a
+    // cost, whose position is determined by a binary search. The schedule only
+    // depends on the position in circuit 1, so that it is not affected by
+    // gates skipped outside of the scheme or by resuming from a checkpoint.
+    const auto scheduled = prefixSums[position];
+    const auto next = std::upper_bound(
+        prefixSums.begin() + static_cast<std::ptrdiff_t>(position) + 1,
+        prefixSums.end(), scheduled);
+    if (next == prefixSums.end()) {
+      // only gates without cost are left
+      return {prefixSums.size() - 1U - position, 0U};
     }
-    return {1U, cost};
+    const auto gates =
+        static_cast<std::size_t>(std::distance(prefixSums.begin(), next)) -
+        position;
+    return {gates, *next - scheduled};
+  }
+
+  /// The cost of an operation according to the profile
+  [[nodiscard]] std::size_t getCost(const qc::Operation& op) const {
+    return profile->cost(op.getType(), op.getNcontrols());
   }
 
+  [[nodiscard]] const auto& getProfile() const noexcept { return profile; }
+
 private:
-  GateCostLookupTable gateCostLookupTable;
+  std::shared_ptr<const GateCostProfile> profile;
   bool singleQubitGateFusionEnabled;
 
+  // resolve the costs of the operations of the first circuit once, so that no
+  // lookups are necessary while the check is running
+  void precompute(TaskManager<DDType>& tm) {
+    if (profile->empty()) {
+      return;
+    }
+    tm.computeCostPrefixSums(
+        [this](const qc::Operation& op) { return getCost(op); });
+    if (singleQubitGateFusionEnabled) {
+      tm.computeUsedQubitCounts();
+    }
+  }
+
   template <class CostFun>
-  void populateLookupTable(CostFun costFunction,
-                           const qc::QuantumComputation* qc) {
+  static void populateLookupTable(GateCostLookupTable& table,
+                                  CostFun costFunction,
+                                  const qc::QuantumComputation* qc) {
     for (const auto& op : *qc) {
       const auto type = op->getType();
       const auto nControls = op->getNcontrols();
       const auto key = GateCostLookupTableKeyType{type, nControls};
-      if (const auto it = gateCostLookupTable.find(key);
-          it == gateCostLookupTable.end()) {
+      if (const auto it = table.find(key); it == table.end()) {
         const auto cost = costFunction(key);
-        gateCostLookupTable.emplace(key, cost);
-      }
-    }
-  }
-
-  // read gate cost LUT from file
-  // simple file format:
-  // each line consists of
-  // <identifier> <controls> <cost>
-  void populateLookupTable(const std::string& filename) {
-    std::ifstream ifs(filename);
-    if (!ifs.good()) {
-      throw std::invalid_argument("Error opening LUT file: " + filename);
-    }
-    populateLookupTable(ifs);
-  }
-  void populateLookupTable(std::istream& is) {
-    qc::OpType opType = qc::OpType::None;
-    std::size_t nControls = 0U;
-    std::size_t cost = 1U;
-
-    std::string line;
-    while (std::getline(is, line)) {
-      if (line.empty() || line[0] == '#') {
-        continue;
-      }
-      std::istringstream iss(line);
-      if (iss >> opType >> nControls >> cost) {
-        gateCostLookupTable.emplace(std::pair{opType, nControls}, cost);
+        table.emplace(key, cost);
       }
     }
   }
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/operations/OpType.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template <> struct std::hash<std::pair<qc::OpType, std::size_t>> {
+  std::size_t
+  operator()(pair<qc::OpType, std::size_t> const& key) const noexcept {
+    const std::size_t h1 = hash<decltype(key.first)>{}(key.first);
+    const std::size_t h2 = hash<decltype(key.second)>{}(key.second);
+    return h1 ^ (h2 << 1);
+  }
+}; // namespace std
+
+namespace ec {
+using GateCostLookupTableKeyType = std::pair<qc::OpType, std::size_t>;
+using GateCostLookupTable =
+    std::unordered_map<GateCostLookupTableKeyType, std::size_t>;
+using CostFunction =
+    std::function<std::size_t(const GateCostLookupTableKeyType&)>;
+
+/**
+ * @brief An immutable gate cost profile.
+ * @details The profile is stored as a dense table indexed by the gate type and
+ * the number of controls, such that the cost of a gate can be determined by a
+ * single array access. Gates that are not covered by the profile have a cost
+ * of 1.
+ *
+ * Profiles can either be read from the text format (each line consisting of
+ * `<identifier> <controls> <cost>`) or from a compiled binary format. The
+ * binary format directly contains the dense table and is memory-mapped
+ * whenever possible, so that it is shared read-only by all checkers and
+ * processes using the same profile.
+ */
+class GateCostProfile {
+public:
+  /// The number of gate types that can be represented
+  static constexpr std::size_t NUM_OP_TYPES =
+      static_cast<std::size_t>(
+          std::numeric_limits<std::underlying_type_t<qc::OpType>>::max()) +
+      1U;
+
+  /// Create a profile from explicitly given costs
+  explicit GateCostProfile(const GateCostLookupTable& table);
+
+  /// Parse a profile in the text format
+  explicit GateCostProfile(std::istream& is) : GateCostProfile(parse(is)) {}
+
+  /// Read the entries of a profile in the text format (the first entry of a
+  /// gate type and number of controls takes precedence)
+  [[nodiscard]] static GateCostLookupTable parse(std::istream& is);
+
+  GateCostProfile(const GateCostProfile&) = delete;
+  GateCostProfile& operator=(const GateCostProfile&) = delete;
+  GateCostProfile(GateCostProfile&&) = delete;
+  GateCostProfile& operator=(GateCostProfile&&) = delete;
+  ~GateCostProfile();
+
+  /**
+   * @brief Load a profile from a file.
+   * @details The format of the file is detected automatically. Compiled
+   * profiles are memory-mapped if the platform supports it.
+   * @param filename The path to the profile
+   * @return The loaded profile
+   * @throws std::invalid_argument if the file cannot be opened or is not a
+   * valid profile
+   */
+  [[nodiscard]] static std::shared_ptr<const GateCostProfile>
+  load(const std::string& filename);
+
+  /**
+   * @brief Convert a profile from the text format to the binary format.
+   * @param input The path to the profile in the text format
+   * @param output The path the compiled profile is written to
+   */
+  static void compile(const std::string& input, const std::string& output);
+
+  /// Write the profile in the binary format
+  void save(const std::string& filename) const;
+
+  /// The cost of a gate according to the profile
+  [[nodiscard]] std::size_t cost(const qc::OpType type,
+                                 const std::size_t nControls) const noexcept {
+    if (nControls > maxControls) {
+      return 1U;
+    }
+    return static_cast<std::size_t>(
+        costs[(static_cast<std::size_t>(type) * (maxControls + 1U)) +
+              nControls]);
+  }
+
+  /// The number of entries explicitly specified by the profile
+  [[nodiscard]] std::size_t size() const noexcept { return entries; }
+  [[nodiscard]] bool empty() const noexcept { return entries == 0U; }
+
+  /// The largest number of controls covered by the profile
+  [[nodiscard]] std::size_t getMaxControls() const noexcept {
+    return maxControls;
+  }
+
+  /// The file the profile has been loaded from (if any)
+  [[nodiscard]] const std::string& getSource() const noexcept {
+    return source;
+  }
+
+  /// Whether the profile is backed by a memory-mapped file
+  [[nodiscard]] bool isMapped() const noexcept { return mapping != nullptr; }
+
+private:
+  // the profile as long as it is not memory-mapped
+  std::vector<std::uint64_t> storage;
+  // the dense table (pointing into `storage` or into the mapped file)
+  const std::uint64_t* costs = nullptr;
+  std::size_t maxControls = 0U;
+  std::size_t entries = 0U;
+  std::string source;
+
+  // the mapped file (if any)
+  const void* mapping = nullptr;
+  std::size_t mappingSize = 0U;
+
+  GateCostProfile() = default;
+
+  void initialize(const GateCostLookupTable& table);
+};
+} // namespace ec
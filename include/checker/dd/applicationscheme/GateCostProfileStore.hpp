@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "GateCostProfile.hpp"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ec {
+
+/**
+ * @brief A gate cost profile whose costs are computed on demand.
+ * @details Costs that are not known yet are computed by the cost function of
+ * the store (once per process) and memoized. Stores are shared process-wide by
+ * all checkers using the same file, to which each newly computed cost is
+ * appended in the text format of gate cost profiles. Hence, the file can also
+ * be used as a regular profile, and when a store is opened, the costs that
+ * have been persisted to its file before are reused. This way, profiles never
+ * have to be generated up front. Since the cost function may call back into
+ * Python, the bindings clear all stores before the interpreter shuts down.
+ */
+class GateCostProfileStore {
+public:
+  GateCostProfileStore(const GateCostProfileStore&) = delete;
+  GateCostProfileStore& operator=(const GateCostProfileStore&) = delete;
+  GateCostProfileStore(GateCostProfileStore&&) = delete;
+  GateCostProfileStore& operator=(GateCostProfileStore&&) = delete;
+  ~GateCostProfileStore() = default;
+
+  /**
+   * @brief Open the process-wide store persisted to the given file.
+   * @details The store is created (reading the costs contained in the file, if
+   * it exists) upon the first request for the file. Later requests return the
+   * same store, which keeps using the cost function it has been created with.
+   * @param filename The path of the file the costs are persisted to
+   * @param costFunction The function computing the costs that are not known
+   * @return The store
+   */
+  [[nodiscard]] static std::shared_ptr<GateCostProfileStore>
+  open(const std::string& filename, CostFunction costFunction);
+
+  /// Forget all stores (their files are kept), such that they are read again
+  /// when they are opened the next time
+  static void clear();
+
+  /**
+   * @brief The cost of a gate.
+   * @details Unknown costs are computed by the cost function, memoized, and
+   * appended to the file of the store. Failing to write the file does not
+   * affect the memoized cost. The cost function is called without holding the
+   * lock of the store (e.g., it may have to wait for the GIL), while other
+   * requests for the same cost wait for its result.
+   */
+  [[nodiscard]] std::size_t cost(const GateCostLookupTableKeyType& key);
+
+  /// The number of known costs
+  [[nodiscard]] std::size_t size() const;
+
+  /// The number of costs that have been computed by the cost function
+  [[nodiscard]] std::size_t computed() const;
+
+  [[nodiscard]] const std::string& getFile() const noexcept { return file; }
+
+private:
+  GateCostProfileStore(std::string filename, CostFunction function);
+
+  std::string file;
+  CostFunction costFunction;
+
+  mutable std::mutex mutex;
+  GateCostLookupTable costs;
+  // the costs currently being computed
+  std::unordered_map<GateCostLookupTableKeyType,
+                     std::shared_future<std::size_t>>
+      pending;
+  std::size_t computedCosts = 0U;
+};
+} // namespace ec
@@ -11,12 +11,15 @@
 #pragma once
 
 #include "ApplicationScheme.hpp"
+#include "checker/dd/GarbageCollector.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 
 #include <cstddef>
+#include <nlohmann/json.hpp>
 #include <utility>
+#include <vector>
 
 namespace ec {
 class LookaheadApplicationScheme final
@@ -27,6 +30,19 @@ public:
 
   void setInternalState(dd::MatrixDD& state) noexcept;
   void setPackage(dd::Package* dd) noexcept;
+  void setGarbageCollector(GarbageCollector* collector) noexcept;
+
+  /**
+   * @brief Configure the cost model used to avoid unnecessary products.
+   * @param threshold If positive, a candidate whose estimated result size is
+   * smaller than that of the other candidate by at least this factor is chosen
+   * without computing the other product
+   * @param budget If positive, both products are only computed while the
+   * current DD has at most this many nodes. Otherwise, the estimate decides.
+   */
+  void setCostModel(double threshold, std::size_t budget) noexcept;
+
+  void json(nlohmann::json& j) const;
 
   // in general, the lookup application scheme will apply a single operation of
   // either circuit for every invocation. manipulation of the state is handled
@@ -40,9 +56,26 @@ private:
   dd::MatrixDD op2{};
   bool cached2 = false;
 
+  double estimateThreshold = 0.;
+  std::size_t multiplicationBudget = 0U;
+
+  // how the candidates were chosen
+  std::size_t evaluatedSteps = 0U;
+  std::size_t estimatedSteps = 0U;
+  std::size_t budgetedSteps = 0U;
+
+  // number of nodes of the current state per level (computed on demand)
+  std::vector<std::size_t> nodesPerLevel;
+  std::size_t stateSize = 0U;
+  void countNodes(const dd::MatrixDD& state);
+
+  /// Estimate the size of the product of the current state with the operation
+  [[nodiscard]] double estimateSize(const dd::MatrixDD& op) const;
+
   // the lookahead application scheme maintains links to an internal state to
   // manipulate and a package to use
   dd::MatrixDD* internalState{};
   dd::Package* package{};
+  GarbageCollector* garbageCollector{};
 };
 } // namespace ec
@@ -24,25 +24,24 @@ class ProportionalApplicationScheme final : public ApplicationScheme<DDType> {
 public:
   ProportionalApplicationScheme(TaskManager<DDType>& tm1,
                                 TaskManager<DDType>& tm2,
-                                const bool singleQubitGateFusion) noexcept
+                                const bool singleQubitGateFusion)
       : ApplicationScheme<DDType>(tm1, tm2),
-        singleQubitGateFusionEnabled(singleQubitGateFusion) {}
+        singleQubitGateFusionEnabled(singleQubitGateFusion) {
+    if (singleQubitGateFusionEnabled) {
+      tm1.computeUsedQubitCounts();
+    }
+  }
 
   std::pair<size_t, size_t> operator()() noexcept override {
-    // compute the remaining size of the circuits
-    const auto size1 = static_cast<std::size_t>(
-        std::distance(this->taskManager1->getIterator(),
-                      this->taskManager1->getCircuit()->cend()));
-    const auto size2 = static_cast<std::size_t>(
-        std::distance(this->taskManager2->getIterator(),
-                      this->taskManager2->getCircuit()->cend()));
+    // the remaining size of the circuits
+    const auto size1 = this->taskManager1->getRemaining();
+    const auto size2 = this->taskManager2->getRemaining();
     assert(size1 > 0U && size2 > 0U);
 
     if (singleQubitGateFusionEnabled) {
       // when single qubit gates are fused, any single-qubit gate should have a
       // single (compound) gate in the other circuit as a counterpart.
-      if (const auto& op = (*this->taskManager1)();
-          op->getUsedQubits().size() == 1U) {
+      if (this->taskManager1->getUsedQubitCount() == 1U) {
         return {1U, 1U};
       }
     }
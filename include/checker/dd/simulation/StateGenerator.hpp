@@ -14,6 +14,7 @@
 #include "dd/Package_fwd.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <random>
 #include <unordered_set>
 
@@ -43,6 +44,42 @@ public:
                                              std::size_t totalQubits,
                                              std::size_t ancillaryQubits = 0U);
 
+  /**
+   * @brief Generate the stimulus with the given index.
+   * @details In contrast to the other methods, the generated state only
+   * depends on the seed of the generator and the index of the stimulus, but
+   * not on any previously generated states. Hence, this method does not
+   * modify the generator and may be called concurrently from multiple threads,
+   * e.g., by simulation workers that claim disjoint ranges of indices.
+   * Computational basis states are obtained by a seeded bijective mixing of
+   * the index, so that distinct indices (below the number of basis states)
+   * yield distinct states without keeping track of the states generated so
+   * far. All other state types are sampled from a random number stream that
+   * is split off deterministically for each index.
+   * @param dd The package used to construct the state
+   * @param index The index of the stimulus
+   * @param totalQubits The total number of qubits
+   * @param ancillaryQubits The number of ancillary qubits (kept in |0>)
+   * @param type The type of state to generate
+   * @return The generated state
+   */
+  [[nodiscard]] dd::VectorDD
+  generateState(dd::Package& dd, std::size_t index, std::size_t totalQubits,
+                std::size_t ancillaryQubits = 0U,
+                StateType type = StateType::ComputationalBasis) const;
+
+  /**
+   * @brief Generate the computational basis state with the given index in
+   * Gray-code order.
+   * @details Consecutive indices yield basis states that only differ in a
+   * single qubit. Enumerating all indices below `2^(totalQubits -
+   * ancillaryQubits)` covers every basis state exactly once.
+   */
+  [[nodiscard]] static dd::VectorDD
+  generateGrayCodeState(dd::Package& dd, std::size_t index,
+                        std::size_t totalQubits,
+                        std::size_t ancillaryQubits = 0U);
+
   void seedGenerator(std::size_t s);
 
   void clear() { generatedComputationalBasisStates.clear(); }
@@ -50,13 +87,23 @@ public:
 private:
   std::size_t seed = 0U;
   std::mt19937_64 mt;
+  // the key from which the streams of the indexed stimuli are derived
+  std::uint64_t key = 0U;
 
   std::unordered_set<std::size_t> generatedComputationalBasisStates;
   constexpr static std::size_t ONE_QUBIT_BASE_ELEMENTS = 6U;
-  // this generator produces random bases from the set { |0>, |1>, |+>, |->,
-  // |L>, |R> }
-  std::uniform_int_distribution<std::size_t> random1QBasisDistribution =
-      std::uniform_int_distribution<std::size_t>(0U,
-                                                 ONE_QUBIT_BASE_ELEMENTS - 1U);
+
+  static dd::VectorDD makeRandomBasisState(dd::Package& dd,
+                                           std::mt19937_64& engine,
+                                           std::size_t totalQubits,
+                                           std::size_t randomQubits);
+  static dd::VectorDD make1QBasisState(dd::Package& dd,
+                                       std::mt19937_64& engine,
+                                       std::size_t totalQubits,
+                                       std::size_t randomQubits);
+  static dd::VectorDD makeStabilizerState(dd::Package& dd,
+                                          std::mt19937_64& engine,
+                                          std::size_t totalQubits,
+                                          std::size_t randomQubits);
 };
 } // namespace ec
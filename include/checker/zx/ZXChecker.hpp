@@ -12,6 +12,7 @@
 
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "ThreadPool.hpp"
 #include "checker/EquivalenceChecker.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
@@ -19,8 +20,24 @@
 #include "zx/ZXDefinitions.hpp"
 #include "zx/ZXDiagram.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace ec {
 class ZXEquivalenceChecker : public EquivalenceChecker {
@@ -34,16 +51,100 @@ public:
   static bool canHandle(const qc::QuantumComputation& qc1,
                         const qc::QuantumComputation& qc2);
 
-  void json(nlohmann::basic_json<>& j) const noexcept override {
-    EquivalenceChecker::json(j);
-    j["checker"] = "zx";
+  /**
+   * @brief Set the number of threads the checker may use.
+   * @details The rules are applied one after another since rewrites modify
+   * the shared diagram. However, once enough vertices have to be checked, the
+   * search for matches of a rule is distributed over the given number of
+   * threads. The number may be changed while the checker is running, e.g.,
+   * once other checkers finish and leave their threads idle. The helpers are
+   * run on the thread pool set via `setThreadPool()`; without a pool, the
+   * search is not parallelized.
+   */
+  void setNumThreads(const std::size_t nthreads) noexcept {
+    threads.store(std::max<std::size_t>(1U, nthreads),
+                  std::memory_order_relaxed);
   }
+  [[nodiscard]] std::size_t getNumThreads() const noexcept {
+    return threads.load(std::memory_order_relaxed);
+  }
+
+  /// Set the pool the search for matches is distributed over
+  void setThreadPool(std::shared_ptr<ThreadPool> threadPool) noexcept {
+    pool = std::move(threadPool);
+  }
+  [[nodiscard]] const auto& getThreadPool() const noexcept { return pool; }
+
+  void json(nlohmann::basic_json<>& j) const noexcept override;
+
+  [[nodiscard]] std::string_view getName() const noexcept override {
+    return "zx";
+  }
+
+  /// Whether the simplification gave up since the miter stopped shrinking
+  [[nodiscard]] bool hasStalled() const noexcept { return stalled; }
 
 private:
   zx::ZXDiagram miter;
   zx::fp tolerance;
   bool ancilla = false;
 
+  // whether the miter still has to be built by `buildMiter()`
+  bool streaming = false;
+  // the maximum number of vertices of the miter during its construction
+  std::size_t peakVertices = 0U;
+
+  // the simplification gives up once the number of vertices of the miter has
+  // not decreased for `stallRounds` consecutive rounds (0 disables this)
+  std::size_t stallRounds = 0U;
+  std::size_t roundsWithoutProgress = 0U;
+  std::size_t smallestSize = std::numeric_limits<std::size_t>::max();
+  bool stalled = false;
+
+  struct RuleStatistics {
+    std::size_t applications = 0U;
+    double time = 0.;
+  };
+  std::map<std::string_view, RuleStatistics> ruleStatistics;
+
+  // time spent in the individual phases of the check
+  struct PhaseTimes {
+    double construction = 0.;
+    double reduction = 0.;
+    double approximation = 0.;
+    double verification = 0.;
+  };
+  PhaseTimes phaseTimes{};
+
+  // the size of the miter over the course of the check
+  struct Sample {
+    double time;
+    std::size_t vertices;
+    std::size_t edges;
+  };
+  std::vector<Sample> samples;
+  std::chrono::steady_clock::time_point startTime;
+  static constexpr std::size_t MAX_SAMPLES = 1024U;
+
+  // whether the simplification shall stop
+  [[nodiscard]] bool aborted() const { return stalled || isDone(); }
+
+  /// Record the current size of the miter
+  void recordSample();
+  /// Record the size of the miter after a round of simplifications and update
+  /// the stall detection
+  void endRound();
+
+  // the circuits are split into at most this many chunks of at least
+  // `MIN_CHUNK_SIZE` operations during the construction of the miter
+  static constexpr std::size_t MAX_CHUNKS = 64U;
+  static constexpr std::size_t MIN_CHUNK_SIZE = 32U;
+
+  /// Build the miter by alternately adding chunks of both circuits
+  void buildMiter();
+  /// Build the miter from the complete diagrams of both circuits
+  void buildFullMiter();
+
   // the following methods are adaptations of the core ZX simplification
   // routines that additionally check a criterion for early termination of the
   // simplification.
@@ -54,66 +155,311 @@ private:
   bool interiorCliffordSimp();
   bool cliffordSimp();
 
-  bool idSimp() { return simplifyVertices(zx::checkIdSimp, zx::removeId); }
+  bool idSimp() {
+    return simplifyVertices("id_removal", zx::checkIdSimp, zx::removeId);
+  }
 
   bool spiderSimp() {
-    return simplifyEdges(zx::checkSpiderFusion, zx::fuseSpiders);
+    return simplifyEdges("spider_fusion", zx::checkSpiderFusion,
+                         zx::fuseSpiders);
   }
 
   bool localCompSimp() {
-    return simplifyVertices(zx::checkLocalComp, zx::localComp);
+    return simplifyVertices("local_complementation", zx::checkLocalComp,
+                            zx::localComp);
   }
 
   bool pivotPauliSimp() {
-    return simplifyEdges(zx::checkPivotPauli, zx::pivotPauli);
+    return simplifyEdges("pivot_pauli", zx::checkPivotPauli, zx::pivotPauli);
   }
 
-  bool pivotSimp() { return simplifyEdges(zx::checkPivot, zx::pivot); }
+  bool pivotSimp() {
+    return simplifyEdges("pivot", zx::checkPivot, zx::pivot);
+  }
 
   bool pivotGadgetSimp() {
-    return simplifyEdges(zx::checkPivotGadget, zx::pivotGadget);
+    return simplifyEdges("pivot_gadget", zx::checkPivotGadget,
+                         zx::pivotGadget);
+  }
+
+  /**
+   * @brief Vertices that have to be (re-)checked by a simplification rule.
+   * @details Instead of rescanning the whole diagram after each rewrite, the
+   * simplification routines only revisit the vertices in the vicinity of the
+   * last rewrite. Each vertex is contained at most once.
+   */
+  class Worklist {
+  public:
+    void push(const zx::Vertex v) {
+      if (v >= queued.size()) {
+        queued.resize(v + 1U, false);
+      }
+      if (!queued[v]) {
+        queued[v] = true;
+        pending.emplace_back(v);
+      }
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return pending.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return pending.size(); }
+    [[nodiscard]] bool contains(const zx::Vertex v) const noexcept {
+      return v < queued.size() && queued[v];
+    }
+
+    zx::Vertex pop() {
+      const auto v = pending.front();
+      pending.pop_front();
+      queued[v] = false;
+      return v;
+    }
+
+  private:
+    std::deque<zx::Vertex> pending;
+    std::vector<bool> queued;
+  };
+
+  // number of rewrites applied to the miter
+  std::size_t rewrites = 0U;
+
+  // number of threads used to search for matches of the rules
+  std::atomic<std::size_t> threads{1U};
+  // the pool running the helpers of the parallel search for matches
+  std::shared_ptr<ThreadPool> pool;
+  // minimum number of vertices to be checked for the search to be parallelized
+  static constexpr std::size_t PARALLEL_MATCHING_THRESHOLD = 1024U;
+
+  // seed the worklist with all vertices of the miter
+  void initWorklist(Worklist& worklist) const {
+    for (const auto& [v, _] : miter.getVertices()) {
+      worklist.push(v);
+    }
+  }
+
+  // all vertices within distance `radius` of the given vertices (taken before
+  // a rewrite, as these are the vertices that might be changed by it)
+  [[nodiscard]] std::vector<zx::Vertex>
+  vicinity(const std::initializer_list<zx::Vertex> roots,
+           const std::size_t radius = 1U) const {
+    std::vector<zx::Vertex> vertices{};
+    std::unordered_set<zx::Vertex> seen{};
+    for (const auto v : roots) {
+      if (seen.insert(v).second) {
+        vertices.emplace_back(v);
+      }
+    }
+    std::size_t begin = 0U;
+    for (std::size_t d = 0U; d < radius; ++d) {
+      const auto end = vertices.size();
+      for (auto i = begin; i < end; ++i) {
+        for (const auto& edge : miter.incidentEdges(vertices[i])) {
+          if (seen.insert(edge.to).second) {
+            vertices.emplace_back(edge.to);
+          }
+        }
+      }
+      begin = end;
+    }
+    return vertices;
+  }
+
+  // after a rewrite, the surviving affected vertices and all vertices adjacent
+  // to them (whose applicability of rules might depend on them) are dirty
+  void markDirty(Worklist& worklist,
+                 const std::vector<zx::Vertex>& affected) const {
+    for (const auto v : affected) {
+      if (miter.isDeleted(v)) {
+        continue;
+      }
+      worklist.push(v);
+      for (const auto& edge : miter.incidentEdges(v)) {
+        worklist.push(edge.to);
+      }
+    }
+  }
+
+  // a match of a rule on a vertex `v` is stored as `(v, v)`
+  using Match = std::pair<zx::Vertex, zx::Vertex>;
+
+  template <class CheckFun, class RuleFun>
+  bool simplifyVertices(const std::string_view name, CheckFun check,
+                        RuleFun rule) {
+    return simplify(
+        name,
+        [this, &check](const zx::Vertex v) -> std::optional<Match> {
+          if (check(miter, v)) {
+            return Match{v, v};
+          }
+          return std::nullopt;
+        },
+        [this, &rule](const Match& match) { rule(miter, match.first); });
   }
 
   template <class CheckFun, class RuleFun>
-  bool simplifyVertices(CheckFun check, RuleFun rule) {
+  bool simplifyEdges(const std::string_view name, CheckFun check,
+                     RuleFun rule) {
+    return simplify(
+        name,
+        [this, &check](const zx::Vertex v) -> std::optional<Match> {
+          // the edges are visited in the same orientation as by `getEdges()`
+          for (const auto& edge : miter.incidentEdges(v)) {
+            const auto v0 = std::min(v, edge.to);
+            const auto v1 = std::max(v, edge.to);
+            if (!miter.isDeleted(v0) && !miter.isDeleted(v1) &&
+                check(miter, v0, v1)) {
+              return Match{v0, v1};
+            }
+          }
+          return std::nullopt;
+        },
+        [this, &rule](const Match& match) {
+          rule(miter, match.first, match.second);
+        });
+  }
+
+  /**
+   * @brief Apply a rule until none of its matches are left.
+   * @param name The name of the rule (used for the statistics)
+   * @param find Searches for a match of the rule at a vertex without modifying
+   * the miter
+   * @param apply Applies the rule to a match
+   * @return Whether the rule has been applied at least once
+   */
+  template <class FindFun, class ApplyFun>
+  bool simplify(const std::string_view name, FindFun find, ApplyFun apply) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto rewritesBefore = rewrites;
     auto simplified = false;
-    while (!isDone()) {
-      auto moreSimplified = false;
-      for (const auto& [v, _] : miter.getVertices()) {
-        if (isDone() || !check(miter, v)) {
-          continue;
-        }
-        rule(miter, v);
-        moreSimplified = true;
+    Worklist worklist{};
+    initWorklist(worklist);
+    while (!worklist.empty() && !aborted()) {
+      const auto nthreads = threads.load(std::memory_order_relaxed);
+      if (pool && nthreads > 1U &&
+          worklist.size() >= PARALLEL_MATCHING_THRESHOLD) {
+        simplified |= simplifyBatch(worklist, find, apply, nthreads);
+        continue;
       }
-      if (!moreSimplified) {
-        break;
+      const auto v = worklist.pop();
+      if (miter.isDeleted(v)) {
+        continue;
+      }
+      if (const auto match = find(v)) {
+        applyMatch(worklist, *match, apply);
+        simplified = true;
       }
-      simplified = true;
     }
+    auto& statistics = ruleStatistics[name];
+    statistics.applications += rewrites - rewritesBefore;
+    statistics.time += std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
     return simplified;
   }
 
-  template <class CheckFun, class RuleFun>
-  bool simplifyEdges(CheckFun check, RuleFun rule) {
+  /**
+   * @brief Process all vertices of the worklist at once.
+   * @details The search for matches only reads the miter and is distributed
+   * over the calling thread and up to `nthreads - 1` helpers on the thread
+   * pool. The batch is split into chunks that are claimed by whichever thread
+   * is free, so the calling thread never waits for a helper that has not
+   * started yet. Afterwards, the matches are applied in order. A
+   * match whose vicinity has been changed by a previous rewrite of the batch
+   * (which is exactly the case if one of its vertices has been put onto the
+   * worklist again) is searched for once more before it is applied.
+   */
+  template <class FindFun, class ApplyFun>
+  bool simplifyBatch(Worklist& worklist, FindFun& find, ApplyFun& apply,
+                     const std::size_t nthreads) {
+    std::vector<zx::Vertex> batch{};
+    batch.reserve(worklist.size());
+    while (!worklist.empty()) {
+      if (const auto v = worklist.pop(); !miter.isDeleted(v)) {
+        batch.emplace_back(v);
+      }
+    }
+
+    std::vector<std::optional<Match>> matches(batch.size());
+    const auto chunk = (batch.size() + nthreads - 1U) / nthreads;
+    const auto nchunks = (batch.size() + chunk - 1U) / chunk;
+
+    // helpers that only start once all chunks have been claimed merely touch
+    // this state, which is why it outlives the batch
+    struct Progress {
+      std::atomic<std::size_t> next{0U};
+      std::mutex mutex;
+      std::condition_variable cond;
+      std::size_t finished = 0U;
+      std::exception_ptr error;
+    };
+    const auto progress = std::make_shared<Progress>();
+    const auto work = [this, &batch, &matches, &find, chunk,
+                       nchunks](Progress& state) {
+      for (auto c = state.next++; c < nchunks; c = state.next++) {
+        std::exception_ptr error{};
+        try {
+          const auto end = std::min((c + 1U) * chunk, batch.size());
+          for (auto i = c * chunk; i < end && !aborted(); ++i) {
+            matches[i] = find(batch[i]);
+          }
+        } catch (...) {
+          error = std::current_exception();
+        }
+        const std::lock_guard lock(state.mutex);
+        if (error && !state.error) {
+          state.error = error;
+        }
+        if (++state.finished == nchunks) {
+          state.cond.notify_all();
+        }
+      }
+    };
+    const auto helpers = std::min({nthreads, nchunks, pool->size() + 1U}) - 1U;
+    for (std::size_t h = 0U; h < helpers; ++h) {
+      // the helpers only access the batch while it has unclaimed chunks
+      static_cast<void>(
+          pool->submit([progress, work] { work(*progress); }));
+    }
+    work(*progress);
+    {
+      std::unique_lock lock(progress->mutex);
+      progress->cond.wait(lock,
+                          [&] { return progress->finished == nchunks; });
+      if (progress->error) {
+        std::rethrow_exception(progress->error);
+      }
+    }
+
     auto simplified = false;
-    while (!isDone()) {
-      auto moreSimplified = false;
-      for (const auto& [v0, v1] : miter.getEdges()) {
-        if (isDone() || miter.isDeleted(v0) || miter.isDeleted(v1) ||
-            !check(miter, v0, v1)) {
+    for (std::size_t i = 0U; i < batch.size() && !aborted(); ++i) {
+      auto match = matches[i];
+      if (!match) {
+        continue;
+      }
+      const auto dirty = [this, &worklist](const zx::Vertex v) {
+        return miter.isDeleted(v) || worklist.contains(v);
+      };
+      if (std::ranges::any_of(vicinity({match->first, match->second}),
+                              dirty)) {
+        if (miter.isDeleted(batch[i])) {
+          continue;
+        }
+        match = find(batch[i]);
+        if (!match) {
           continue;
         }
-        rule(miter, v0, v1);
-        moreSimplified = true;
-      }
-      if (!moreSimplified) {
-        break;
       }
+      applyMatch(worklist, *match, apply);
       simplified = true;
     }
     return simplified;
   }
+
+  template <class ApplyFun>
+  void applyMatch(Worklist& worklist, const Match& match, ApplyFun& apply) {
+    const auto affected = vicinity({match.first, match.second});
+    apply(match);
+    ++rewrites;
+    markDirty(worklist, affected);
+  }
 };
 
 qc::Permutation complete(const qc::Permutation& p,
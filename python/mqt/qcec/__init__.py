@@ -33,11 +33,14 @@ if sys.platform == "win32":  # noqa: RUF067 This is actually required on Windows
 
 
 from ._version import version as __version__
-from .verify import verify
+from .verify import verify, verify_async
 from .verify_compilation_flow import verify_compilation
+from .verify_distributed import verify_distributed
 
 __all__ = [
     "__version__",
     "verify",
+    "verify_async",
     "verify_compilation",
+    "verify_distributed",
 ]
@@ -20,11 +20,15 @@ import numpy as np
 from ._compat.optional import HAS_QISKIT
 
 if TYPE_CHECKING:
+    from collections.abc import Callable
+
+    from mqt.core.ir.operations import OpType
     from numpy.typing import NDArray
     from qiskit.circuit import QuantumCircuit
 
 __all__ = [
     "AncillaMode",
+    "create_cost_function",
     "generate_profile",
     "generate_profile_name",
 ]
@@ -468,3 +472,77 @@ def generate_profile(
     filename = generate_profile_name(optimization_level=optimization_level, mode=mode)
     filepath = filepath.joinpath(filename)
     __write_profile_data_to_file(profile, filepath)
+
+
+def create_cost_function(
+    optimization_level: int = 1,
+    mode: AncillaMode = AncillaMode.NO_ANCILLA,
+    basis_gates: list[str] | None = None,
+) -> Callable[[tuple[OpType, int]], int]:
+    """Create a cost function that computes the cost of a gate on demand, as it would be stored in a compilation flow profile.
+
+    In contrast to :func:`generate_profile`, no gate is compiled up front.
+    Combined with the ``profile_store`` option, every gate occurring in the checked circuits is compiled only once and its cost is persisted for later runs.
+    Multi-controlled gates are compiled for their actual number of controls instead of extrapolating their cost.
+
+    Args:
+        optimization_level:
+            The IBM Qiskit optimization level to use for compiling the gates (0, 1, 2, or 3). Defaults to 1.
+        mode:
+            The :class:`ancilla mode <.AncillaMode>` used for realizing multi-controlled Toffoli gates, as available in Qiskit.
+            Defaults to :attr:`.AncillaMode.NO_ANCILLA`.
+        basis_gates:
+            The gate set the gates are compiled to. Defaults to ``["id", "rz", "sx", "x", "cx"]``.
+
+    Returns:
+        A function that computes the cost of a gate given its type and its number of controls.
+        Gates that are not covered by compilation flow profiles have a cost of ``1``.
+    """
+    if mode != AncillaMode.NO_ANCILLA:
+        warnings.warn(
+            "Qiskit has deprecated the ``mode`` argument of ``QuantumCircuit.mcx()`` with version 2.1. "
+            "In accordance with this, ``mqt.qcec`` has deprecated the ``mode`` argument "
+            "of ``create_cost_function`` as well. "
+            "The argument will be removed in a future release.",
+            DeprecationWarning,
+            stacklevel=2,
+        )
+
+    HAS_QISKIT.require_now("compute gate costs")
+
+    if basis_gates is None:
+        basis_gates = ["id", "rz", "sx", "x", "cx"]
+
+    multi_controlled_collection = [*multi_controlled_gates, *gate_collection_for_mode[mode]]
+    # gates whose cost is derived from the generic phase gate (see ``__add_special_case_data``)
+    phase_gates = {"z", "s", "sdg", "t", "tdg"}
+
+    def create_circuit(gate: str, controls: int) -> QuantumCircuit | None:
+        # multi-controlled gates take precedence over general gates, as in ``generate_profile``,
+        # and are compiled for any number of controls instead of extrapolating their cost
+        if controls >= control_range.start:
+            for gate_set in multi_controlled_collection:
+                if gate in gate_set["gates"]:
+                    return __create_multi_controlled_gate(
+                        gate_set["qubits"],
+                        gate_set["params"],
+                        controls,
+                        gate_set["mode"],
+                        gate_set["ancilla_qubits"],
+                        gate,
+                    )
+        for gate_set in general_gates:
+            if gate in gate_set["gates"] and gate_set["controls"] == controls:
+                return __create_general_gate(gate_set["qubits"], gate_set["params"], controls, gate)
+        if gate in phase_gates:
+            return create_circuit("p", controls)
+        return None
+
+    def cost_function(gate: tuple[OpType, int]) -> int:
+        op_type, controls = gate
+        qc = create_circuit(op_type.name, controls)
+        if qc is None:
+            return 1
+        return __compute_cost(qc, basis_gates, optimization_level)
+
+    return cost_function
@@ -13,6 +13,10 @@ from __future__ import annotations
 from typing import TYPE_CHECKING, TypedDict
 
 if TYPE_CHECKING:
+    from collections.abc import Callable
+
+    from mqt.core.ir.operations import OpType
+
     from ._compat.typing import Unpack
     from .pyqcec import ApplicationScheme, Configuration, StateType
 
@@ -36,34 +40,70 @@ class ConfigurationOptions(TypedDict, total=False):
     construction_scheme: ApplicationScheme
     simulation_scheme: ApplicationScheme
     profile: str
+    profile_store: str
+    cost_function: Callable[[tuple[OpType, int]], int]
+    lookahead_estimate_threshold: float
+    lookahead_multiplication_budget: int
+    alternating_portfolio: list[ApplicationScheme]
     # Execution
+    alternating_tolerance: float
+    checker_memory_limit: int
+    checkpoint_file: str
+    checkpoint_interval: float
+    construction_threads: int
+    construction_tolerance: float
+    counterexample_amplitudes: int
+    dd_compute_table_buckets: int
+    dd_unique_table_buckets: int
+    gc_interval: int
+    gc_memory_threshold: int
+    instrumentation: bool
+    memory_limit: int
     nthreads: int
     numerical_tolerance: float
     parallel: bool
+    pipelined_preprocessing: bool
+    retain_counterexample_dds: bool
     run_alternating_checker: bool
+    run_clifford_checker: bool
     run_construction_checker: bool
     run_simulation_checker: bool
     run_zx_checker: bool
+    simulation_tolerance: float
+    slices: int
     timeout: float
     # Functionality
     trace_threshold: float
     check_partial_equivalence: bool
+    zx_stall_rounds: int
     # Optimizations
     backpropagate_output_permutation: bool
+    cache_preprocessing: bool
+    decompose_components: bool
     elide_permutations: bool
     fuse_single_qubit_gates: bool
+    preprocessing_cache_directory: str
     reconstruct_swaps: bool
     remove_diagonal_gates_before_measure: bool
     reorder_operations: bool
+    strip_common_gates: bool
     transform_dynamic_circuit: bool
     # Parameterized
     additional_instantiations: int
     parameterized_tolerance: float
     # Simulation
+    adaptive_state_type: bool
+    basis_detection_probability: float
+    exhaustive: bool
+    false_negative_bound: float
     fidelity_threshold: float
+    first_stimulus: int
     max_sims: int
+    random_1q_detection_probability: float
     seed: int
+    stabilizer_detection_probability: float
     state_type: StateType
+    stimuli_per_run: int
 
 
 def augment_config_from_kwargs(config: Configuration, **kwargs: Unpack[ConfigurationOptions]) -> None:
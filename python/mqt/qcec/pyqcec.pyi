@@ -7,10 +7,12 @@
 # Licensed under the MIT License
 
 import enum
-from typing import Any
+from collections.abc import Callable
+from typing import Any, overload
 
 import mqt.core.dd
 import mqt.core.ir
+import mqt.core.ir.operations
 
 class ApplicationScheme(enum.IntEnum):
     """Describes the order in which the individual operations of both circuits are applied during the equivalence check.
@@ -64,6 +66,27 @@ class ApplicationScheme(enum.IntEnum):
     Alternates between applications from the first and the second circuit, but applies the gates in proportion to the number of gates in each circuit.
     """
 
+    adaptive = 5
+    """
+    Observes the size of the decision diagram after each step and adapts from which circuit gates are applied.
+
+    While the decision diagram is as small as the identity, gates are applied proportionally.
+    Once it grows, gates from the other circuit are applied until the decision diagram stops shrinking.
+    The decisions are recorded in the results of the checker.
+    Only works for the alternating equivalence checker.
+    """
+
+def compile_gate_cost_profile(profile: str, output: str) -> None:
+    """Convert a gate cost profile to the compiled binary format.
+
+    Compiled profiles can be used in place of the original profile (see :attr:`.Configuration.Application.profile`).
+    They are memory-mapped instead of being parsed and are shared read-only by all checkers and processes using them.
+
+    Args:
+        profile: The path to the profile in the text format.
+        output: The path the compiled profile is written to.
+    """
+
 class Configuration:
     """Provides all the means to configure QCEC.
 
@@ -107,7 +130,7 @@ class Configuration:
 
             .. note::
 
-                Timeouts in QCEC work by checking an atomic flag in between the application of gates (for DD-based checkers) or rewrite rules (for the ZX-based checkers).
+                Timeouts in QCEC work by checking an atomic flag in between the application of gates and before each garbage collection (for DD-based checkers) or in between rewrite rules (for the ZX-based checkers).
                 Unfortunately, this means that an operation needs to be fully applied before a timeout can set in.
                 If a certain operation during the equivalence check takes a very long time (e.g., because the DD is becoming very large), the timeout will not be triggered until that operation is finished.
                 Thus, it is possible that the timeout is not triggered at the expected time, and it might seem like the timeout is being ignored.
@@ -123,6 +146,24 @@ class Configuration:
         @timeout.setter
         def timeout(self, arg: float, /) -> None: ...
         @property
+        def checkpoint_file(self) -> str:
+            """Set a file the alternating checker writes its state to, so that a long-running check can be resumed.
+
+            The state consists of the positions in both circuits, the tracked permutations, and the accumulated decision diagram (in a compact binary format). It is written every :attr:`checkpoint_interval` seconds and whenever the checker is stopped without a result (e.g., due to a timeout). A later check of the same (preprocessed) circuits with the same application scheme resumes from the checkpoint, also on a different machine. Checkpoints of other checks are ignored. The lookahead and adaptive application schemes do not support checkpoints. Defaults to an empty string, which disables checkpoints.
+            """
+
+        @checkpoint_file.setter
+        def checkpoint_file(self, arg: str, /) -> None: ...
+        @property
+        def checkpoint_interval(self) -> float:
+            """Set the interval (in seconds) in which checkpoints are written.
+
+            See :attr:`checkpoint_file`. Defaults to :code:`300.`.
+            """
+
+        @checkpoint_interval.setter
+        def checkpoint_interval(self, arg: float, /) -> None: ...
+        @property
         def run_construction_checker(self) -> bool:
             """Set whether the construction checker should be executed.
 
@@ -132,6 +173,33 @@ class Configuration:
         @run_construction_checker.setter
         def run_construction_checker(self, arg: bool, /) -> None: ...
         @property
+        def construction_threads(self) -> int:
+            """Set the number of threads the construction checker uses to build the functionality of each circuit.
+
+            Values above :code:`1` split each circuit into (at most) that many segments. Their unitaries are built concurrently in separate DD packages and then multiplied in a balanced tree. Circuits that are too small to be split are built gate by gate. Defaults to :code:`1`.
+            """
+
+        @construction_threads.setter
+        def construction_threads(self, arg: int, /) -> None: ...
+        @property
+        def slices(self) -> int:
+            """Set the number of slices the circuits are cut into at synchronization points before running the full check.
+
+            If both circuits contain the same number of barriers acting on all qubits, they are cut at these barriers. Otherwise, each slice contains the same fraction of the gates of each circuit. The pairs of slices are checked independently (and concurrently in the parallel flow), which keeps the decision diagrams small for deep circuits that have only been rewritten locally. If all pairs are equivalent, so are the circuits. Otherwise, the regular check is run on the full circuits within the remaining time. Slicing is skipped for partial equivalence checking and for circuits with ancillary or garbage qubits. Values below :code:`2` disable slicing. Defaults to :code:`0`.
+            """
+
+        @slices.setter
+        def slices(self, arg: int, /) -> None: ...
+        @property
+        def pipelined_preprocessing(self) -> bool:
+            """Set whether simulations should already start while the circuits are being preprocessed.
+
+            If enabled (and the simulation checker is configured), the manager simulates copies of the circuits that have only passed the optimizations required for correctness (e.g., the transformation of dynamic circuits) on a separate thread while the remaining optimization passes run. If these simulations show non-equivalence, :meth:`~.EquivalenceCheckingManager.run` reports the result right away (see :attr:`~.EquivalenceCheckingManager.Results.decided_during_preprocessing`). Otherwise, they are discarded and the regular check is run. Defaults to :code:`False`.
+            """
+
+        @pipelined_preprocessing.setter
+        def pipelined_preprocessing(self, arg: bool, /) -> None: ...
+        @property
         def run_simulation_checker(self) -> bool:
             """Set whether the simulation checker should be executed.
 
@@ -159,6 +227,15 @@ class Configuration:
         @run_zx_checker.setter
         def run_zx_checker(self, arg: bool, /) -> None: ...
         @property
+        def run_clifford_checker(self) -> bool:
+            """Set whether the stabilizer-tableau checker should be executed for Clifford circuits.
+
+            If both circuits only consist of Clifford operations, it runs before all other checkers and decides the check in time polynomial in the number of qubits, also in the presence of ancillary qubits. Since stabilizer tableaux do not capture global phases, equivalent circuits are reported as :attr:`~.EquivalenceCriterion.equivalent_up_to_global_phase`. Partial equivalence checking of circuits with garbage qubits is not supported. Defaults to :code:`False`.
+            """
+
+        @run_clifford_checker.setter
+        def run_clifford_checker(self, arg: bool, /) -> None: ...
+        @property
         def numerical_tolerance(self) -> float:
             """Set the numerical tolerance of the underlying decision diagram package.
 
@@ -168,6 +245,33 @@ class Configuration:
         @numerical_tolerance.setter
         def numerical_tolerance(self, arg: float, /) -> None: ...
         @property
+        def simulation_tolerance(self) -> float:
+            """Set the numerical tolerance of the decision diagram package of the simulation checker.
+
+            A coarser tolerance than :attr:`numerical_tolerance` merges more edge weights and keeps the decision diagrams small, which is usually sufficient for screening for non-equivalence. Since the tolerance is a process-wide setting of the decision diagram package, checkers running concurrently (e.g., if :attr:`parallel` is set) share the smallest tolerance among them. Checks of different managers running at the same time must use the same tolerance, and sequential checks with differing per-checker tolerances must not overlap with any other check. Otherwise, the later check raises a :class:`RuntimeError`. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.
+            """
+
+        @simulation_tolerance.setter
+        def simulation_tolerance(self, arg: float, /) -> None: ...
+        @property
+        def alternating_tolerance(self) -> float:
+            """Set the numerical tolerance of the decision diagram package of the alternating checker.
+
+            See :attr:`simulation_tolerance` for how the tolerances of concurrently running checkers are combined. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.
+            """
+
+        @alternating_tolerance.setter
+        def alternating_tolerance(self, arg: float, /) -> None: ...
+        @property
+        def construction_tolerance(self) -> float:
+            """Set the numerical tolerance of the decision diagram package of the construction checker.
+
+            See :attr:`simulation_tolerance` for how the tolerances of concurrently running checkers are combined. Defaults to :code:`0`, which falls back to :attr:`numerical_tolerance`.
+            """
+
+        @construction_tolerance.setter
+        def construction_tolerance(self, arg: float, /) -> None: ...
+        @property
         def set_all_ancillae_garbage(self) -> bool:
             """Set whether all ancillae should be treated as garbage qubits.
 
@@ -176,6 +280,91 @@ class Configuration:
 
         @set_all_ancillae_garbage.setter
         def set_all_ancillae_garbage(self, arg: bool, /) -> None: ...
+        @property
+        def gc_interval(self) -> int:
+            """Set after how many applied gates the garbage collection of the DD packages is invoked.
+
+            Defaults to :code:`1`, i.e., after every gate. Larger values amortize the cost of the collection over multiple gates at the expense of a higher memory footprint. A value of :code:`0` disables periodic garbage collection.
+            """
+
+        @gc_interval.setter
+        def gc_interval(self, arg: int, /) -> None: ...
+        @property
+        def gc_memory_threshold(self) -> int:
+            """Set a resident memory budget (in bytes) above which garbage collection in the DD packages is forced.
+
+            Defaults to :code:`0`, which disables the memory-based trigger.
+            """
+
+        @gc_memory_threshold.setter
+        def gc_memory_threshold(self, arg: int, /) -> None: ...
+        @property
+        def dd_unique_table_buckets(self) -> int:
+            """Set the number of buckets of the unique table that is predominantly used by the DD-based checkers (rounded up to the next power of two).
+
+            Defaults to :code:`0`, which means that the size is derived from the number of qubits of the circuits. The chosen sizes are reported in the results of each checker.
+            """
+
+        @dd_unique_table_buckets.setter
+        def dd_unique_table_buckets(self, arg: int, /) -> None: ...
+        @property
+        def dd_compute_table_buckets(self) -> int:
+            """Set the number of buckets of the compute tables that are predominantly used by the DD-based checkers (rounded up to the next power of two).
+
+            Defaults to :code:`0`, which means that the size is derived from the number of qubits and gates of the circuits. The chosen sizes are reported in the results of each checker.
+            """
+
+        @dd_compute_table_buckets.setter
+        def dd_compute_table_buckets(self, arg: int, /) -> None: ...
+        @property
+        def memory_limit(self) -> int:
+            """Set a limit (in bytes) on the resident memory of the process during the DD-based checks.
+
+            A DD-based checker that still exceeds the limit after a forced garbage collection stops without a result, while the remaining checkers continue. Defaults to :code:`0`, which means no limit.
+            """
+
+        @memory_limit.setter
+        def memory_limit(self, arg: int, /) -> None: ...
+        @property
+        def checker_memory_limit(self) -> int:
+            """Set a limit (in bytes) on the memory occupied by the nodes of the DD package of each DD-based checker.
+
+            A checker exceeding this limit stops without a result, while the remaining checkers continue. The peak memory of each checker is reported in its results. Defaults to :code:`0`, which means no limit.
+            """
+
+        @checker_memory_limit.setter
+        def checker_memory_limit(self, arg: int, /) -> None: ...
+        @property
+        def instrumentation(self) -> bool:
+            """Set whether the DD-based checkers should be instrumented. Defaults to :code:`False`.
+
+            If enabled, the results of each DD-based checker contain the time spent in the individual phases of the check (:code:`initialize`, :code:`execute`, :code:`finish`, :code:`postprocess`, and :code:`check_equivalence`), the peak and final number of DD nodes, and the statistics of the unique and compute tables of its DD package. Tracking the peak size requires traversing the DDs after every step, which slows down the check.
+            """
+
+        @instrumentation.setter
+        def instrumentation(self, arg: bool, /) -> None: ...
+        @property
+        def counterexample_amplitudes(self) -> int:
+            """The number of amplitudes recorded in the compact :attr:`~.EquivalenceCheckingManager.Results.counterexample`.
+
+            The amplitudes in which both output states differ the most are recorded (for circuits with at most 20 qubits).
+            Defaults to :code:`8`.
+            """
+
+        @counterexample_amplitudes.setter
+        def counterexample_amplitudes(self, arg: int, /) -> None: ...
+        @property
+        def retain_counterexample_dds(self) -> bool:
+            """Whether to keep the decision diagrams of a counterexample after the check.
+
+            The decision diagrams :attr:`~.EquivalenceCheckingManager.Results.cex_input`, :attr:`~.EquivalenceCheckingManager.Results.cex_output1`, and :attr:`~.EquivalenceCheckingManager.Results.cex_output2` keep the DD packages of the checkers (and all of their nodes) alive.
+            If disabled, only the compact :attr:`~.EquivalenceCheckingManager.Results.counterexample` is kept and the packages of all finished checkers are released as soon as the check has been decided.
+            This reduces the memory retained by long-running processes checking many circuits.
+            Defaults to :code:`True`.
+            """
+
+        @retain_counterexample_dds.setter
+        def retain_counterexample_dds(self, arg: bool, /) -> None: ...
 
     class Optimizations:
         """Options that influence which circuit optimizations are applied during pre-processing."""
@@ -251,6 +440,42 @@ class Configuration:
 
         @elide_permutations.setter
         def elide_permutations(self, arg: bool, /) -> None: ...
+        @property
+        def strip_common_gates(self) -> bool:
+            """Remove the longest common prefix and suffix of operations from both circuits before any checker runs.
+
+            Compiled circuits often only differ from the original in a few places. Identical leading operations cancel directly, and identical trailing operations conjugate the remaining difference, which does not change whether it resembles the identity (up to a global phase). Detecting them is linear in the size of the circuits and saves the corresponding decision diagram operations in all checkers. The pass is skipped for partial equivalence checking and circuits with ancillary or garbage qubits. Defaults to :code:`False`.
+            """
+
+        @strip_common_gates.setter
+        def strip_common_gates(self, arg: bool, /) -> None: ...
+        @property
+        def decompose_components(self) -> bool:
+            """Split the circuits into independent qubit components and check each of them as a separate sub-problem.
+
+            Two qubits belong to the same component if a gate of either circuit acts on both of them or if the permutations of either circuit map one onto the other. The circuits are equivalent if and only if all components are. In the parallel flow, the components are checked concurrently. The decomposition is skipped for partial equivalence checking, incomplete output permutations, and circuits with non-unitary operations. Defaults to :code:`False`.
+            """
+
+        @decompose_components.setter
+        def decompose_components(self, arg: bool, /) -> None: ...
+        @property
+        def cache_preprocessing(self) -> bool:
+            """Reuse the results of preprocessing (i.e., the optimization passes as well as the removal of idle qubits and the setup of ancillary qubits) whenever identical circuits are checked with identical optimization options.
+
+            Cached circuits are kept in memory for the lifetime of the process. Defaults to :code:`False`.
+            """
+
+        @cache_preprocessing.setter
+        def cache_preprocessing(self, arg: bool, /) -> None: ...
+        @property
+        def preprocessing_cache_directory(self) -> str:
+            """A directory in which preprocessed circuits are additionally persisted so that they can be reused across processes (e.g., repeated CI runs).
+
+            Setting a directory enables :attr:`cache_preprocessing`. Defaults to an empty string, which means that nothing is written to disk.
+            """
+
+        @preprocessing_cache_directory.setter
+        def preprocessing_cache_directory(self, arg: str, /) -> None: ...
 
     class Application:
         """Options describing the :class:`.ApplicationScheme` used for the individual equivalence checkers."""
@@ -280,10 +505,71 @@ class Configuration:
 
             This profile can be set via a file constructed like a lookup table.
             Every line :code:`<GATE_ID> <N_CONTROLS> <COST>` specifies the cost for a given gate type and with a certain number of controls, e.g., :code:`X 0 1` denotes that a single-qubit X gate has a cost of :code:`1`, while :code:`X 2 15` denotes that a Toffoli gate has a cost of :code:`15`.
+
+            Alternatively, a profile compiled via :func:`~.compile_gate_cost_profile` can be used, which avoids parsing the profile and is memory-mapped.
+            In any case, the profile is only loaded once per run and is shared by all checkers.
             """
 
         @profile.setter
         def profile(self, arg: str, /) -> None: ...
+        @property
+        def profile_store(self) -> str:
+            """Path of a file that persists the gate costs computed by the :attr:`cost_function` (if no :attr:`profile` is set).
+
+            Instead of generating a complete profile up front, the cost of a gate is only computed once it is needed, i.e., once it occurs in a checked circuit.
+            Each cost is computed once per process, appended to the file in the format of a :attr:`profile`, and reused by all later runs that use the same file.
+            Consequently, the file can also be used as a :attr:`profile` later on.
+            """
+
+        @profile_store.setter
+        def profile_store(self, arg: str, /) -> None: ...
+        @property
+        def cost_function(self) -> Callable[[tuple[mqt.core.ir.operations.OpType, int]], int]:
+            """The function computing the cost of a gate for the :attr:`Gate Cost <.ApplicationScheme.gate_cost>` application scheme if no :attr:`profile` is set.
+
+            It is called with the type of a gate and its number of controls, e.g., via :func:`~.create_cost_function`, and returns the cost of the gate.
+            By default, every gate has a cost of :code:`1`.
+            """
+
+        @cost_function.setter
+        def cost_function(self, arg: Callable[[tuple[mqt.core.ir.operations.OpType, int]], int], /) -> None: ...
+        @property
+        def lookahead_estimate_threshold(self) -> float:
+            """The :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme usually computes the products with the next gates of both circuits and keeps the smaller one.
+
+            If set to a positive value, the size of both products is first estimated from the node counts of the current decision diagram at the levels touched by the respective gates.
+            Whenever one estimate is smaller than the other by at least this factor, only the corresponding product is computed.
+
+            Defaults to :code:`0.`, i.e., no estimation.
+            """
+
+        @lookahead_estimate_threshold.setter
+        def lookahead_estimate_threshold(self, arg: float, /) -> None: ...
+        @property
+        def lookahead_multiplication_budget(self) -> int:
+            """Bounds the size (in nodes) of the decision diagram for which the :attr:`Lookahead <.ApplicationScheme.lookahead>` application scheme speculatively computes both candidate products.
+
+            For larger decision diagrams, only the product with the smaller estimated size is computed.
+            A value of :code:`0` means that both products are always computed when the estimate is inconclusive.
+
+            Defaults to :code:`0`.
+            """
+
+        @lookahead_multiplication_budget.setter
+        def lookahead_multiplication_budget(self, arg: int, /) -> None: ...
+        @property
+        def alternating_portfolio(self) -> list[ApplicationScheme]:
+            """Additional :class:`.ApplicationScheme` instances that race the :attr:`alternating_scheme` when checking in parallel.
+
+            Each scheme is used by a further alternating checker running concurrently, and the first checker to reach a result cancels all others.
+            Listing a scheme multiple times (or listing the :attr:`alternating_scheme` itself) runs the repeated checkers with decision diagram packages whose tables are twice as large as those of the previous checker with that scheme.
+            The portfolio takes threads away from the simulation checkers and is ignored in sequential runs.
+
+            Defaults to an empty list.
+            """
+
+        @alternating_portfolio.setter
+        def alternating_portfolio(self, arg: list[ApplicationScheme], /) -> None: ...
 
     class Functionality:
         """Options for all checkers that consider the whole functionality of a circuit."""
@@ -317,6 +603,18 @@ class Configuration:
 
         @check_partial_equivalence.setter
         def check_partial_equivalence(self, arg: bool, /) -> None: ...
+        @property
+        def zx_stall_rounds(self) -> int:
+            """The number of consecutive rounds of simplification without a decrease in the size of the ZX-diagram after which the ZX checker gives up.
+
+            The checker then stops without a result, which frees its thread for further simulations.
+            A value of :code:`0` disables this behavior.
+
+            Defaults to :code:`0`.
+            """
+
+        @zx_stall_rounds.setter
+        def zx_stall_rounds(self, arg: int, /) -> None: ...
 
     class Simulation:
         """Options that influence the simulation checker."""
@@ -362,6 +660,89 @@ class Configuration:
 
         @seed.setter
         def seed(self, arg: int, /) -> None: ...
+        @property
+        def first_stimulus(self) -> int:
+            """The index of the first stimulus that is simulated.
+
+            The stimuli only depend on the :attr:`seed` and their index.
+            Hence, multiple processes (e.g., on different nodes of a cluster) using the same non-zero seed simulate disjoint stimuli if they are assigned disjoint ranges of :attr:`max_sims` stimuli starting at this index.
+            Ignored in :attr:`exhaustive` mode, which always covers all basis states.
+            Defaults to :code:`0`.
+            """
+
+        @first_stimulus.setter
+        def first_stimulus(self, arg: int, /) -> None: ...
+        @property
+        def stimuli_per_run(self) -> int:
+            """The number of stimuli that are propagated through the circuits by a single simulation run.
+
+            Batching multiple stimuli in one run allows to construct each gate's decision diagram only once for the whole batch and to share the decision diagram package between the stimuli.
+            Each stimulus still counts as one simulation towards :attr:`max_sims`.
+            Defaults to :code:`1`.
+            """
+
+        @stimuli_per_run.setter
+        def stimuli_per_run(self, arg: int, /) -> None: ...
+        @property
+        def exhaustive(self) -> bool:
+            """Whether to simulate all computational basis states instead of a random selection.
+
+            Only applies to :attr:`.StateType.computational_basis` stimuli and circuits with at most 20 (non-ancillary) qubits, in which case :attr:`max_sims` is set to the number of basis states.
+            The basis states are enumerated in Gray-code order, such that consecutive stimuli only differ in a single qubit and share most of their intermediate results in the compute tables.
+            If every simulation yields exactly the same output state for both circuits (including the phase), the circuits are proven to be equivalent.
+            Defaults to :code:`False`.
+            """
+
+        @exhaustive.setter
+        def exhaustive(self, arg: bool, /) -> None: ...
+        @property
+        def false_negative_bound(self) -> float:
+            r"""Stop the simulations once the probability that an existing error would have gone undetected by all simulations so far drops below this bound.
+
+            The probability is estimated from the assumed detection probabilities of the individual stimuli (see :attr:`basis_detection_probability`, :attr:`random_1q_detection_probability`, and :attr:`stabilizer_detection_probability`), i.e., after :math:`k_t` successful simulations with stimuli of type :math:`t`, it is bounded by :math:`\prod_t (1 - p_t)^{k_t}`.
+            The number of simulations is still limited by :attr:`max_sims`.
+            Defaults to :code:`0.`, which disables early stopping.
+            """
+
+        @false_negative_bound.setter
+        def false_negative_bound(self, arg: float, /) -> None: ...
+        @property
+        def basis_detection_probability(self) -> float:
+            """The assumed probability that a single :attr:`computational basis <.StateType.computational_basis>` stimulus detects an existing error.
+
+            Defaults to :code:`0.5`.
+            """
+
+        @basis_detection_probability.setter
+        def basis_detection_probability(self, arg: float, /) -> None: ...
+        @property
+        def random_1q_detection_probability(self) -> float:
+            """The assumed probability that a single :attr:`random single-qubit basis <.StateType.random_1q_basis>` stimulus detects an existing error.
+
+            Defaults to :code:`0.75`.
+            """
+
+        @random_1q_detection_probability.setter
+        def random_1q_detection_probability(self, arg: float, /) -> None: ...
+        @property
+        def stabilizer_detection_probability(self) -> float:
+            """The assumed probability that a single :attr:`stabilizer <.StateType.stabilizer>` stimulus detects an existing error.
+
+            Defaults to :code:`0.9`.
+            """
+
+        @stabilizer_detection_probability.setter
+        def stabilizer_detection_probability(self, arg: float, /) -> None: ...
+        @property
+        def adaptive_state_type(self) -> bool:
+            r"""Whether to choose the type of stimuli for each simulation run adaptively instead of always using :attr:`state_type`.
+
+            Each type is tried once, after which the simulations use the type that gathered the most evidence per second so far, where the evidence of a stimulus is :math:`-\log(1 - p_t)` for its detection probability :math:`p_t`.
+            Defaults to :code:`False`.
+            """
+
+        @adaptive_state_type.setter
+        def adaptive_state_type(self, arg: bool, /) -> None: ...
 
     class Parameterized:
         """Options that influence the equivalence checking scheme for parameterized circuits."""
@@ -385,6 +766,7 @@ class Configuration:
             The last instantiations initializes the parameters with random values to guarantee completeness of the equivalence check.
             Because random instantiation is costly, additional instantiations can be performed that lead to simpler equivalence checking instances as the random instantiation.
             This option changes how many of those additional checks are performed.
+            When checking in parallel, the instantiations are checked concurrently and the first non-equivalent instantiation (in the above order) is reported.
             """
 
         @additional_instantiations.setter
@@ -427,7 +809,10 @@ class EquivalenceCheckingManager:
     def __init__(
         self, circ1: mqt.core.ir.QuantumComputation, circ2: mqt.core.ir.QuantumComputation, config: Configuration = ...
     ) -> None:
-        """Create an equivalence checking manager for two circuits and configure it with a :class:`.Configuration` object."""
+        """Create an equivalence checking manager for two circuits and configure it with a :class:`.Configuration` object.
+
+        The circuits are copied and preprocessed without holding the GIL, so they must not be modified by other threads during the construction.
+        """
 
     class Results:
         """Captures the main results and statistics from :meth:`~.EquivalenceCheckingManager.run`."""
@@ -442,6 +827,18 @@ class EquivalenceCheckingManager:
         @preprocessing_time.setter
         def preprocessing_time(self, arg: float, /) -> None: ...
         @property
+        def preprocessing_cache_hits(self) -> int:
+            """Number of circuits whose preprocessing was served from the preprocessing cache."""
+
+        @preprocessing_cache_hits.setter
+        def preprocessing_cache_hits(self, arg: int, /) -> None: ...
+        @property
+        def decided_during_preprocessing(self) -> bool:
+            """Whether non-equivalence has already been shown by the simulations that ran while the circuits were preprocessed (see :attr:`~.Configuration.Execution.pipelined_preprocessing`)."""
+
+        @decided_during_preprocessing.setter
+        def decided_during_preprocessing(self, arg: bool, /) -> None: ...
+        @property
         def check_time(self) -> float:
             """Time spent during equivalence check (in seconds)."""
 
@@ -466,6 +863,12 @@ class EquivalenceCheckingManager:
         @performed_simulations.setter
         def performed_simulations(self, arg: int, /) -> None: ...
         @property
+        def false_negative_probability(self) -> float:
+            """Bound on the probability that an existing error went undetected by all successful simulations, based on the assumed detection probabilities of the stimuli."""
+
+        @false_negative_probability.setter
+        def false_negative_probability(self, arg: float, /) -> None: ...
+        @property
         def cex_input(self) -> mqt.core.dd.VectorDD:
             """DD representation of the initial state that produced a counterexample."""
 
@@ -484,12 +887,48 @@ class EquivalenceCheckingManager:
         @cex_output2.setter
         def cex_output2(self, arg: mqt.core.dd.VectorDD, /) -> None: ...
         @property
+        def cex_stimulus(self) -> int | None:
+            """Index of the stimulus that produced the counterexample, if the counterexample stems from a simulation.
+
+            Together with the :attr:`~.Configuration.Simulation.seed`, the index suffices to reproduce the counterexample.
+            """
+
+        @cex_stimulus.setter
+        def cex_stimulus(self, arg: int | None, /) -> None: ...
+        @property
+        def counterexample(self) -> EquivalenceCheckingManager.Counterexample | None:
+            """Compact description of the counterexample, if non-equivalence has been shown by a simulation.
+
+            In contrast to the counterexample decision diagrams, it remains valid after the decision diagram packages of the checkers have been released (see :attr:`~.Configuration.Execution.retain_counterexample_dds`).
+            """
+
+        @counterexample.setter
+        def counterexample(self, arg: EquivalenceCheckingManager.Counterexample | None, /) -> None: ...
+        @property
         def performed_instantiations(self) -> int:
             """Number of circuit instantiations performed during equivalence checking of parameterized quantum circuits."""
 
         @performed_instantiations.setter
         def performed_instantiations(self, arg: int, /) -> None: ...
         @property
+        def components(self) -> int:
+            """Number of independent qubit components that have been checked separately (0 if the check has not been decomposed).
+
+            See :attr:`~.Configuration.Optimizations.decompose_components`.
+            """
+
+        @components.setter
+        def components(self, arg: int, /) -> None: ...
+        @property
+        def slices(self) -> int:
+            """Number of slices that have been checked separately (0 if the circuits have not been sliced).
+
+            See :attr:`~.Configuration.Execution.slices`.
+            """
+
+        @slices.setter
+        def slices(self, arg: int, /) -> None: ...
+        @property
         def checker_results(self) -> dict[str, Any]:
             """Dictionary of the results of the individual checkers."""
 
@@ -501,6 +940,84 @@ class EquivalenceCheckingManager:
         def json(self) -> dict[str, Any]:
             """Returns a JSON-style dictionary of the results."""
 
+    class Progress:
+        """A snapshot of the progress of a running equivalence check (see :meth:`~.EquivalenceCheckingManager.set_progress_callback`)."""
+
+        class Checker:
+            """The progress of a single checker."""
+
+            @property
+            def name(self) -> str:
+                """The name of the checker."""
+
+            @property
+            def gates1(self) -> int:
+                """Number of gates of the first circuit applied so far."""
+
+            @property
+            def gates2(self) -> int:
+                """Number of gates of the second circuit applied so far."""
+
+            @property
+            def nodes(self) -> int:
+                """Size of the decision diagram (or number of vertices of the ZX-diagram) when it was last sampled."""
+
+            @property
+            def rewrites(self) -> int:
+                """Number of rewrites applied by the ZX checker."""
+
+        @property
+        def elapsed(self) -> float:
+            """Time since the start of the check (in seconds)."""
+
+        @property
+        def started_simulations(self) -> int:
+            """Number of simulations that have been started."""
+
+        @property
+        def performed_simulations(self) -> int:
+            """Number of simulations that have been finished successfully."""
+
+        @property
+        def checkers(self) -> list[EquivalenceCheckingManager.Progress.Checker]:
+            """The progress of the individual checkers."""
+
+    class Counterexample:
+        """A compact description of a counterexample that does not depend on any decision diagram package."""
+
+        class Amplitude:
+            """An amplitude of both output states of a counterexample."""
+
+            @property
+            def index(self) -> int:
+                """The index of the basis state."""
+
+            @property
+            def output1(self) -> complex:
+                """The amplitude of the first circuit's output state."""
+
+            @property
+            def output2(self) -> complex:
+                """The amplitude of the second circuit's output state."""
+
+        @property
+        def stimulus_type(self) -> StateType:
+            """The type of the stimulus that produced the counterexample."""
+
+        @property
+        def basis_state(self) -> int | None:
+            """Index of the input state if it is a computational basis state."""
+
+        @property
+        def amplitudes(self) -> list[EquivalenceCheckingManager.Counterexample.Amplitude]:
+            """The amplitudes in which both output states differ the most (in descending order of the difference).
+
+            Only recorded for circuits with at most 20 qubits (see :attr:`~.Configuration.Execution.counterexample_amplitudes`).
+            """
+
+        def json(self) -> dict[str, Any]:
+            """Returns a JSON-style dictionary of the counterexample."""
+
     @property
     def qc1(self) -> mqt.core.ir.QuantumComputation:
         """The first circuit to be checked."""
@@ -516,7 +1033,22 @@ class EquivalenceCheckingManager:
     @configuration.setter
     def configuration(self, arg: Configuration, /) -> None: ...
     def run(self) -> None:
-        """Execute the equivalence check as configured."""
+        """Execute the equivalence check as configured.
+
+        The GIL is released during the check, such that multiple managers can be run concurrently from different Python threads.
+        """
+
+    def set_progress_callback(self, callback: object | None, interval: float = 1.0) -> None:
+        """Report the progress of subsequent runs to a callback.
+
+        While a check is running, the callback is periodically invoked (from a separate thread) with a :class:`~.EquivalenceCheckingManager.Progress` snapshot.
+        A final snapshot is reported once the check has finished.
+        Exceptions raised by the callback stop the reporting and are re-raised once the check has finished.
+
+        Args:
+            callback: A callable taking a :class:`~.EquivalenceCheckingManager.Progress` object or :code:`None` to disable the reporting.
+            interval: The time between two snapshots (in seconds).
+        """
 
     @property
     def results(self) -> EquivalenceCheckingManager.Results:
@@ -543,6 +1075,143 @@ class EquivalenceCheckingManager:
             profile: The path to the profile file.
         """
 
+class BatchEquivalenceCheckingManager:
+    """Check the equivalence of many pairs of circuits at once.
+
+    All pairs are checked with the same :class:`.Configuration`.
+    The checkers of all pairs share a single pool of :attr:`~.Configuration.Execution.nthreads` worker threads and at most that many pairs are checked concurrently.
+    Circuits that are part of multiple pairs are only optimized once.
+    """
+
+    def __init__(self, config: Configuration = ...) -> None:
+        """Create a batch with the given :class:`.Configuration`."""
+
+    def add_circuit(self, circ: mqt.core.ir.QuantumComputation) -> int:
+        """Register a circuit with the batch.
+
+        Args:
+            circ: The circuit to register.
+
+        Returns:
+            The id of the circuit which can be used in :meth:`add_pair`.
+        """
+
+    @overload
+    def add_pair(self, circ1: int, circ2: int) -> int:
+        """Add a pair of previously registered circuits.
+
+        Args:
+            circ1: The id of the first circuit.
+            circ2: The id of the second circuit.
+
+        Returns:
+            The index of the pair.
+        """
+
+    @overload
+    def add_pair(self, circ1: mqt.core.ir.QuantumComputation, circ2: mqt.core.ir.QuantumComputation) -> int:
+        """Register both circuits and add them as a pair.
+
+        Args:
+            circ1: The first circuit.
+            circ2: The second circuit.
+
+        Returns:
+            The index of the pair.
+        """
+
+    def run(self, callback: object = None) -> None:
+        """Check all pairs that have been added.
+
+        Args:
+            callback: An optional callable that is invoked with the index and the :class:`~.EquivalenceCheckingManager.Results` of each pair as soon as it has been checked.
+                Counterexample decision diagrams are not retained in the results of a batch.
+        """
+
+    @property
+    def results(self) -> list[EquivalenceCheckingManager.Results]:
+        """The results of all pairs (in the order in which the pairs have been added)."""
+
+    @property
+    def configuration(self) -> Configuration:
+        """The configuration used for all pairs."""
+
+    @configuration.setter
+    def configuration(self, arg: Configuration, /) -> None: ...
+    def __len__(self) -> int: ...
+
+class IncrementalEquivalenceCheckingManager:
+    """Re-verify a pair of circuits after small edits of the second circuit.
+
+    Once the pair has been shown equivalent, an edited version of the second circuit is only checked in the window of operations in which it differs from the previous version.
+    Since all other operations are shared by both versions, this takes about as long as verifying the edited region.
+    Whenever this shortcut does not apply (e.g., the layouts changed or the window contains non-unitary operations) or is inconclusive, the full pair is checked.
+    """
+
+    def __init__(
+        self, circ1: mqt.core.ir.QuantumComputation, circ2: mqt.core.ir.QuantumComputation, config: Configuration = ...
+    ) -> None:
+        """Create a manager for the given pair of circuits.
+
+        The pair is not checked until :meth:`run` or :meth:`update` is called.
+        """
+
+    def run(self) -> EquivalenceCheckingManager.Results:
+        """Check the current pair from scratch.
+
+        Returns:
+            The results of the check.
+        """
+
+    @overload
+    def update(self, circ2: mqt.core.ir.QuantumComputation) -> EquivalenceCheckingManager.Results:
+        """Replace the second circuit with an edited version and re-verify the pair.
+
+        The edited window spans from the first to the last operation in which both versions differ.
+
+        Args:
+            circ2: The edited version of the second circuit.
+
+        Returns:
+            The results of the edited pair.
+        """
+
+    @overload
+    def update(self, circ2: mqt.core.ir.QuantumComputation, begin: int, end: int) -> EquivalenceCheckingManager.Results:
+        """Replace the second circuit with an edited version and re-verify the pair.
+
+        Args:
+            circ2: The edited version of the second circuit.
+            begin: The index of the first edited operation.
+            end: The index past the last edited operation of the previous version.
+                The operations ``[begin, end)`` of the previous version have been replaced by the operations ``[begin, end + len(circ2) - len(previous))`` of the edited version.
+
+        Returns:
+            The results of the edited pair.
+
+        Raises:
+            ValueError: If the range is invalid or both versions differ outside of it.
+        """
+
+    @property
+    def results(self) -> EquivalenceCheckingManager.Results:
+        """The results of the last check."""
+
+    @property
+    def decided_incrementally(self) -> bool:
+        """Whether the last check has been decided on the edited window alone."""
+
+    @property
+    def window_size(self) -> tuple[int, int]:
+        """The numbers of operations in the edited window of the previous and the edited version of the second circuit."""
+
+    @property
+    def configuration(self) -> Configuration:
+        """The configuration used for all checks."""
+
+    @configuration.setter
+    def configuration(self, arg: Configuration, /) -> None: ...
+
 class EquivalenceCriterion(enum.IntEnum):
     """Captures all the different notions of equivalence that can be the result of a :meth:`~.EquivalenceCheckingManager.run`."""
 
@@ -607,7 +1276,7 @@ class StateType(enum.IntEnum):
 
     stabilizer = 2
     """
-    Randomly choose a stabilizer state by creating a random Clifford circuit. Also referred to as *"global_random"*.
+    Randomly choose a stabilizer state as a random graph state with random local Clifford operations. Also referred to as *"global_random"*.
     """
 
     global_quantum = 2
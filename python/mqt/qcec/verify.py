@@ -10,6 +10,8 @@
 
 from __future__ import annotations
 
+import threading
+from concurrent.futures import ThreadPoolExecutor
 from typing import TYPE_CHECKING
 
 from mqt.core import load
@@ -20,6 +22,7 @@ from .pyqcec import Configuration, EquivalenceCheckingManager
 
 if TYPE_CHECKING:
     import os
+    from concurrent.futures import Executor, Future
 
     from mqt.core.ir import QuantumComputation
     from qiskit.circuit import QuantumCircuit
@@ -27,7 +30,7 @@ if TYPE_CHECKING:
     from ._compat.typing import Unpack
     from .configuration_options import ConfigurationOptions
 
-__all__ = ["verify"]
+__all__ = ["verify", "verify_async"]
 
 
 def __dir__() -> list[str]:
@@ -83,3 +86,44 @@ def verify(
 
     # obtain the result
     return ecm.results
+
+
+_executor: ThreadPoolExecutor | None = None
+_executor_lock = threading.Lock()
+
+
+def _default_executor() -> ThreadPoolExecutor:
+    """Return the executor shared by all asynchronous checks (created on first use)."""
+    global _executor  # noqa: PLW0603
+    with _executor_lock:
+        if _executor is None:
+            _executor = ThreadPoolExecutor(thread_name_prefix="mqt-qcec")
+        return _executor
+
+
+def verify_async(
+    circ1: QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+    circ2: QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+    configuration: Configuration | None = None,
+    executor: Executor | None = None,
+    **kwargs: Unpack[ConfigurationOptions],
+) -> Future[EquivalenceCheckingManager.Results]:
+    """Asynchronously verify that ``circ1`` and ``circ2`` are equivalent.
+
+    Schedules :func:`verify` on an executor and immediately returns a future for its results.
+    Since the equivalence check itself does not hold the GIL, many checks can be running at once.
+
+    Args:
+        circ1: The first circuit.
+        circ2: The second circuit.
+        configuration: The configuration to use for the equivalence checking process.
+        executor: The executor to run the check on.
+            Defaults to a thread pool that is shared by all asynchronous checks.
+        **kwargs: Keyword arguments to configure the equivalence checking process.
+
+    Returns:
+        A future for the results of the equivalence checking process.
+    """
+    if executor is None:
+        executor = _default_executor()
+    return executor.submit(verify, circ1, circ2, configuration, **kwargs)
@@ -0,0 +1,217 @@
+# Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+# Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+# All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Licensed under the MIT License
+
+"""Distribute the simulation checker across the workers of an executor."""
+
+from __future__ import annotations
+
+import random
+import threading
+import time
+import uuid
+from concurrent.futures import FIRST_COMPLETED, wait
+from typing import TYPE_CHECKING, Any
+
+from mqt.core import load
+from mqt.core.ir import QuantumComputation
+
+from .pyqcec import Configuration, EquivalenceCheckingManager, EquivalenceCriterion
+
+if TYPE_CHECKING:
+    import os
+    from concurrent.futures import Executor, Future
+
+    from qiskit.circuit import QuantumCircuit
+
+    from ._compat.typing import Unpack
+    from .configuration_options import ConfigurationOptions
+
+__all__ = ["verify_distributed"]
+
+
+def __dir__() -> list[str]:
+    return __all__
+
+
+# a circuit as OpenQASM together with its ancillary and garbage qubits, which OpenQASM cannot express
+_Circuit = tuple[str, tuple[int, ...], tuple[int, ...]]
+
+
+def _serialize(qc: QuantumComputation) -> _Circuit:
+    """Describe a circuit in a form that can be shipped to the workers."""
+    ancillary = tuple(q for q, is_ancillary in enumerate(qc.ancillary) if is_ancillary)
+    garbage = tuple(q for q, is_garbage in enumerate(qc.garbage) if is_garbage)
+    return qc.qasm3_str(), ancillary, garbage
+
+
+def _deserialize(circuit: _Circuit) -> QuantumComputation:
+    """Reconstruct a circuit described by :func:`_serialize`."""
+    qasm, ancillary, garbage = circuit
+    qc = QuantumComputation.from_qasm_str(qasm)
+    for q in ancillary:
+        qc.set_circuit_qubit_ancillary(q)
+    for q in garbage:
+        qc.set_circuit_qubit_garbage(q)
+    return qc
+
+
+# the manager of the most recent check of each worker thread
+_worker = threading.local()
+
+
+def _manager(
+    check: str, circ1: _Circuit, circ2: _Circuit, stimuli: int, options: dict[str, Any]
+) -> tuple[EquivalenceCheckingManager, int]:
+    """Get the manager of a check, which is set up (and preprocesses the circuits) only once per worker thread.
+
+    Returns:
+        The manager and the number of stimuli that are available, e.g., limited by the number of computational basis
+        states.
+    """
+    cached = getattr(_worker, "manager", None)
+    if cached is not None and cached[0] == check:
+        return cached[1], cached[2]
+
+    from .configuration_options import augment_config_from_kwargs  # noqa: PLC0415 to keep workers lightweight
+
+    configuration = Configuration()
+    augment_config_from_kwargs(configuration, **options)
+    configuration.simulation.first_stimulus = 0
+    configuration.simulation.max_sims = stimuli
+    # only keep one manager alive per thread
+    _worker.manager = None
+    ecm = EquivalenceCheckingManager(_deserialize(circ1), _deserialize(circ2), configuration)
+    available = ecm.configuration.simulation.max_sims
+    _worker.manager = (check, ecm, available)
+    return ecm, available
+
+
+def _simulate_range(
+    check: str, circ1: _Circuit, circ2: _Circuit, stimuli: int, first: int, count: int, options: dict[str, Any]
+) -> tuple[str | None, int, int | None]:
+    """Simulate the stimuli ``first, ..., first + count - 1`` (executed by the workers).
+
+    Returns:
+        The name of the equivalence criterion (or nothing if there are no such stimuli, e.g., beyond the number of
+        computational basis states), the number of performed simulations, and the index of the stimulus that
+        produced a counterexample (if any).
+    """
+    ecm, available = _manager(check, circ1, circ2, stimuli, options)
+    count = min(count, available - first)
+    if count <= 0:
+        return None, 0, None
+    ecm.configuration.simulation.first_stimulus = first
+    ecm.configuration.simulation.max_sims = count
+    ecm.run()
+    results = ecm.results
+    return results.equivalence.name, results.performed_simulations, results.cex_stimulus
+
+
+def verify_distributed(
+    circ1: QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+    circ2: QuantumComputation | str | os.PathLike[str] | QuantumCircuit,
+    executor: Executor,
+    stimuli: int,
+    stimuli_per_task: int = 256,
+    **kwargs: Unpack[ConfigurationOptions],
+) -> EquivalenceCheckingManager.Results:
+    """Verify ``circ1`` and ``circ2`` by simulations distributed across the workers of ``executor``.
+
+    The ``stimuli`` stimuli are split into disjoint ranges of at most ``stimuli_per_task`` stimuli,
+    each of which is simulated by a separate task on the executor.
+    Any :class:`~concurrent.futures.Executor` can be used, e.g., a :class:`~concurrent.futures.ProcessPoolExecutor`
+    on a single machine or an ``mpi4py.futures.MPIPoolExecutor`` spanning the nodes of a cluster.
+    The circuits are shipped as OpenQASM together with their ancillary and garbage qubits.
+    Every worker thread parses and preprocesses them only once and reuses its manager for all ranges it simulates.
+    Since every stimulus only depends on the seed and its index, the tasks neither overlap nor need to communicate.
+    As soon as one task shows non-equivalence, all pending tasks are cancelled.
+    Tasks that are already running finish their (bounded) range of stimuli.
+
+    Only the simulation checker is run by the workers.
+    Hence, the result is at most :attr:`~.EquivalenceCriterion.probably_equivalent`.
+    A counterexample is reported by its :attr:`~.EquivalenceCheckingManager.Results.cex_stimulus`,
+    which reproduces it via :func:`.verify` with the same seed, ``first_stimulus=cex_stimulus``, and ``max_sims=1``.
+
+    Args:
+        circ1: The first circuit.
+        circ2: The second circuit.
+        executor: The executor whose workers run the simulations.
+        stimuli: The total number of stimuli to simulate.
+        stimuli_per_task: The maximal number of stimuli simulated by a single task.
+        **kwargs: Keyword arguments to configure the equivalence checking process of the workers.
+            If no (non-zero) ``seed`` is given, a random seed is chosen, which is shared by all workers.
+
+    Returns:
+        The combined results of all tasks.
+
+    Raises:
+        ValueError: If the circuits are parameterized or the numbers of stimuli are invalid.
+    """
+    if stimuli <= 0 or stimuli_per_task <= 0:
+        msg = "The numbers of stimuli must be positive."
+        raise ValueError(msg)
+
+    qc1 = load(circ1)
+    qc2 = load(circ2)
+    if not qc1.is_variable_free() or not qc2.is_variable_free():
+        msg = "Distributed simulation does not support parameterized circuits."
+        raise ValueError(msg)
+
+    options: dict[str, Any] = dict(kwargs)
+    if not options.get("seed"):
+        options["seed"] = random.SystemRandom().randrange(1, 2**63)
+    options.update(
+        run_simulation_checker=True,
+        run_alternating_checker=False,
+        run_construction_checker=False,
+        run_zx_checker=False,
+        exhaustive=False,
+    )
+
+    check = uuid.uuid4().hex
+    circuit1 = _serialize(qc1)
+    circuit2 = _serialize(qc2)
+    start = time.perf_counter()
+    counts: dict[Future[tuple[str | None, int, int | None]], int] = {}
+    for first in range(0, stimuli, stimuli_per_task):
+        count = min(stimuli_per_task, stimuli - first)
+        future = executor.submit(_simulate_range, check, circuit1, circuit2, stimuli, first, count, options)
+        counts[future] = count
+    pending = set(counts)
+
+    results = EquivalenceCheckingManager.Results()
+    results.started_simulations = stimuli
+    results.equivalence = EquivalenceCriterion.no_information
+    inconclusive = False
+    while pending:
+        finished, pending = wait(pending, return_when=FIRST_COMPLETED)
+        for future in finished:
+            if future.cancelled():
+                continue
+            name, performed, cex_stimulus = future.result()
+            if name is None:
+                results.started_simulations -= counts[future]
+                continue
+            results.performed_simulations += performed
+            if EquivalenceCriterion[name] == EquivalenceCriterion.not_equivalent:
+                results.equivalence = EquivalenceCriterion.not_equivalent
+                # report the smallest counterexample found, independent of the order of completion
+                if cex_stimulus is not None and (results.cex_stimulus is None or cex_stimulus < results.cex_stimulus):
+                    results.cex_stimulus = cex_stimulus
+            elif EquivalenceCriterion[name] == EquivalenceCriterion.no_information:
+                inconclusive = True
+        if results.equivalence == EquivalenceCriterion.not_equivalent:
+            for future in pending:
+                if future.cancel():
+                    results.started_simulations -= counts[future]
+            break
+
+    if results.equivalence != EquivalenceCriterion.not_equivalent and not inconclusive:
+        results.equivalence = EquivalenceCriterion.probably_equivalent
+    results.check_time = time.perf_counter() - start
+    return results
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "BatchEquivalenceCheckingManager.hpp"
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "SubproblemScheduler.hpp"
+#include "ThreadPool.hpp"
+#include "ToleranceLease.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+std::size_t BatchEquivalenceCheckingManager::addCircuit(
+    const qc::QuantumComputation& circ) {
+  circuits.emplace_back(std::make_shared<const qc::QuantumComputation>(circ));
+  return circuits.size() - 1U;
+}
+
+std::size_t
+BatchEquivalenceCheckingManager::addCircuit(qc::QuantumComputation&& circ) {
+  circuits.emplace_back(
+      std::make_shared<const qc::QuantumComputation>(std::move(circ)));
+  return circuits.size() - 1U;
+}
+
+std::size_t BatchEquivalenceCheckingManager::addCircuit(
+    std::shared_ptr<const qc::QuantumComputation> circ) {
+  circuits.emplace_back(std::move(circ));
+  return circuits.size() - 1U;
+}
+
+std::size_t BatchEquivalenceCheckingManager::addPair(const std::size_t circ1,
+                                                      const std::size_t circ2) {
+  if (circ1 >= circuits.size() || circ2 >= circuits.size()) {
+    throw std::out_of_range("Unknown circuit id in batch.");
+  }
+  pairs.emplace_back(circ1, circ2);
+  return pairs.size() - 1U;
+}
+
+void BatchEquivalenceCheckingManager::run(const ResultCallback& callback) {
+  results.assign(pairs.size(), Results{});
+  if (pairs.empty()) {
+    return;
+  }
+
+  const auto nthreads =
+      std::max<std::size_t>(1U, configuration.execution.nthreads);
+  if (!threadPool || (ownsThreadPool && threadPool->size() != nthreads)) {
+    threadPool = std::make_shared<ThreadPool>(nthreads);
+    ownsThreadPool = true;
+  }
+
+  // the equivalence checking manager only optimizes circuits if both circuits
+  // of a pair are variable-free
+  std::vector<bool> optimize(circuits.size(), false);
+  for (const auto& [id1, id2] : pairs) {
+    if (circuits[id1]->isVariableFree() && circuits[id2]->isVariableFree()) {
+      optimize[id1] = true;
+      optimize[id2] = true;
+    }
+  }
+
+  // run the optimization passes once per circuit (in parallel)
+  std::vector<std::shared_ptr<const qc::QuantumComputation>> optimized(
+      circuits.size());
+  std::vector<double> optimizationTimes(circuits.size(), 0.);
+  std::vector<std::exception_ptr> optimizationErrors(circuits.size());
+  {
+    std::vector<std::future<void>> futures{};
+    for (std::size_t i = 0U; i < circuits.size(); ++i) {
+      if (!optimize[i]) {
+        continue;
+      }
+      futures.emplace_back(threadPool->submit([&, i] {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+          auto circ = std::make_shared<qc::QuantumComputation>(*circuits[i]);
+          EquivalenceCheckingManager::optimizeCircuit(
+              *circ, configuration.optimizations);
+          optimized[i] = std::move(circ);
+        } catch (...) {
+          optimizationErrors[i] = std::current_exception();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        optimizationTimes[i] =
+            std::chrono::duration<double>(end - start).count();
+      }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+
+  // the gate cost profile is loaded once and shared by all pairs
+  EquivalenceCheckingManager::loadGateCostProfile(configuration);
+
+  // the pairs are tasks on the pool itself (with the calling thread checking
+  // pairs, too), so at most as many threads as the pool has are busy. Fewer
+  // pairs than threads keep the parallel flow and run their checkers on the
+  // remaining threads of the pool. Otherwise, every thread checks one pair at
+  // a time with the sequential flow.
+  auto pairConfiguration = configuration;
+  SubproblemScheduler::Options options{};
+  options.threadPool = threadPool;
+  const auto workers = std::max<std::size_t>(1U, threadPool->size());
+  const bool parallelPairs =
+      configuration.execution.parallel && pairs.size() < workers;
+  options.concurrency = parallelPairs ? pairs.size() : workers;
+  pairConfiguration.execution.parallel = parallelPairs;
+  // pairs checked concurrently let all of their checkers share the same
+  // numerical tolerance. Since it is a global setting of the DD package, it is
+  // claimed once by the batch and the pairs are checked by nested managers.
+  const bool nested = options.concurrency > 1U;
+  std::optional<ToleranceLease> lease{};
+  if (nested) {
+    pairConfiguration.shareTolerance();
+    lease.emplace(pairConfiguration.sharedTolerance(), false);
+  }
+
+  const auto factory =
+      [&](const std::size_t index, const Configuration& config)
+      -> std::unique_ptr<EquivalenceCheckingManager> {
+    const auto [id1, id2] = pairs[index];
+    const bool preoptimized = optimize[id1] && optimize[id2];
+    if (preoptimized) {
+      for (const auto id : {id1, id2}) {
+        if (optimizationErrors[id]) {
+          std::rethrow_exception(optimizationErrors[id]);
+        }
+      }
+    }
+
+    // the circuits are shared with the manager, which only copies them if its
+    // remaining preprocessing has to modify them
+    auto ecm = std::unique_ptr<EquivalenceCheckingManager>(
+        new EquivalenceCheckingManager(
+            preoptimized ? optimized[id1] : circuits[id1],
+            preoptimized ? optimized[id2] : circuits[id2], config,
+            preoptimized, preoptimized, nested));
+    if (parallelPairs) {
+      ecm->setThreadPool(threadPool);
+    }
+    return ecm;
+  };
+
+  // the scheduler serializes its callbacks
+  const auto report = [&](const std::size_t index, const Results& res) {
+    results[index] = res;
+    const auto [id1, id2] = pairs[index];
+    if (optimize[id1] && optimize[id2]) {
+      results[index].preprocessingTime +=
+          optimizationTimes[id1] + optimizationTimes[id2];
+    }
+    if (callback) {
+      callback(index, results[index]);
+    }
+  };
+
+  SubproblemScheduler scheduler(std::move(options));
+  static_cast<void>(
+      scheduler.run(pairs.size(), pairConfiguration, factory, report));
+}
+} // namespace ec
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CircuitSlicing.hpp"
+
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+namespace {
+bool sliceable(const qc::QuantumComputation& qc, const std::size_t n) {
+  const auto inRange = [n](const auto& pair) {
+    return pair.first < n && pair.second < n;
+  };
+  return qc.getNqubits() == n && qc.getNancillae() == 0U &&
+         qc.getNgarbageQubits() == 0U && qc.initialLayout.size() == n &&
+         qc.outputPermutation.size() == n &&
+         std::ranges::all_of(qc.initialLayout, inRange) &&
+         std::ranges::all_of(qc.outputPermutation, inRange) &&
+         std::ranges::all_of(qc, [](const auto& op) {
+           return op->getType() == qc::Barrier || op->isUnitary();
+         });
+}
+
+// the positions of the barriers that act on all qubits
+std::vector<std::size_t> fullBarriers(const qc::QuantumComputation& qc) {
+  std::vector<std::size_t> positions{};
+  for (std::size_t i = 0U; i < qc.size(); ++i) {
+    const auto& op = qc.at(i);
+    if (op->getType() == qc::Barrier &&
+        op->getUsedQubits().size() == qc.getNqubits()) {
+      positions.emplace_back(i);
+    }
+  }
+  return positions;
+}
+
+// the positions (of operations) at which slices end, with the number of
+// operations as the last position
+std::vector<std::size_t> proportionalCuts(const qc::QuantumComputation& qc,
+                                          const std::size_t slices) {
+  std::vector<std::size_t> gates{};
+  for (std::size_t i = 0U; i < qc.size(); ++i) {
+    if (qc.at(i)->getType() != qc::Barrier) {
+      gates.emplace_back(i);
+    }
+  }
+  std::vector<std::size_t> cuts{};
+  for (std::size_t s = 1U; s < slices; ++s) {
+    cuts.emplace_back(gates[(s * gates.size()) / slices]);
+  }
+  cuts.emplace_back(qc.size());
+  return cuts;
+}
+
+// cut the circuit before each of the given positions (barriers at a cut are
+// dropped)
+std::vector<qc::QuantumComputation>
+cut(const qc::QuantumComputation& qc, const std::vector<std::size_t>& cuts) {
+  std::vector<qc::QuantumComputation> slices{};
+  slices.reserve(cuts.size());
+  auto layout = qc.initialLayout;
+  std::size_t position = 0U;
+  for (const auto end : cuts) {
+    auto& slice = slices.emplace_back(qc.getNqubits());
+    slice.initialLayout = layout;
+    for (; position < end; ++position) {
+      const auto& op = qc.at(position);
+      if (op->getType() == qc::SWAP && !op->isControlled()) {
+        // SWAPs only change the layout (as in the task managers)
+        const auto& targets = op->getTargets();
+        std::swap(layout.at(targets[0]), layout.at(targets[1]));
+      }
+      slice.emplace_back(op->clone());
+    }
+    slice.outputPermutation = layout;
+    if (position < qc.size() && qc.at(position)->getType() == qc::Barrier) {
+      ++position;
+    }
+  }
+  slices.back().outputPermutation = qc.outputPermutation;
+  slices.front().gphase(qc.getGlobalPhase());
+  return slices;
+}
+} // namespace
+
+std::vector<SlicePair> sliceAtCutPoints(const qc::QuantumComputation& qc1,
+                                        const qc::QuantumComputation& qc2,
+                                        const std::size_t slices) {
+  const auto n = qc1.getNqubits();
+  if (n == 0U || slices < 2U || !sliceable(qc1, n) || !sliceable(qc2, n)) {
+    return {};
+  }
+
+  // explicit barriers in both circuits take precedence
+  auto cuts1 = fullBarriers(qc1);
+  auto cuts2 = fullBarriers(qc2);
+  if (!cuts1.empty() && cuts1.size() == cuts2.size()) {
+    cuts1.emplace_back(qc1.size());
+    cuts2.emplace_back(qc2.size());
+  } else {
+    const auto gates = [](const qc::QuantumComputation& qc) {
+      return static_cast<std::size_t>(
+          std::ranges::count_if(qc, [](const auto& op) {
+            return op->getType() != qc::Barrier;
+          }));
+    };
+    if (std::min(gates(qc1), gates(qc2)) < slices * MIN_SLICE_SIZE) {
+      return {};
+    }
+    cuts1 = proportionalCuts(qc1, slices);
+    cuts2 = proportionalCuts(qc2, slices);
+  }
+
+  auto slices1 = cut(qc1, cuts1);
+  auto slices2 = cut(qc2, cuts2);
+  std::vector<SlicePair> pairs{};
+  pairs.reserve(slices1.size());
+  for (std::size_t i = 0U; i < slices1.size(); ++i) {
+    pairs.emplace_back(std::move(slices1[i]), std::move(slices2[i]));
+  }
+  return pairs;
+}
+} // namespace ec
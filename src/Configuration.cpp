@@ -13,6 +13,8 @@
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <nlohmann/json.hpp>
 #include <ostream>
 
@@ -20,12 +22,14 @@ namespace ec {
 bool Configuration::anythingToExecute() const noexcept {
   return (execution.runSimulationChecker && simulation.maxSims > 0U) ||
          execution.runAlternatingChecker || execution.runConstructionChecker ||
-         execution.runZXChecker;
+         execution.runZXChecker || execution.runCliffordChecker;
 }
 
 bool Configuration::onlySingleTask() const noexcept {
-  // only a single simulation shall be performed
-  if (execution.runSimulationChecker && (simulation.maxSims == 1U) &&
+  // only a single simulation run shall be performed
+  if (execution.runSimulationChecker &&
+      (simulation.maxSims <=
+       std::max<std::size_t>(1U, simulation.stimuliPerRun)) &&
       !execution.runAlternatingChecker && !execution.runConstructionChecker &&
       !execution.runZXChecker) {
     return true;
@@ -33,8 +37,10 @@ bool Configuration::onlySingleTask() const noexcept {
 
   // no simulations and only one of the other checks shall be performed
   if (!execution.runSimulationChecker &&
-      ((execution.runAlternatingChecker && !execution.runConstructionChecker &&
-        !execution.runZXChecker) ||
+      // a portfolio of alternating checkers is not a single task
+      ((execution.runAlternatingChecker &&
+        application.alternatingPortfolio.empty() &&
+        !execution.runConstructionChecker && !execution.runZXChecker) ||
        (!execution.runAlternatingChecker && execution.runConstructionChecker &&
         !execution.runZXChecker) ||
        (!execution.runAlternatingChecker && !execution.runConstructionChecker &&
@@ -55,17 +61,84 @@ bool Configuration::onlySimulationCheckerConfigured() const noexcept {
          !execution.runAlternatingChecker && !execution.runZXChecker;
 }
 
+dd::fp Configuration::checkerTolerance(const dd::fp tolerance) const noexcept {
+  return tolerance > 0. ? tolerance : execution.numericalTolerance;
+}
+
+dd::fp Configuration::sharedTolerance() const noexcept {
+  auto tolerance = execution.numericalTolerance;
+  bool configured = false;
+  const auto consider = [&](const bool run, const dd::fp checker) {
+    if (!run) {
+      return;
+    }
+    const auto value = checkerTolerance(checker);
+    tolerance = configured ? std::min(tolerance, value) : value;
+    configured = true;
+  };
+  consider(execution.runSimulationChecker, execution.simulationTolerance);
+  consider(execution.runAlternatingChecker, execution.alternatingTolerance);
+  consider(execution.runConstructionChecker, execution.constructionTolerance);
+  return tolerance;
+}
+
+bool Configuration::uniformTolerance() const noexcept {
+  const auto shared = sharedTolerance();
+  const auto uniform = [&](const bool run, const dd::fp checker) {
+    return !run || checkerTolerance(checker) == shared;
+  };
+  return uniform(execution.runSimulationChecker,
+                 execution.simulationTolerance) &&
+         uniform(execution.runAlternatingChecker,
+                 execution.alternatingTolerance) &&
+         uniform(execution.runConstructionChecker,
+                 execution.constructionTolerance);
+}
+
+void Configuration::shareTolerance() noexcept {
+  execution.numericalTolerance = sharedTolerance();
+  execution.simulationTolerance = 0.;
+  execution.alternatingTolerance = 0.;
+  execution.constructionTolerance = 0.;
+}
+
 nlohmann::basic_json<> Configuration::json() const {
   nlohmann::basic_json<> config{};
   auto& exe = config["execution"];
   exe["tolerance"] = execution.numericalTolerance;
+  if (execution.simulationTolerance > 0.) {
+    exe["simulation_tolerance"] = execution.simulationTolerance;
+  }
+  if (execution.alternatingTolerance > 0.) {
+    exe["alternating_tolerance"] = execution.alternatingTolerance;
+  }
+  if (execution.constructionTolerance > 0.) {
+    exe["construction_tolerance"] = execution.constructionTolerance;
+  }
   exe["parallel"] = execution.parallel;
   exe["nthreads"] = execution.nthreads;
   exe["run_construction_checker"] = execution.runConstructionChecker;
   exe["run_simulation_checker"] = execution.runSimulationChecker;
   exe["run_alternating_checker"] = execution.runAlternatingChecker;
   exe["run_zx_checker"] = execution.runZXChecker;
+  exe["run_clifford_checker"] = execution.runCliffordChecker;
   exe["timeout"] = execution.timeout;
+  if (!execution.checkpointFile.empty()) {
+    exe["checkpoint_file"] = execution.checkpointFile;
+    exe["checkpoint_interval"] = execution.checkpointInterval;
+  }
+  exe["construction_threads"] = execution.constructionThreads;
+  exe["slices"] = execution.slices;
+  exe["pipelined_preprocessing"] = execution.pipelinedPreprocessing;
+  exe["gc_interval"] = execution.gcInterval;
+  exe["gc_memory_threshold"] = execution.gcMemoryThreshold;
+  exe["dd_unique_table_buckets"] = execution.ddUniqueTableBuckets;
+  exe["dd_compute_table_buckets"] = execution.ddComputeTableBuckets;
+  exe["memory_limit"] = execution.memoryLimit;
+  exe["checker_memory_limit"] = execution.checkerMemoryLimit;
+  exe["instrumentation"] = execution.instrumentation;
+  exe["counterexample_amplitudes"] = execution.counterexampleAmplitudes;
+  exe["retain_counterexample_dds"] = execution.retainCounterexampleDDs;
 
   auto& opt = config["optimizations"];
   opt["fuse_consecutive_single_qubit_gates"] =
@@ -78,6 +151,13 @@ nlohmann::basic_json<> Configuration::json() const {
   opt["backpropagate_output_permutation"] =
       optimizations.backpropagateOutputPermutation;
   opt["elide_permutations"] = optimizations.elidePermutations;
+  opt["strip_common_gates"] = optimizations.stripCommonGates;
+  opt["decompose_components"] = optimizations.decomposeComponents;
+  opt["cache_preprocessing"] = optimizations.cachePreprocessing;
+  if (!optimizations.preprocessingCacheDirectory.empty()) {
+    opt["preprocessing_cache_directory"] =
+        optimizations.preprocessingCacheDirectory;
+  }
 
   auto& app = config["application"];
   app["construction"] = ec::toString(application.constructionScheme);
@@ -85,9 +165,21 @@ nlohmann::basic_json<> Configuration::json() const {
   app["alternating"] = ec::toString(application.alternatingScheme);
   if (!application.profile.empty()) {
     app["profile"] = application.profile;
+  } else if (!application.profileStore.empty()) {
+    app["profile_store"] = application.profileStore;
   } else {
     app["profile"] = "cost_function";
   }
+  app["lookahead_estimate_threshold"] = application.lookaheadEstimateThreshold;
+  app["lookahead_multiplication_budget"] =
+      application.lookaheadMultiplicationBudget;
+  if (!application.alternatingPortfolio.empty()) {
+    auto& portfolio = app["alternating_portfolio"];
+    portfolio = nlohmann::json::array();
+    for (const auto scheme : application.alternatingPortfolio) {
+      portfolio.push_back(ec::toString(scheme));
+    }
+  }
 
   auto& par = config["parameterized"];
   par["tolerance"] = parameterized.parameterizedTol;
@@ -96,12 +188,23 @@ nlohmann::basic_json<> Configuration::json() const {
   auto& fun = config["functionality"];
   fun["trace_threshold"] = functionality.traceThreshold;
   fun["check_partial_equivalence"] = functionality.checkPartialEquivalence;
+  fun["zx_stall_rounds"] = functionality.zxStallRounds;
 
   auto& sim = config["simulation"];
   sim["fidelity_threshold"] = simulation.fidelityThreshold;
   sim["max_sims"] = simulation.maxSims;
   sim["state_type"] = ec::toString(simulation.stateType);
   sim["seed"] = simulation.seed;
+  sim["first_stimulus"] = simulation.firstStimulus;
+  sim["stimuli_per_run"] = simulation.stimuliPerRun;
+  sim["exhaustive"] = simulation.exhaustive;
+  sim["false_negative_bound"] = simulation.falseNegativeBound;
+  sim["basis_detection_probability"] = simulation.basisDetectionProbability;
+  sim["random_1q_detection_probability"] =
+      simulation.random1QDetectionProbability;
+  sim["stabilizer_detection_probability"] =
+      simulation.stabilizerDetectionProbability;
+  sim["adaptive_state_type"] = simulation.adaptiveStateType;
 
   return config;
 }
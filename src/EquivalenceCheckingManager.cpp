@@ -10,202 +10,445 @@
 
 #include "EquivalenceCheckingManager.hpp"
 
+#include "CircuitSlicing.hpp"
 #include "EquivalenceCriterion.hpp"
-#include "ThreadSafeQueue.hpp"
+#include "ParameterInstantiation.hpp"
+#include "PreprocessingCache.hpp"
+#include "QubitComponents.hpp"
+#include "ResultChannel.hpp"
+#include "SubproblemScheduler.hpp"
+#include "ThreadPool.hpp"
+#include "ToleranceLease.hpp"
+#include "checker/clifford/CliffordChecker.hpp"
 #include "checker/dd/DDAlternatingChecker.hpp"
 #include "checker/dd/DDConstructionChecker.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
 #include "checker/dd/DDSimulationChecker.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 #include "checker/zx/ZXChecker.hpp"
 #include "circuit_optimizer/CircuitOptimizer.hpp"
-#include "dd/ComplexNumbers.hpp"
+#include "dd/Node.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
 #include "zx/FunctionalityConstruction.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <complex>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <future>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <optional>
+#include <random>
 #include <ranges>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace ec {
 
 namespace {
-// Decrement logical qubit indices in the layout that exceed logicalQubitIndex
-void decrementLogicalQubitsInLayoutAboveIndex(
-    qc::Permutation& layout, const qc::Qubit logicalQubitIndex) {
-  for (auto& [physical, logical] : layout) {
-    if (logical > logicalQubitIndex) {
-      --logical;
+// Remove the given logical qubits from the circuit and compact the logical
+// qubit indices of its layouts in a single pass afterwards
+void removeLogicalQubits(qc::QuantumComputation& qc,
+                         std::vector<qc::Qubit> logicalQubits) {
+  if (logicalQubits.empty()) {
+    return;
+  }
+  // removing the qubits from the highest index downwards leaves the indices of
+  // all remaining lower qubits untouched, so that no intermediate compaction
+  // is necessary
+  std::ranges::sort(logicalQubits, std::greater{});
+  for (const auto logical : logicalQubits) {
+    qc.removeQubit(logical);
+  }
+  std::ranges::reverse(logicalQubits);
+  const auto compact = [&logicalQubits](qc::Permutation& layout) {
+    for (auto& [physical, logical] : layout) {
+      logical -= static_cast<qc::Qubit>(
+          std::ranges::lower_bound(logicalQubits, logical) -
+          logicalQubits.begin());
+    }
+  };
+  compact(qc.initialLayout);
+  compact(qc.outputPermutation);
+}
+
+// The layouts of a circuit indexed by logical qubit, such that the conditions
+// for removing a qubit can be checked without searching the layouts
+class LayoutIndex {
+public:
+  explicit LayoutIndex(const qc::QuantumComputation& qc) : circuit(&qc) {
+    physicalQubits.reserve(circuit->initialLayout.size());
+    for (const auto& [physical, logical] : circuit->initialLayout) {
+      physicalQubits.emplace(logical, physical);
+    }
+    outputLogicalQubits.reserve(circuit->outputPermutation.size());
+    for (const auto& [physical, logical] : circuit->outputPermutation) {
+      outputLogicalQubits.emplace(logical);
+    }
+  }
+
+  /// The physical qubit the logical qubit is initially mapped to
+  [[nodiscard]] std::optional<qc::Qubit>
+  physicalQubit(const qc::Qubit logical) const {
+    if (const auto it = physicalQubits.find(logical);
+        it != physicalQubits.end()) {
+      return it->second;
+    }
+    return std::nullopt;
+  }
+
+  // a qubit can only be removed if it is not used in the output permutation or
+  // if it is used in the output permutation and the logical qubit index
+  // matches the logical qubit index in the output permutation for the physical
+  // qubit index in question, which indicates that nothing has happened to the
+  // qubit.
+  [[nodiscard]] bool safeToRemove(const qc::Qubit physical,
+                                  const qc::Qubit logical) const {
+    if (const auto it = circuit->outputPermutation.find(physical);
+        it != circuit->outputPermutation.end()) {
+      return it->second == logical;
+    }
+    return !outputLogicalQubits.contains(logical);
+  }
+
+private:
+  const qc::QuantumComputation* circuit;
+  std::unordered_map<qc::Qubit, qc::Qubit> physicalQubits;
+  std::unordered_set<qc::Qubit> outputLogicalQubits;
+};
+
+// periodically invokes a report function on a separate thread until stopped
+class ProgressReporter {
+public:
+  ProgressReporter(std::function<void()> reportFunction, const double interval)
+      : report(std::move(reportFunction)) {
+    if (!report) {
+      return;
+    }
+    thread = std::thread([this, period = std::chrono::duration<double>(
+                                    interval)] {
+      std::unique_lock lock(mutex);
+      while (!cond.wait_for(lock, period, [this] { return stopped; })) {
+        lock.unlock();
+        try {
+          report();
+        } catch (...) {
+          error = std::current_exception();
+          return;
+        }
+        lock.lock();
+      }
+    });
+  }
+
+  ProgressReporter(const ProgressReporter&) = delete;
+  ProgressReporter& operator=(const ProgressReporter&) = delete;
+  ProgressReporter(ProgressReporter&&) = delete;
+  ProgressReporter& operator=(ProgressReporter&&) = delete;
+
+  ~ProgressReporter() { join(); }
+
+  // stop reporting and rethrow the exception of a failed report (if any)
+  void stop() {
+    join();
+    if (error) {
+      std::rethrow_exception(std::exchange(error, nullptr));
+    }
+  }
+
+private:
+  std::function<void()> report;
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool stopped = false;
+  std::exception_ptr error;
+
+  void join() {
+    if (!thread.joinable()) {
+      return;
     }
+    {
+      const std::lock_guard lock(mutex);
+      stopped = true;
+    }
+    cond.notify_one();
+    thread.join();
+  }
+};
+
+// copy a shared circuit so that it can be modified without affecting others
+qc::QuantumComputation&
+makeModifiable(std::shared_ptr<const qc::QuantumComputation>& circ,
+               std::shared_ptr<qc::QuantumComputation>& owned) {
+  if (!owned) {
+    owned = std::make_shared<qc::QuantumComputation>(*circ);
+    circ = owned;
+  }
+  return *owned;
+}
+
+// mark all ancillary qubits of a circuit as garbage
+void setAncillaeGarbage(std::shared_ptr<const qc::QuantumComputation>& circ,
+                        std::shared_ptr<qc::QuantumComputation>& owned) {
+  for (qc::Qubit q = 0; q < circ->getNqubits(); ++q) {
+    if (circ->logicalQubitIsAncillary(q) && !circ->logicalQubitIsGarbage(q)) {
+      makeModifiable(circ, owned).setLogicalQubitGarbage(q);
+    }
+  }
+}
+
+// the (physical) qubits of the layout no operation acts on, determined in a
+// single pass over the circuit (which stops as soon as no qubit is left)
+std::unordered_set<qc::Qubit> idleQubits(const qc::QuantumComputation& qc) {
+  std::unordered_set<qc::Qubit> idle{};
+  idle.reserve(qc.initialLayout.size());
+  for (const auto& [physical, logical] : qc.initialLayout) {
+    idle.emplace(physical);
+  }
+  for (const auto& op : qc) {
+    if (idle.empty()) {
+      break;
+    }
+    for (const auto qubit : op->getUsedQubits()) {
+      idle.erase(qubit);
+    }
+  }
+  return idle;
+}
+
+// track the layout across an uncontrolled SWAP (as the task managers do).
+// Returns false if the SWAP acts on a qubit that is not part of the layout.
+bool trackSwap(const qc::Operation& op, qc::Permutation& layout) {
+  if (op.getType() != qc::SWAP || op.isControlled()) {
+    return true;
+  }
+  const auto& targets = op.getTargets();
+  if (!layout.contains(targets[0]) || !layout.contains(targets[1])) {
+    return false;
+  }
+  std::swap(layout.at(targets[0]), layout.at(targets[1]));
+  return true;
+}
+
+[[noreturn]] void throwUnsupportedDynamicCircuit() {
+  throw std::runtime_error(
+      "One of the circuits contains mid-circuit non-unitary primitives. "
+      "To verify such circuits, the checker must be configured with "
+      "`transformDynamicCircuit=true` (`transform_dynamic_circuits=True` "
+      "in Python).");
+}
+
+// the minimal number of operations of both circuits for which their
+// optimization passes are run concurrently. Below, starting a thread costs
+// more than it saves.
+constexpr std::size_t MIN_CONCURRENT_PREPROCESSING_OPS = 256U;
+
+// run two independent preprocessing steps, the second one on a separate
+// thread if requested. Exceptions of either step are propagated.
+void runIndependently(const bool concurrent, const std::function<void()>& first,
+                      const std::function<void()>& second) {
+  if (!concurrent) {
+    first();
+    second();
+    return;
   }
+  // not run on the thread pool, whose workers might all be busy with the
+  // checks of another manager sharing it
+  auto task = std::async(std::launch::async, second);
+  first();
+  task.get();
+}
+
+// the configuration of the simulations that run while the circuits are
+// preprocessed. Only the passes that change the functionality under
+// consideration (e.g., the transformation of dynamic circuits) are applied to
+// the circuits, so that the simulations can start right away.
+Configuration speculativeConfiguration(Configuration config) {
+  // the simulations run concurrently with the checks of the outer manager
+  config.shareTolerance();
+
+  auto& optimizations = config.optimizations;
+  optimizations.fuseSingleQubitGates = false;
+  optimizations.reconstructSWAPs = false;
+  optimizations.reorderOperations = false;
+  optimizations.elidePermutations = false;
+  optimizations.stripCommonGates = false;
+  optimizations.decomposeComponents = false;
+  optimizations.cachePreprocessing = false;
+  optimizations.preprocessingCacheDirectory.clear();
+
+  auto& execution = config.execution;
+  execution.parallel = false;
+  execution.timeout = 0.;
+  execution.slices = 0U;
+  execution.pipelinedPreprocessing = false;
+  execution.runConstructionChecker = false;
+  execution.runAlternatingChecker = false;
+  execution.runZXChecker = false;
+  execution.runCliffordChecker = false;
+  execution.checkpointFile.clear();
+  // only the compact counterexample outlives the speculative manager
+  execution.retainCounterexampleDDs = false;
+  return config;
+}
+
+// the configurations of the alternating checkers racing the regular one
+std::vector<Configuration>
+makeAlternatingPortfolio(const Configuration& configuration,
+                         const qc::QuantumComputation& qc1,
+                         const qc::QuantumComputation& qc2) {
+  const auto& schemes = configuration.application.alternatingPortfolio;
+  std::vector<Configuration> portfolio{};
+  portfolio.reserve(schemes.size());
+
+  // the same sizes the alternating checker derives by default
+  const auto sizes = estimateDDPackageSizes(
+      std::max(qc1.getNqubits(), qc2.getNqubits()),
+      std::max(qc1.getNops(), qc2.getNops()), true, configuration.execution);
+  for (std::size_t i = 0U; i < schemes.size(); ++i) {
+    // members with a scheme already in use get larger tables
+    const auto repetitions = static_cast<std::size_t>(
+        std::count(schemes.begin(),
+                   schemes.begin() + static_cast<std::ptrdiff_t>(i),
+                   schemes[i]) +
+        (schemes[i] == configuration.application.alternatingScheme ? 1 : 0));
+    auto& member = portfolio.emplace_back(configuration);
+    member.application.alternatingScheme = schemes[i];
+    member.application.alternatingPortfolio.clear();
+    if (repetitions > 0U) {
+      member.execution.ddUniqueTableBuckets = sizes.uniqueTableBuckets
+                                              << repetitions;
+      member.execution.ddComputeTableBuckets = sizes.computeTableBuckets
+                                               << repetitions;
+    }
+  }
+  return portfolio;
 }
 } // namespace
 
 void EquivalenceCheckingManager::stripIdleQubits() {
-  auto& largerCircuit = qc1.getNqubits() > qc2.getNqubits() ? qc1 : qc2;
-  auto& smallerCircuit = qc1.getNqubits() > qc2.getNqubits() ? qc2 : qc1;
+  // only idle qubits of the larger circuit are stripped. avoid copying shared
+  // circuits if there are none.
+  const auto idle =
+      idleQubits(qc1->getNqubits() > qc2->getNqubits() ? *qc1 : *qc2);
+  if (idle.empty()) {
+    return;
+  }
+  auto& circ1 = modifiableFirstCircuit();
+  auto& circ2 = modifiableSecondCircuit();
+  auto& largerCircuit = circ1.getNqubits() > circ2.getNqubits() ? circ1 : circ2;
+  auto& smallerCircuit =
+      circ1.getNqubits() > circ2.getNqubits() ? circ2 : circ1;
   auto qubitDifference =
       largerCircuit.getNqubits() - smallerCircuit.getNqubits();
-  auto largerCircuitLayoutCopy = largerCircuit.initialLayout;
 
+  // all decisions are made on the unchanged layouts. Since logical qubits are
+  // only ever compared with each other, this is equivalent to removing each
+  // qubit (and compacting the layouts) right away.
+  const LayoutIndex largerIndex(largerCircuit);
+  const LayoutIndex smallerIndex(smallerCircuit);
+  const auto idleSmaller = idleQubits(smallerCircuit);
+  const bool smallerEmpty = smallerCircuit.getNqubits() == 0;
+  const auto smallerMax =
+      smallerEmpty ? qc::Qubit{0} : smallerCircuit.initialLayout.maxValue();
+
+  std::vector<qc::Qubit> removeFromLarger{};
+  std::vector<qc::Qubit> removeFromSmaller{};
   // Iterate over the initialLayout of largerCircuit and remove an idle logical
   // qubit together with the physical qubit it is mapped to
-  for (auto& physicalQubitIt :
-       std::ranges::reverse_view(largerCircuitLayoutCopy)) {
-    const auto physicalQubitIndex = physicalQubitIt.first;
-
-    if (!largerCircuit.isIdleQubit(physicalQubitIndex)) {
+  for (const auto& [physicalQubitIndex, logicalQubitIndex] :
+       std::ranges::reverse_view(largerCircuit.initialLayout)) {
+    if (!idle.contains(physicalQubitIndex)) {
       continue;
     }
 
-    const auto logicalQubitIndex =
-        largerCircuit.initialLayout.at(physicalQubitIndex);
-
-    bool removedFromSmallerCircuit = false;
-
     // Remove idle logical qubit present exclusively in largerCircuit
     if (qubitDifference > 0 &&
-        ((smallerCircuit.getNqubits() == 0) ||
-         logicalQubitIndex > smallerCircuit.initialLayout.maxValue())) {
-      const bool physicalUsedInOutputPermutation =
-          largerCircuit.outputPermutation.find(physicalQubitIndex) !=
-          largerCircuit.outputPermutation.end();
-      const bool logicalUsedInOutputPermutation =
-          std::ranges::any_of(largerCircuit.outputPermutation,
-                              [logicalQubitIndex](const auto& pair) {
-                                return pair.second == logicalQubitIndex;
-                              });
-
-      // a qubit can only be removed if it is not used in the output permutation
-      // or if it is used in the output permutation and the logical qubit index
-      // matches the logical qubit index in the output permutation for the
-      // physical qubit index in question, which indicates that nothing has
-      // happened to the qubit in the larger circuit.
-      const bool safeToRemoveInLargerCircuit =
-          (!physicalUsedInOutputPermutation &&
-           !logicalUsedInOutputPermutation) ||
-          (physicalUsedInOutputPermutation &&
-           largerCircuit.outputPermutation.at(physicalQubitIndex) ==
-               logicalQubitIndex);
-      if (!safeToRemoveInLargerCircuit) {
-        continue;
-      }
-      largerCircuit.removeQubit(logicalQubitIndex);
-      --qubitDifference;
-
-    } else {
-      // Remove logical qubit that is idle in both circuits
-
-      // find the corresponding logical qubit in the smaller circuit
-      const auto it = std::ranges::find_if(
-          smallerCircuit.initialLayout, [logicalQubitIndex](const auto& pair) {
-            return pair.second == logicalQubitIndex;
-          });
-      // the logical qubit has to be present in the smaller circuit, otherwise
-      // this would indicate a bug in the circuit IO initialization.
-      assert(it != smallerCircuit.initialLayout.end());
-      const auto physicalSmaller = it->first;
-
-      // if the qubit is not idle in the second circuit, it cannot be removed
-      // from either circuit.
-      if (!smallerCircuit.isIdleQubit(physicalSmaller)) {
-        continue;
-      }
-
-      const bool physicalLargerUsedInOutputPermutation =
-          (largerCircuit.outputPermutation.find(physicalQubitIndex) !=
-           largerCircuit.outputPermutation.end());
-
-      const bool logicalLargerUsedInOutputPermutation =
-          std::ranges::any_of(largerCircuit.outputPermutation,
-                              [logicalQubitIndex](const auto& pair) {
-                                return pair.second == logicalQubitIndex;
-                              });
-
-      const bool safeToRemoveInLargerCircuit =
-          (!physicalLargerUsedInOutputPermutation &&
-           !logicalLargerUsedInOutputPermutation) ||
-          (physicalLargerUsedInOutputPermutation &&
-           largerCircuit.outputPermutation.at(physicalQubitIndex) ==
-               logicalQubitIndex);
-      if (!safeToRemoveInLargerCircuit) {
-        continue;
-      }
-
-      const bool physicalSmallerUsedInOutputPermutation =
-          (smallerCircuit.outputPermutation.find(physicalSmaller) !=
-           smallerCircuit.outputPermutation.end());
-
-      const bool logicalSmallerUsedInOutputPermutation =
-          std::ranges::any_of(smallerCircuit.outputPermutation,
-                              [logicalQubitIndex](const auto& pair) {
-                                return pair.second == logicalQubitIndex;
-                              });
-
-      const bool safeToRemoveInSmallerCircuit =
-          (!physicalSmallerUsedInOutputPermutation &&
-           !logicalSmallerUsedInOutputPermutation) ||
-          (physicalSmallerUsedInOutputPermutation &&
-           smallerCircuit.outputPermutation.at(physicalSmaller) ==
-               logicalQubitIndex);
-      if (!safeToRemoveInSmallerCircuit) {
-        continue;
+        (smallerEmpty || logicalQubitIndex > smallerMax)) {
+      if (largerIndex.safeToRemove(physicalQubitIndex, logicalQubitIndex)) {
+        removeFromLarger.emplace_back(logicalQubitIndex);
+        --qubitDifference;
       }
-
-      // only remove the qubit from both circuits if it is safe to do so in both
-      // circuits (i.e., the qubit is not used in the output permutation or if
-      // it is used, the logical qubit index matches the logical qubit index in
-      // the output permutation for the physical qubit index in question).
-      largerCircuit.removeQubit(logicalQubitIndex);
-      smallerCircuit.removeQubit(logicalQubitIndex);
-      removedFromSmallerCircuit = true;
+      continue;
     }
-    decrementLogicalQubitsInLayoutAboveIndex(largerCircuit.initialLayout,
-                                             logicalQubitIndex);
-    decrementLogicalQubitsInLayoutAboveIndex(largerCircuit.outputPermutation,
-                                             logicalQubitIndex);
-    if (removedFromSmallerCircuit) {
-      decrementLogicalQubitsInLayoutAboveIndex(smallerCircuit.initialLayout,
-                                               logicalQubitIndex);
-      decrementLogicalQubitsInLayoutAboveIndex(smallerCircuit.outputPermutation,
-                                               logicalQubitIndex);
+
+    // Remove logical qubit that is idle in both circuits. The logical qubit
+    // has to be present in the smaller circuit, otherwise this would indicate
+    // a bug in the circuit IO initialization.
+    const auto physicalSmaller = smallerIndex.physicalQubit(logicalQubitIndex);
+    assert(physicalSmaller.has_value());
+
+    // only remove the qubit from both circuits if it is idle and safe to
+    // remove in both of them
+    if (!physicalSmaller || !idleSmaller.contains(*physicalSmaller) ||
+        !largerIndex.safeToRemove(physicalQubitIndex, logicalQubitIndex) ||
+        !smallerIndex.safeToRemove(*physicalSmaller, logicalQubitIndex)) {
+      continue;
     }
+    removeFromLarger.emplace_back(logicalQubitIndex);
+    removeFromSmaller.emplace_back(logicalQubitIndex);
   }
+
+  removeLogicalQubits(largerCircuit, std::move(removeFromLarger));
+  removeLogicalQubits(smallerCircuit, std::move(removeFromSmaller));
 }
 
 void EquivalenceCheckingManager::setupAncillariesAndGarbage() {
-  auto& largerCircuit =
-      qc1.getNqubits() > qc2.getNqubits() ? this->qc1 : this->qc2;
+  if (qc1->getNqubits() == qc2->getNqubits()) {
+    return;
+  }
+  auto& circ1 = modifiableFirstCircuit();
+  auto& circ2 = modifiableSecondCircuit();
+  auto& largerCircuit = circ1.getNqubits() > circ2.getNqubits() ? circ1 : circ2;
   auto& smallerCircuit =
-      qc1.getNqubits() > qc2.getNqubits() ? this->qc2 : this->qc1;
+      circ1.getNqubits() > circ2.getNqubits() ? circ2 : circ1;
   const auto qubitDifference =
       largerCircuit.getNqubits() - smallerCircuit.getNqubits();
 
-  if (qubitDifference == 0) {
-    return;
-  }
-
   std::vector<std::pair<qc::Qubit, std::optional<qc::Qubit>>> removed{};
   removed.reserve(qubitDifference);
 
   const auto nqubits = largerCircuit.getNqubits();
   std::vector<bool> garbage(nqubits);
 
+  // the qubits with the highest logical indices are turned into ancillaries.
+  // Sorting them once avoids searching the layout for its maximum before each
+  // removal (removing a qubit does not change the other indices).
+  std::vector<qc::Qubit> logicalQubits{};
+  logicalQubits.reserve(largerCircuit.initialLayout.size());
+  for (const auto& [physical, logical] : largerCircuit.initialLayout) {
+    logicalQubits.emplace_back(logical);
+  }
+  std::ranges::sort(logicalQubits, std::greater{});
+  assert(logicalQubits.size() >= qubitDifference);
+
   for (std::size_t i = 0; i < qubitDifference; ++i) {
-    const auto logicalQubitIndex = largerCircuit.initialLayout.maxValue();
+    const auto logicalQubitIndex = logicalQubits[i];
     garbage[logicalQubitIndex] =
         largerCircuit.logicalQubitIsGarbage(logicalQubitIndex);
     removed.push_back(largerCircuit.removeQubit(logicalQubitIndex));
@@ -230,111 +473,398 @@ void EquivalenceCheckingManager::setupAncillariesAndGarbage() {
   }
 }
 
-void EquivalenceCheckingManager::runOptimizationPasses() {
-  if (qc1.empty() && qc2.empty()) {
+void EquivalenceCheckingManager::stripCommonGates() {
+  if (!configuration.optimizations.stripCommonGates ||
+      configuration.functionality.checkPartialEquivalence) {
     return;
   }
+  // identical gates acting on ancillary or garbage qubits do not cancel
+  for (const auto* qc : {qc1.get(), qc2.get()}) {
+    if (qc->getNancillae() > 0U || qc->getNgarbageQubits() > 0U) {
+      return;
+    }
+  }
 
-  const auto isDynamicCircuit1 = qc1.isDynamic();
-  const auto isDynamicCircuit2 = qc2.isDynamic();
-  if (isDynamicCircuit1 || isDynamicCircuit2) {
-    if (configuration.optimizations.transformDynamicCircuit) {
-      if (isDynamicCircuit1) {
-        qc::CircuitOptimizer::eliminateResets(qc1);
-        qc::CircuitOptimizer::deferMeasurements(qc1);
-      }
-      if (isDynamicCircuit2) {
-        qc::CircuitOptimizer::eliminateResets(qc2);
-        qc::CircuitOptimizer::deferMeasurements(qc2);
-      }
+  const auto n1 = qc1->size();
+  const auto n2 = qc2->size();
+  // keep (at least) one operation in case both circuits would become empty,
+  // such that differing global phases are still detected by the checkers
+  auto limit = std::min(n1, n2);
+  if (n1 == n2 && limit > 0U) {
+    --limit;
+  }
+  const auto matches = [this](const std::size_t i, const std::size_t j) {
+    const auto& op1 = *qc1->at(i);
+    return (op1.isUnitary() || op1.getType() == qc::Barrier) &&
+           op1.equals(*qc2->at(j));
+  };
+
+  // identical leading gates cancel directly
+  std::size_t prefix = 0U;
+  auto layout = qc1->initialLayout;
+  if (qc1->initialLayout == qc2->initialLayout) {
+    while (prefix < limit && matches(prefix, prefix) &&
+           trackSwap(*qc1->at(prefix), layout)) {
+      ++prefix;
+    }
+  }
+
+  // identical trailing gates conjugate the remaining functionality, which
+  // preserves whether it resembles the identity. The layout is tracked
+  // backwards from the output permutation.
+  std::size_t suffix = 0U;
+  auto output = qc1->outputPermutation;
+  if (qc1->outputPermutation == qc2->outputPermutation) {
+    while (prefix + suffix < limit &&
+           matches(n1 - 1U - suffix, n2 - 1U - suffix) &&
+           trackSwap(*qc1->at(n1 - 1U - suffix), output)) {
+      ++suffix;
+    }
+  }
+
+  if (prefix == 0U && suffix == 0U) {
+    return;
+  }
+  for (auto* const circ :
+       {&modifiableFirstCircuit(), &modifiableSecondCircuit()}) {
+    circ->erase(circ->end() - static_cast<std::ptrdiff_t>(suffix),
+                circ->end());
+    circ->erase(circ->begin(),
+                circ->begin() + static_cast<std::ptrdiff_t>(prefix));
+    circ->initialLayout = layout;
+    circ->outputPermutation = output;
+  }
+}
+
+void EquivalenceCheckingManager::optimizeCircuit(
+    qc::QuantumComputation& qc,
+    const Configuration::Optimizations& optimizations) {
+  if (qc.empty()) {
+    return;
+  }
+
+  if (qc.isDynamic()) {
+    if (optimizations.transformDynamicCircuit) {
+      qc::CircuitOptimizer::eliminateResets(qc);
+      qc::CircuitOptimizer::deferMeasurements(qc);
     } else {
-      throw std::runtime_error(
-          "One of the circuits contains mid-circuit non-unitary primitives. "
-          "To verify such circuits, the checker must be configured with "
-          "`transformDynamicCircuit=true` (`transform_dynamic_circuits=True` "
-          "in Python).");
+      throwUnsupportedDynamicCircuit();
     }
   }
 
   // first, make sure any potential SWAPs are reconstructed
-  if (configuration.optimizations.reconstructSWAPs) {
-    qc::CircuitOptimizer::swapReconstruction(qc1);
-    qc::CircuitOptimizer::swapReconstruction(qc2);
+  if (optimizations.reconstructSWAPs) {
+    qc::CircuitOptimizer::swapReconstruction(qc);
   }
 
   // then, optionally backpropagate the output permutation
-  if (configuration.optimizations.backpropagateOutputPermutation) {
-    qc::CircuitOptimizer::backpropagateOutputPermutation(qc1);
-    qc::CircuitOptimizer::backpropagateOutputPermutation(qc2);
+  if (optimizations.backpropagateOutputPermutation) {
+    qc::CircuitOptimizer::backpropagateOutputPermutation(qc);
   }
 
   // based on the above, all SWAPs should be reconstructed and accounted for,
   // so we can elide them.
-  if (configuration.optimizations.elidePermutations) {
-    qc::CircuitOptimizer::elidePermutations(qc1);
-    qc::CircuitOptimizer::elidePermutations(qc2);
+  if (optimizations.elidePermutations) {
+    qc::CircuitOptimizer::elidePermutations(qc);
   }
 
   // fuse consecutive single qubit gates into compound operations (includes some
   // simple cancellation rules).
-  if (configuration.optimizations.fuseSingleQubitGates) {
-    qc::CircuitOptimizer::singleQubitGateFusion(qc1);
-    qc::CircuitOptimizer::singleQubitGateFusion(qc2);
+  if (optimizations.fuseSingleQubitGates) {
+    qc::CircuitOptimizer::singleQubitGateFusion(qc);
   }
 
   // optionally remove diagonal gates before measurements
-  if (configuration.optimizations.removeDiagonalGatesBeforeMeasure) {
-    qc::CircuitOptimizer::removeDiagonalGatesBeforeMeasure(qc1);
-    qc::CircuitOptimizer::removeDiagonalGatesBeforeMeasure(qc2);
+  if (optimizations.removeDiagonalGatesBeforeMeasure) {
+    qc::CircuitOptimizer::removeDiagonalGatesBeforeMeasure(qc);
+  }
+
+  if (optimizations.reorderOperations) {
+    qc.reorderOperations();
+  }
+
+  // remove final measurements so that the underlying functionality should be
+  // unitary
+  qc::CircuitOptimizer::removeFinalMeasurements(qc);
+}
+
+void EquivalenceCheckingManager::runOptimizationPasses() {
+  if (qc1->empty() && qc2->empty()) {
+    return;
   }
 
-  if (configuration.optimizations.reorderOperations) {
-    qc1.reorderOperations();
-    qc2.reorderOperations();
+  // check both circuits for unsupported dynamic primitives before modifying
+  // any of them
+  if ((qc1->isDynamic() || qc2->isDynamic()) &&
+      !configuration.optimizations.transformDynamicCircuit) {
+    throwUnsupportedDynamicCircuit();
   }
 
-  // remove final measurements from both circuits so that the underlying
-  // functionality should be unitary
-  qc::CircuitOptimizer::removeFinalMeasurements(qc1);
-  qc::CircuitOptimizer::removeFinalMeasurements(qc2);
+  // the circuits are made modifiable upfront, since both passes only touch
+  // their own circuit afterwards
+  auto* const first = !firstCircuitOptimized && !qc1->empty()
+                          ? &modifiableFirstCircuit()
+                          : nullptr;
+  auto* const second = !secondCircuitOptimized && !qc2->empty()
+                           ? &modifiableSecondCircuit()
+                           : nullptr;
+  const auto& optimizations = configuration.optimizations;
+  runIndependently(
+      preprocessConcurrently(),
+      [&] {
+        if (first != nullptr) {
+          optimizeCircuit(*first, optimizations);
+        }
+      },
+      [&] {
+        if (second != nullptr) {
+          optimizeCircuit(*second, optimizations);
+        }
+      });
+}
+
+bool EquivalenceCheckingManager::checkClifford() {
+  const auto& execution = configuration.execution;
+  if (!execution.runCliffordChecker) {
+    return false;
+  }
+  // garbage qubits are only ignored by partial equivalence checking, which
+  // the tableaux do not support
+  const auto partial = configuration.functionality.checkPartialEquivalence &&
+                       (qc1->getNgarbageQubits() > 0U ||
+                        qc2->getNgarbageQubits() > 0U);
+  if (partial || !CliffordEquivalenceChecker::canHandle(*qc1, *qc2)) {
+    if (!execution.runAlternatingChecker &&
+        !execution.runConstructionChecker && !execution.runZXChecker &&
+        !execution.runSimulationChecker) {
+      std::clog << "Only Clifford checker specified, but the circuits cannot "
+                   "be handled by this checker! Exiting!\n";
+    }
+    return false;
+  }
+  auto* const checker = addChecker<CliffordEquivalenceChecker>();
+  const auto result = checker->run();
+  results.checkTime = checker->getRuntime();
+  if (result == EquivalenceCriterion::NoInformation) {
+    return false;
+  }
+  results.equivalence = result;
+  done = true;
+  return true;
+}
+
+bool EquivalenceCheckingManager::preprocessConcurrently() const {
+  // the registry of symbolic variables is not safe to use concurrently
+  return configuration.execution.parallel &&
+         configuration.execution.nthreads > 1U && !firstCircuitOptimized &&
+         !secondCircuitOptimized && qc1->isVariableFree() &&
+         qc2->isVariableFree() &&
+         std::min(qc1->size(), qc2->size()) >=
+             MIN_CONCURRENT_PREPROCESSING_OPS;
+}
+
+void EquivalenceCheckingManager::startSpeculativeSimulations() {
+  const auto& execution = configuration.execution;
+  if (!execution.pipelinedPreprocessing || !execution.runSimulationChecker ||
+      (firstCircuitOptimized && secondCircuitOptimized) || qc1->empty() ||
+      qc2->empty() || !qc1->isVariableFree() || !qc2->isVariableFree()) {
+    return;
+  }
+  {
+    const std::lock_guard instancesLock(instancesMutex);
+    speculationStopped = false;
+  }
+  // copies, since the circuits of this manager are modified in the meantime
+  speculation = std::async(
+      std::launch::async,
+      [this, circ1 = std::make_shared<const qc::QuantumComputation>(*qc1),
+       circ2 = std::make_shared<const qc::QuantumComputation>(*qc2),
+       config = speculativeConfiguration(configuration),
+       optimized1 = firstCircuitOptimized,
+       optimized2 = secondCircuitOptimized]() -> std::optional<Results> {
+        EquivalenceCheckingManager manager(circ1, circ2, config, optimized1,
+                                           optimized2, true);
+        {
+          const std::lock_guard instancesLock(instancesMutex);
+          if (speculationStopped) {
+            return std::nullopt;
+          }
+          speculativeManager = &manager;
+        }
+        // a stop request that races with the start of the run ends it after
+        // the first batch of stimuli
+        manager.run();
+        {
+          const std::lock_guard instancesLock(instancesMutex);
+          speculativeManager = nullptr;
+        }
+        if (manager.equivalence() != EquivalenceCriterion::NotEquivalent) {
+          return std::nullopt;
+        }
+        auto res = manager.getResults();
+        res.cexInput = {};
+        res.cexOutput1 = {};
+        res.cexOutput2 = {};
+        // the stimuli refer to the qubits of the lightly preprocessed circuits
+        const auto& simulated = *manager.getSharedFirstCircuit();
+        speculativeQubits = {simulated.getNqubits(),
+                             simulated.getNqubitsWithoutAncillae()};
+        return res;
+      });
+}
+
+void EquivalenceCheckingManager::finishSpeculativeSimulations() {
+  if (!speculation.valid()) {
+    return;
+  }
+  {
+    const std::lock_guard instancesLock(instancesMutex);
+    speculationStopped = true;
+    if (speculativeManager != nullptr) {
+      speculativeManager->setAndSignalDone();
+    }
+  }
+  try {
+    speculativeResults = speculation.get();
+  } catch (const std::exception& /*e*/) {
+    // the regular check reports any problem with the circuits
+    speculativeResults.reset();
+  }
 }
 
 void EquivalenceCheckingManager::run() {
+  // make sure no checker of a previous run is still active
+  waitForPendingTasks();
   done = false;
 
   results.equivalence = EquivalenceCriterion::NoInformation;
+  results.cexStimulus.reset();
+  results.counterexample.reset();
 
   const bool garbageQubitsPresent =
-      qc1.getNgarbageQubits() > 0 || qc2.getNgarbageQubits() > 0;
+      qc1->getNgarbageQubits() > 0 || qc2->getNgarbageQubits() > 0;
 
   if (!configuration.anythingToExecute()) {
     std::clog << "Nothing to be executed. Check your configuration!\n";
     return;
   }
 
-  if (qc1.empty() && qc2.empty()) {
+  loadGateCostProfile(configuration);
+
+  if (qc1->empty() && qc2->empty()) {
     results.equivalence = EquivalenceCriterion::Equivalent;
     done = true;
     return;
   }
 
-  if (qc1.isVariableFree() && qc2.isVariableFree()) {
-    if (!configuration.execution.parallel ||
-        configuration.execution.nthreads <= 1 ||
-        configuration.onlySingleTask()) {
-      checkSequential();
+  // the simulations that ran during the preprocessing might have decided the
+  // check already (which only holds for the first run)
+  if (speculativeResults) {
+    results.equivalence = EquivalenceCriterion::NotEquivalent;
+    results.decidedDuringPreprocessing = true;
+    results.startedSimulations = speculativeResults->startedSimulations;
+    results.performedSimulations = speculativeResults->performedSimulations;
+    results.cexStimulus = speculativeResults->cexStimulus;
+    results.counterexample = std::move(speculativeResults->counterexample);
+    results.checkerResults = std::move(speculativeResults->checkerResults);
+    results.checkTime = 0.;
+    speculativeResults.reset();
+    done = true;
+    return;
+  }
+
+  resetSimulations();
+
+  const auto start = std::chrono::steady_clock::now();
+  std::function<void()> report{};
+  if (progressCallback) {
+    report = [this, start] { progressCallback(takeProgressSnapshot(start)); };
+  }
+  // whether the check has been decided by separately checked sub-problems
+  bool decomposed = !componentCircuits.empty();
+  // sequential checks switch to the tolerance of each checker they run, which
+  // requires them to be the only check running. All other checks run their
+  // checkers concurrently with the shared tolerance.
+  if (!nested) {
+    const bool sequential = !configuration.execution.parallel ||
+                            configuration.execution.nthreads <= 1 ||
+                            configuration.onlySingleTask();
+    toleranceLease.emplace(configuration.sharedTolerance(),
+                           sequential && !configuration.uniformTolerance());
+  }
+  {
+    ProgressReporter reporter(report, std::max(progressInterval,
+                                               MIN_PROGRESS_INTERVAL));
+    if (checkClifford()) {
+      // the stabilizer tableaux have decided the check
+    } else if (decomposed) {
+      checkComponents(start);
+    } else if (qc1->isVariableFree() && qc2->isVariableFree()) {
+      decomposed = !sliceCircuits.empty() && checkSlices(start);
+      const auto timeout = configuration.execution.timeout;
+      if (!sliceCircuits.empty() && timeout > 0.) {
+        // the full check only gets the time that remains after the slices
+        configuration.execution.timeout = remainingTime(start);
+      }
+      if (decomposed) {
+        done = true;
+      } else if (!done && (timeout <= 0. ||
+                           configuration.execution.timeout > 0.)) {
+        if (!configuration.execution.parallel ||
+            configuration.execution.nthreads <= 1 ||
+            configuration.onlySingleTask()) {
+          checkSequential();
+        } else {
+          checkParallel();
+        }
+      }
+      configuration.execution.timeout = timeout;
+      if (!sliceCircuits.empty()) {
+        results.checkTime = std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+      }
     } else {
-      checkParallel();
+      checkSymbolic();
     }
-  } else {
-    checkSymbolic();
+    reporter.stop();
+  }
+  if (report) {
+    report();
   }
 
-  for (const auto& checker : checkers) {
+  if (!decomposed) {
+    const std::lock_guard statisticsLock(simulationStatisticsMutex);
+    results.falseNegativeProbability =
+        std::exp(-simulationStatistics.evidence);
+  }
+
+  for (std::size_t i = 0U; i < checkers.size(); ++i) {
+    // skip checkers that are still winding down after a decision was reached
+    if (i < pendingTasks.size() && pendingTasks[i].valid() &&
+        pendingTasks[i].wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+      continue;
+    }
+    const auto& checker = checkers[i];
+    if (!checker) {
+      continue;
+    }
     nlohmann::basic_json j{};
     checker->json(j);
     results.checkerResults.emplace_back(j);
   }
+  if (!configuration.execution.retainCounterexampleDDs) {
+    releaseFinishedCheckers();
+  }
+  // checkers that are still winding down keep the tolerance until they are
+  // waited for
+  if (std::ranges::all_of(pendingTasks, [](const auto& task) {
+        return !task.valid() || task.wait_for(std::chrono::seconds(0)) ==
+                                    std::future_status::ready;
+      })) {
+    toleranceLease.reset();
+  }
 
   if (!configuration.functionality.checkPartialEquivalence &&
       garbageQubitsPresent &&
@@ -349,51 +879,221 @@ void EquivalenceCheckingManager::run() {
 }
 
 EquivalenceCheckingManager::EquivalenceCheckingManager(
-    // Circuits not passed by value and moved because this would cause slicing.
-    // NOLINTNEXTLINE(modernize-pass-by-value)
-    const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
-    Configuration config)
-    : qc1(circ1), qc2(circ2), configuration(std::move(config)) {
-  const auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<const qc::QuantumComputation> circ1,
+    std::shared_ptr<const qc::QuantumComputation> circ2, Configuration config,
+    const bool circ1Optimized, const bool circ2Optimized,
+    const bool nestedCheck)
+    : qc1(std::move(circ1)), qc2(std::move(circ2)),
+      firstCircuitOptimized(circ1Optimized),
+      secondCircuitOptimized(circ2Optimized), nested(nestedCheck),
+      configuration(std::move(config)) {
+  preprocess();
+}
+
+EquivalenceCheckingManager::EquivalenceCheckingManager(
+    std::shared_ptr<qc::QuantumComputation> circ1,
+    std::shared_ptr<qc::QuantumComputation> circ2, Configuration config,
+    const bool circ1Optimized, const bool circ2Optimized,
+    const bool nestedCheck)
+    : qc1(circ1), qc2(circ2), ownedQc1(std::move(circ1)),
+      ownedQc2(std::move(circ2)), firstCircuitOptimized(circ1Optimized),
+      secondCircuitOptimized(circ2Optimized), nested(nestedCheck),
+      configuration(std::move(config)) {
+  preprocess();
+}
+
+qc::QuantumComputation& EquivalenceCheckingManager::modifiableFirstCircuit() {
+  return makeModifiable(qc1, ownedQc1);
+}
+
+qc::QuantumComputation& EquivalenceCheckingManager::modifiableSecondCircuit() {
+  return makeModifiable(qc2, ownedQc2);
+}
 
-  // set numeric tolerance used throughout the check
-  dd::ComplexNumbers::setTolerance(configuration.execution.numericalTolerance);
+void EquivalenceCheckingManager::preprocessWithCache() {
+  auto& cache = PreprocessingCache::global();
+  const auto& optimizations = configuration.optimizations;
+  const auto& directory = optimizations.preprocessingCacheDirectory;
+  const auto hash1 = PreprocessingCache::hash(*qc1);
+  const auto hash2 = PreprocessingCache::hash(*qc2);
+
+  // the fully preprocessed pair of circuits might already be known
+  const auto key = PreprocessingCache::pairKey(hash1, hash2, optimizations,
+                                               firstCircuitOptimized,
+                                               secondCircuitOptimized);
+  if (const auto entry = cache.lookup(key, directory);
+      entry && entry->size() == 2U) {
+    qc1 = entry->front();
+    qc2 = entry->back();
+    ownedQc1.reset();
+    ownedQc2.reset();
+    results.preprocessingCacheHits = 2U;
+    return;
+  }
 
-  if (qc1.isVariableFree() && qc2.isVariableFree()) {
-    // run all configured optimization passes
-    runOptimizationPasses();
+  if (qc1->empty() && qc2->empty()) {
+    return;
+  }
+  // check both circuits for unsupported dynamic primitives before modifying
+  // any of them
+  if ((qc1->isDynamic() || qc2->isDynamic()) &&
+      !optimizations.transformDynamicCircuit) {
+    throwUnsupportedDynamicCircuit();
   }
 
-  // strip away qubits that are not acted upon
-  stripIdleQubits();
+  // otherwise, the optimization passes only depend on the individual circuits.
+  // Each call only touches the members of its own circuit (and the cache is
+  // safe to use concurrently), so both can run at the same time.
+  const auto optimize = [&](std::shared_ptr<const qc::QuantumComputation>& circ,
+                            std::shared_ptr<qc::QuantumComputation>& owned,
+                            const std::uint64_t hash, bool& optimized,
+                            bool& hit) {
+    if (optimized || circ->empty()) {
+      return;
+    }
+    const auto circuitKey = PreprocessingCache::circuitKey(hash, optimizations);
+    if (const auto entry = cache.lookup(circuitKey, directory);
+        entry && entry->size() == 1U) {
+      circ = entry->front();
+      hit = true;
+    } else {
+      optimizeCircuit(makeModifiable(circ, owned), optimizations);
+      cache.store(circuitKey, {circ}, directory);
+    }
+    // cached circuits must not be modified any further
+    owned.reset();
+    optimized = true;
+  };
+  bool hit1 = false;
+  bool hit2 = false;
+  runIndependently(
+      preprocessConcurrently(),
+      [&] { optimize(qc1, ownedQc1, hash1, firstCircuitOptimized, hit1); },
+      [&] { optimize(qc2, ownedQc2, hash2, secondCircuitOptimized, hit2); });
+  results.preprocessingCacheHits +=
+      static_cast<std::size_t>(hit1) + static_cast<std::size_t>(hit2);
 
-  // given that one circuit has more qubits than the other, the difference is
-  // assumed to arise from ancillary qubits. adjust both circuits accordingly
+  stripIdleQubits();
   setupAncillariesAndGarbage();
 
-  if (this->qc1.getNqubitsWithoutAncillae() !=
-      this->qc2.getNqubitsWithoutAncillae()) {
+  cache.store(key, {qc1, qc2}, directory);
+  ownedQc1.reset();
+  ownedQc2.reset();
+}
+
+void EquivalenceCheckingManager::loadGateCostProfile(Configuration& config) {
+  auto& application = config.application;
+  if (application.profile.empty()) {
+    application.gateCostProfile = nullptr;
+    return;
+  }
+  const auto usesGateCost =
+      (config.execution.runConstructionChecker &&
+       application.constructionScheme == ApplicationSchemeType::GateCost) ||
+      (config.execution.runSimulationChecker &&
+       application.simulationScheme == ApplicationSchemeType::GateCost) ||
+      (config.execution.runAlternatingChecker &&
+       application.alternatingScheme == ApplicationSchemeType::GateCost);
+  if (!usesGateCost) {
+    return;
+  }
+  if (application.gateCostProfile != nullptr &&
+      application.gateCostProfile->getSource() == application.profile) {
+    return;
+  }
+  application.gateCostProfile = GateCostProfile::load(application.profile);
+}
+
+void EquivalenceCheckingManager::preprocess() {
+  const auto start = std::chrono::steady_clock::now();
+
+  // set numeric tolerance used throughout the preprocessing (unless it is
+  // owned by the outer manager)
+  std::optional<ToleranceLease> lease{};
+  if (!nested) {
+    lease.emplace(configuration.sharedTolerance(), false);
+  }
+
+  startSpeculativeSimulations();
+  try {
+    preprocessCircuits();
+  } catch (...) {
+    finishSpeculativeSimulations();
+    throw;
+  }
+  finishSpeculativeSimulations();
+  if (speculativeResults &&
+      speculativeQubits != std::array{qc1->getNqubits(),
+                                      qc1->getNqubitsWithoutAncillae()}) {
+    // the optimization passes changed the qubits of the circuits, so only the
+    // verdict carries over
+    speculativeResults->cexStimulus.reset();
+    speculativeResults->counterexample.reset();
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  results.preprocessingTime =
+      std::chrono::duration<double>(end - start).count();
+}
+
+void EquivalenceCheckingManager::preprocessCircuits() {
+  const bool variableFree = qc1->isVariableFree() && qc2->isVariableFree();
+  const auto& optimizations = configuration.optimizations;
+  if (variableFree && (optimizations.cachePreprocessing ||
+                       !optimizations.preprocessingCacheDirectory.empty())) {
+    preprocessWithCache();
+  } else {
+    if (variableFree) {
+      // run all configured optimization passes
+      runOptimizationPasses();
+    }
+
+    // strip away qubits that are not acted upon
+    stripIdleQubits();
+
+    // given that one circuit has more qubits than the other, the difference is
+    // assumed to arise from ancillary qubits. adjust both circuits accordingly
+    setupAncillariesAndGarbage();
+  }
+
+  if (qc1->getNqubitsWithoutAncillae() != qc2->getNqubitsWithoutAncillae()) {
     std::clog << "[QCEC] Warning: circuits have different number of primary "
                  "inputs! Proceed with caution!\n";
   }
 
   if (configuration.execution.setAllAncillaeGarbage) {
-    for (qc::Qubit q = 0; q < qc1.getNqubits(); ++q) {
-      if (qc1.logicalQubitIsAncillary(q)) {
-        qc1.setLogicalQubitGarbage(q);
+    setAncillaeGarbage(qc1, ownedQc1);
+    setAncillaeGarbage(qc2, ownedQc2);
+  }
+
+  // remove the gates both circuits have in common at their start and end
+  stripCommonGates();
+
+  // split the check into independent sub-problems if possible
+  componentCircuits.clear();
+  sliceCircuits.clear();
+  if (variableFree && !configuration.functionality.checkPartialEquivalence) {
+    const auto share = [](CircuitPairs& pairs, auto&& split) {
+      for (auto& [circ1, circ2] : split) {
+        pairs.emplace_back(
+            std::make_shared<const qc::QuantumComputation>(std::move(circ1)),
+            std::make_shared<const qc::QuantumComputation>(std::move(circ2)));
       }
+    };
+    if (optimizations.decomposeComponents) {
+      share(componentCircuits, splitIntoComponents(*qc1, *qc2));
     }
-    for (qc::Qubit q = 0; q < qc2.getNqubits(); ++q) {
-      if (qc2.logicalQubitIsAncillary(q)) {
-        qc2.setLogicalQubitGarbage(q);
-      }
+    // components are sliced by their own managers
+    if (componentCircuits.empty() && configuration.execution.slices > 1U) {
+      share(sliceCircuits,
+            sliceAtCutPoints(*qc1, *qc2, configuration.execution.slices));
     }
   }
 
   // check whether the alternating checker is configured and can handle the
   // circuits
   if (configuration.execution.runAlternatingChecker &&
-      !DDAlternatingChecker::canHandle(this->qc1, this->qc2)) {
+      !DDAlternatingChecker::canHandle(*qc1, *qc2)) {
     std::clog << "[QCEC] Warning: alternating checker cannot handle the "
                  "circuits. Falling back to construction checker.\n";
     this->configuration.execution.runAlternatingChecker = false;
@@ -405,18 +1105,58 @@ EquivalenceCheckingManager::EquivalenceCheckingManager(
 
   // check whether the number of selected stimuli does exceed the maximum
   // number of unique computational basis states
+  basisStimuli = std::numeric_limits<std::size_t>::max();
+  if (const auto nq = qc1->getNqubitsWithoutAncillae(); nq <= 63U) {
+    basisStimuli = 1ULL << nq;
+  }
   if (configuration.execution.runSimulationChecker &&
-      configuration.simulation.stateType == StateType::ComputationalBasis) {
-    const auto nq = this->qc1.getNqubitsWithoutAncillae();
-    const std::size_t uniqueStates = 1ULL << nq;
-    if (nq <= 63U && configuration.simulation.maxSims > uniqueStates) {
-      this->configuration.simulation.maxSims = uniqueStates;
+      configuration.simulation.stateType == StateType::ComputationalBasis &&
+      !configuration.simulation.adaptiveStateType) {
+    // stimuli before the first one are left to other processes
+    const auto available =
+        basisStimuli -
+        std::min(configuration.simulation.firstStimulus, basisStimuli);
+    this->configuration.simulation.maxSims =
+        std::min(configuration.simulation.maxSims, available);
+  }
+
+  // an exhaustive simulation covers every computational basis state. It is
+  // only applicable as long as the number of basis states is manageable and
+  // the output states are compared in full.
+  if (configuration.simulation.exhaustive) {
+    const auto nq = qc1->getNqubitsWithoutAncillae();
+    if (configuration.execution.runSimulationChecker &&
+        configuration.simulation.stateType == StateType::ComputationalBasis &&
+        nq <= Configuration::Simulation::MAX_EXHAUSTIVE_QUBITS &&
+        !configuration.functionality.checkPartialEquivalence) {
+      this->configuration.simulation.maxSims = 1ULL << nq;
+      this->configuration.simulation.firstStimulus = 0U;
+      // all basis states are simulated, so neither stopping early nor other
+      // types of stimuli are an option
+      this->configuration.simulation.falseNegativeBound = 0.;
+      this->configuration.simulation.adaptiveStateType = false;
+    } else {
+      this->configuration.simulation.exhaustive = false;
     }
   }
 
-  const auto end = std::chrono::steady_clock::now();
-  results.preprocessingTime =
-      std::chrono::duration<double>(end - start).count();
+  if (configuration.simulation.falseNegativeBound > 0. ||
+      configuration.simulation.adaptiveStateType) {
+    for (const auto probability :
+         {configuration.simulation.basisDetectionProbability,
+          configuration.simulation.random1QDetectionProbability,
+          configuration.simulation.stabilizerDetectionProbability}) {
+      if (!(probability > 0. && probability < 1.)) {
+        throw std::invalid_argument(
+            "Detection probabilities of stimuli must lie in (0, 1).");
+      }
+    }
+  }
+}
+
+EquivalenceCheckingManager::~EquivalenceCheckingManager() {
+  setAndSignalDone();
+  waitForPendingTasks();
 }
 
 void EquivalenceCheckingManager::checkSequential() {
@@ -439,19 +1179,43 @@ void EquivalenceCheckingManager::checkSequential() {
     });
   }
 
+  // the checkers run one after another, so each of them gets its own tolerance
+  // (unless other checks run concurrently with this nested one)
+  const auto& execution = configuration.execution;
+  const auto useTolerance = [this](const dd::fp tolerance) {
+    if (toleranceLease) {
+      toleranceLease->use(configuration.checkerTolerance(tolerance));
+    }
+  };
+
   if (configuration.execution.runSimulationChecker) {
-    checkers.emplace_back(
-        std::make_unique<DDSimulationChecker>(qc1, qc2, configuration));
+    useTolerance(execution.simulationTolerance);
     auto* const simulationChecker =
-        dynamic_cast<DDSimulationChecker*>(checkers.back().get());
+        dynamic_cast<DDSimulationChecker*>(addChecker<DDSimulationChecker>());
     while (!simulationsFinished() && !done) {
       // configure simulation based checker
-      simulationChecker->setRandomInitialState(stateGenerator);
+      const auto [first, stimuli] = claimSimulationStimuli();
+      if (stimuli == 0U) {
+        break;
+      }
+      const auto runStart = std::chrono::steady_clock::now();
+      const auto type = nextSimulationStateType();
+      simulationChecker->setInitialStates(stateGenerator, first, stimuli,
+                                          type);
 
       // run the simulation
-      ++results.startedSimulations;
+      results.startedSimulations += stimuli;
       const auto result = simulationChecker->run();
-      ++results.performedSimulations;
+
+      // a simulation exceeding the memory budget is not repeated, but the
+      // remaining checkers still get their chance
+      if (simulationChecker->exceededMemoryLimit()) {
+        std::clog << "Simulation exceeded the memory limit. Skipping the "
+                     "remaining simulations.\n";
+        break;
+      }
+      results.performedSimulations += stimuli;
+      passedSimulations += stimuli;
 
       // if the run completed but has not yielded any information this
       // indicates a timeout
@@ -472,13 +1236,25 @@ void EquivalenceCheckingManager::checkSequential() {
       // Otherwise, circuits are probably equivalent and execution can
       // continue
       results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+      if (result != EquivalenceCriterion::Equivalent) {
+        inexactSimulations = true;
+      }
+      const auto runEnd = std::chrono::steady_clock::now();
+      recordSimulations(
+          type, stimuli,
+          std::chrono::duration<double>(runEnd - runStart).count());
+    }
+
+    // simulating every basis state proves equivalence
+    if (exhaustivelySimulated()) {
+      results.equivalence = EquivalenceCriterion::Equivalent;
+      done = true;
+      doneCond.notify_one();
     }
 
     // Circuits are non-equivalent
     if (results.equivalence == EquivalenceCriterion::NotEquivalent) {
-      results.cexInput = simulationChecker->getInitialState();
-      results.cexOutput1 = simulationChecker->getInternalState1();
-      results.cexOutput2 = simulationChecker->getInternalState2();
+      recordCounterexample(*simulationChecker);
       done = true;
       doneCond.notify_one();
     }
@@ -493,9 +1269,8 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 
   if (configuration.execution.runAlternatingChecker && !done) {
-    checkers.emplace_back(
-        std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration));
-    const auto& alternatingChecker = checkers.back();
+    useTolerance(execution.alternatingTolerance);
+    auto* const alternatingChecker = addChecker<DDAlternatingChecker>();
     if (!done) {
       const auto result = alternatingChecker->run();
 
@@ -511,9 +1286,8 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 
   if (configuration.execution.runConstructionChecker && !done) {
-    checkers.emplace_back(
-        std::make_unique<DDConstructionChecker>(qc1, qc2, configuration));
-    const auto& constructionChecker = checkers.back();
+    useTolerance(execution.constructionTolerance);
+    auto* const constructionChecker = addChecker<DDConstructionChecker>();
     if (!done) {
       const auto result = constructionChecker->run();
 
@@ -529,10 +1303,15 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 
   if (configuration.execution.runZXChecker && !done) {
-    if (ZXEquivalenceChecker::canHandle(qc1, qc2)) {
-      checkers.emplace_back(
-          std::make_unique<ZXEquivalenceChecker>(qc1, qc2, configuration));
-      const auto& zxChecker = checkers.back();
+    if (ZXEquivalenceChecker::canHandle(*qc1, *qc2)) {
+      auto* const zxChecker = addChecker<ZXEquivalenceChecker>();
+      // the ZX checker is the only checker running at this point
+      if (configuration.execution.nthreads > 1U) {
+        setupThreadPool();
+        auto* const zx = dynamic_cast<ZXEquivalenceChecker*>(zxChecker);
+        zx->setNumThreads(configuration.execution.nthreads);
+        zx->setThreadPool(threadPool);
+      }
       if (!done) {
         const auto result = zxChecker->run();
 
@@ -586,6 +1365,46 @@ void EquivalenceCheckingManager::checkSequential() {
   }
 }
 
+void EquivalenceCheckingManager::setAndSignalDone() {
+  done = true;
+  {
+    const std::lock_guard checkersLock(checkersMutex);
+    for (const auto& checker : checkers) {
+      if (checker) {
+        checker->signalDone();
+      }
+    }
+  }
+  const std::lock_guard instancesLock(instancesMutex);
+  if (activeScheduler != nullptr) {
+    activeScheduler->cancel();
+  }
+  if (speculativeManager != nullptr) {
+    speculativeManager->setAndSignalDone();
+  }
+}
+
+void EquivalenceCheckingManager::setupThreadPool() {
+  const auto nthreads =
+      std::max<std::size_t>(1U, configuration.execution.nthreads);
+  if (!threadPool || (ownsThreadPool && threadPool->size() != nthreads)) {
+    threadPool = std::make_shared<ThreadPool>(nthreads);
+    ownsThreadPool = true;
+  }
+}
+
+void EquivalenceCheckingManager::setZXThreads(const std::size_t id,
+                                              const std::size_t nthreads) {
+  const std::lock_guard checkersLock(checkersMutex);
+  zxThreads = std::max<std::size_t>(1U, nthreads);
+  if (id < checkers.size() && checkers[id]) {
+    if (auto* const zxChecker =
+            dynamic_cast<ZXEquivalenceChecker*>(checkers[id].get())) {
+      zxChecker->setNumThreads(zxThreads);
+    }
+  }
+}
+
 void EquivalenceCheckingManager::checkParallel() {
   const auto start = std::chrono::steady_clock::now();
 
@@ -606,18 +1425,24 @@ void EquivalenceCheckingManager::checkParallel() {
   const auto maxThreads = configuration.execution.nthreads;
 
   std::size_t tasksToExecute = 0U;
+  std::vector<Configuration> portfolio{};
   if (configuration.execution.runAlternatingChecker) {
     ++tasksToExecute;
+    portfolio = makeAlternatingPortfolio(configuration, *qc1, *qc2);
+    tasksToExecute += portfolio.size();
   }
   if (configuration.execution.runConstructionChecker) {
     ++tasksToExecute;
   }
   if (configuration.execution.runSimulationChecker) {
-    tasksToExecute += configuration.simulation.maxSims;
+    const auto stimuliPerRun =
+        std::max<std::size_t>(1U, configuration.simulation.stimuliPerRun);
+    tasksToExecute +=
+        (configuration.simulation.maxSims + stimuliPerRun - 1U) / stimuliPerRun;
   }
   if (configuration.execution.runZXChecker) {
-    if (zx::FunctionalityConstruction::transformableToZX(&qc1) &&
-        zx::FunctionalityConstruction::transformableToZX(&qc2)) {
+    if (zx::FunctionalityConstruction::transformableToZX(qc1.get()) &&
+        zx::FunctionalityConstruction::transformableToZX(qc2.get())) {
       ++tasksToExecute;
     } else {
       configuration.execution.runZXChecker = false;
@@ -626,74 +1451,173 @@ void EquivalenceCheckingManager::checkParallel() {
 
   const auto effectiveThreads = std::min(maxThreads, tasksToExecute);
 
+  // checkers are scheduled on a pool of long-lived worker threads
+  setupThreadPool();
+
   // reserve space for as many equivalence checkers as there will be
   // parallel threads
-  checkers.resize(effectiveThreads);
+  {
+    const std::lock_guard checkersLock(checkersMutex);
+    checkers.resize(effectiveThreads);
+  }
 
-  // create a thread safe queue which is used to check for available results
-  ThreadSafeQueue<std::size_t> queue{};
+  // create a channel through which the checkers report their results. Each
+  // task reports once, and the thread of the ZX checker may be handed to one
+  // further simulation worker.
+  const auto channel =
+      std::make_shared<ResultChannel<Completion>>(effectiveThreads + 1U);
   std::size_t id = 0U;
 
-  // reserve space for the futures received from the async calls
-  std::vector<std::future<void>> futures{};
+  // the futures received from the thread pool are kept in the manager so that
+  // checkers which are still winding down can be waited for later on
+  auto& futures = pendingTasks;
+  futures.clear();
   futures.reserve(effectiveThreads);
 
   if (configuration.execution.runAlternatingChecker) {
     // start a new thread that constructs and runs the alternating check
-    futures.emplace_back(asyncRunChecker<DDAlternatingChecker>(id, queue));
+    futures.emplace_back(asyncRunChecker<DDAlternatingChecker>(id, channel));
     ++id;
   }
 
   if (configuration.execution.runConstructionChecker && !done) {
     // start a new thread that constructs and runs the construction check
-    futures.emplace_back(asyncRunChecker<DDConstructionChecker>(id, queue));
+    futures.emplace_back(asyncRunChecker<DDConstructionChecker>(id, channel));
     ++id;
   }
 
+  // further alternating checkers race the regular one (leaving a thread for
+  // the ZX checker). The first one to finish decides and cancels the others.
+  const auto reserved = configuration.execution.runZXChecker ? 1U : 0U;
+  for (auto& member : portfolio) {
+    if (done || futures.size() + reserved >= effectiveThreads) {
+      break;
+    }
+    futures.emplace_back(
+        asyncRunChecker<DDAlternatingChecker>(id, channel, std::move(member)));
+    ++id;
+  }
+
+  // the ZX checker additionally uses all threads not taken by other checkers
+  std::optional<std::size_t> zxID{};
   if (configuration.execution.runZXChecker && !done) {
+    zxID = id;
+    zxThreads = 1U + maxThreads - std::min(maxThreads, effectiveThreads);
     // start a new thread that constructs and runs the ZX checker
-    futures.emplace_back(asyncRunChecker<ZXEquivalenceChecker>(id, queue));
+    futures.emplace_back(asyncRunChecker<ZXEquivalenceChecker>(id, channel));
     ++id;
   }
 
   if (configuration.execution.runSimulationChecker) {
     const auto effectiveThreadsLeft = effectiveThreads - futures.size();
-    const auto simulationsToStart =
-        std::min(effectiveThreadsLeft, configuration.simulation.maxSims);
-    // launch as many simulations as possible
-    for (std::size_t i = 0; i < simulationsToStart && !done; ++i) {
-      futures.emplace_back(asyncRunChecker<DDSimulationChecker>(id, queue));
+    // launch as many simulation workers as possible. Each of them keeps
+    // claiming stimuli until all simulations have been started.
+    for (std::size_t i = 0; i < effectiveThreadsLeft && !done; ++i) {
+      futures.emplace_back(asyncRunChecker<DDSimulationChecker>(id, channel));
       ++id;
-      ++results.startedSimulations;
     }
   }
 
-  // wait in a loop while no definitive result has been obtained
-  while (!done) {
-    std::shared_ptr<std::size_t> completedID{};
+  // the simulation workers only report once they are done. In the meantime,
+  // the number of successful simulations is tracked by a shared counter.
+  const auto accountSimulations = [this] {
+    results.performedSimulations = passedSimulations;
+    // if no information is known, the successful simulations suggest that
+    // both circuits are likely to be equivalent.
+    if (results.performedSimulations > 0U &&
+        results.equivalence == EquivalenceCriterion::NoInformation) {
+      results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+    }
+  };
+
+  // wait in a loop while no definitive result has been obtained and there are
+  // still checkers running
+  std::size_t running = futures.size();
+  while (!done && running > 0U) {
+    // threads of checkers that finished without being replaced are handed to
+    // the ZX checker
+    if (zxID) {
+      setZXThreads(*zxID, 1U + maxThreads - std::min(maxThreads, running));
+    }
+    std::optional<Completion> completed{};
     if (configuration.execution.timeout > 0.) {
-      completedID = queue.waitAndPopUntil(deadline);
+      completed = channel->waitAndPopUntil(deadline);
     } else {
-      completedID = queue.waitAndPop();
+      completed = channel->waitAndPop();
     }
 
-    // in case no completed ID has been returned this indicates a timeout
-    // and the computation should stop
-    if (!completedID) {
+    // in case no checker has completed this indicates a timeout and the
+    // computation should stop
+    if (!completed) {
       setAndSignalDone();
+      // account for the simulations that succeeded before the timeout
+      accountSimulations();
       break;
     }
+    --running;
 
     // otherwise, a checker has finished its execution
     // get the result of the future (which should be ready)
-    // this makes sure exceptions are thrown if necessary
-    futures.at(*completedID).get();
+    // this makes sure exceptions are thrown if necessary (after asking all
+    // other checkers to stop)
+    try {
+      futures.at(completed->id).get();
+    } catch (...) {
+      setAndSignalDone();
+      throw;
+    }
 
     // in case non-equivalence has been shown, the execution can be stopped
-    const auto* const checker = checkers.at(*completedID).get();
-    const auto result = checker->getEquivalence();
+    const auto* const checker = checkers.at(completed->id).get();
+    const auto* const simChecker =
+        dynamic_cast<const DDSimulationChecker*>(checker);
+    const std::size_t stimuli =
+        simChecker != nullptr ? simChecker->getNumStimuli() : 0U;
+    const auto result = completed->equivalence;
+
+    // a simulation worker reports once all stimuli have been claimed (unless
+    // it has shown non-equivalence or exceeded its memory budget)
+    if (simChecker != nullptr &&
+        result != EquivalenceCriterion::NotEquivalent &&
+        !checker->exceededMemoryLimit()) {
+      accountSimulations();
+      if (simulationsFinished()) {
+        // simulating every basis state proves equivalence
+        if (exhaustivelySimulated()) {
+          setAndSignalDone();
+          results.equivalence = EquivalenceCriterion::Equivalent;
+          break;
+        }
+        if (configuration.onlySimulationCheckerConfigured()) {
+          // if only simulations are performed and all of them are successful,
+          // the circuits are most likely equivalent, and the procedure is done.
+          setAndSignalDone();
+          break;
+        }
+
+        if (results.equivalence ==
+            EquivalenceCriterion::ProbablyNotEquivalent) {
+          std::clog
+              << "The ZX checker suggests that the circuits are not "
+                 "equivalent, but the simulation checker suggests that they "
+                 "are probably equivalent. Thus, no conclusion can be drawn.\n";
+          setAndSignalDone();
+          results.equivalence = EquivalenceCriterion::NoInformation;
+          break;
+        }
+      }
+      // if all simulations finished and none of them showed non-equivalence,
+      // the run continues uninterrupted.
+      continue;
+    }
 
     if (result == EquivalenceCriterion::NoInformation) {
+      // a checker exceeding its memory budget gives up, but the others resume
+      if (checker->exceededMemoryLimit()) {
+        std::clog << "Equivalence checker exceeded the memory limit and "
+                     "stopped without a result.\n";
+        continue;
+      }
       if (dynamic_cast<const ZXEquivalenceChecker*>(checker) != nullptr) {
         if (configuration.onlyZXCheckerConfigured()) {
           std::clog
@@ -706,6 +1630,21 @@ void EquivalenceCheckingManager::checkParallel() {
           setAndSignalDone();
           break;
         }
+        // the thread of the ZX checker is used for a further simulation worker
+        if (configuration.execution.runSimulationChecker &&
+            claimedSimulations < configuration.simulation.maxSims) {
+          std::size_t simID = 0U;
+          {
+            const std::lock_guard checkersLock(checkersMutex);
+            simID = checkers.size();
+            checkers.emplace_back();
+          }
+          // the futures are indexed like the checkers
+          futures.resize(simID);
+          futures.emplace_back(
+              asyncRunChecker<DDSimulationChecker>(simID, channel));
+          ++running;
+        }
         continue;
       }
       std::clog << "Finished equivalence check provides no information. "
@@ -721,12 +1660,9 @@ void EquivalenceCheckingManager::checkParallel() {
 
       // some special handling in case non-equivalence has been shown by a
       // simulation run
-      if (const auto* const simulationChecker =
-              dynamic_cast<const DDSimulationChecker*>(checker)) {
-        ++results.performedSimulations;
-        results.cexInput = simulationChecker->getInitialState();
-        results.cexOutput1 = simulationChecker->getInternalState1();
-        results.cexOutput2 = simulationChecker->getInternalState2();
+      if (simChecker != nullptr) {
+        results.performedSimulations = passedSimulations + stimuli;
+        recordCounterexample(*simChecker);
       }
       break;
     }
@@ -741,6 +1677,7 @@ void EquivalenceCheckingManager::checkParallel() {
     }
 
     if (dynamic_cast<const ZXEquivalenceChecker*>(checker) != nullptr) {
+      accountSimulations();
       if (result == EquivalenceCriterion::Equivalent ||
           result == EquivalenceCriterion::EquivalentUpToGlobalPhase) {
         setAndSignalDone();
@@ -777,60 +1714,199 @@ void EquivalenceCheckingManager::checkParallel() {
         }
       }
     }
+  }
+  results.startedSimulations = claimedSimulations;
 
-    // at this point, the only option is that this is a simulation checker
-    if (dynamic_cast<const DDSimulationChecker*>(checker) != nullptr) {
-      ++results.performedSimulations;
+  const auto end = std::chrono::steady_clock::now();
+  results.checkTime = std::chrono::duration<double>(end - start).count();
 
-      // if no information is known, the successful simulation suggests that
-      // both circuits are likely to be equivalent.
-      if (results.equivalence == EquivalenceCriterion::NoInformation) {
-        results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
-      }
+  // Outstanding tasks are not waited for here. All of them have been asked to
+  // stop and they check for this request before applying each gate. Hence,
+  // they finish in the background shortly after and are waited for before the
+  // next run, on `reset()`, or on destruction of the manager. The worker
+  // threads themselves are kept alive and are reused by subsequent runs.
+}
 
-      if (simulationsFinished()) {
-        if (configuration.onlySimulationCheckerConfigured()) {
-          // if only simulations are performed and all of them are successful,
-          // the circuits are most likely equivalent, and the procedure is done.
-          setAndSignalDone();
-          break;
-        }
+std::pair<std::size_t, std::size_t>
+EquivalenceCheckingManager::claimSimulationStimuli() {
+  const auto maxSims = configuration.simulation.maxSims;
+  const auto stimuliPerRun =
+      std::max<std::size_t>(1U, configuration.simulation.stimuliPerRun);
+  auto claimed = claimedSimulations.load();
+  while (claimed < maxSims && !confidentSimulations) {
+    const auto stimuli = std::min(stimuliPerRun, maxSims - claimed);
+    if (claimedSimulations.compare_exchange_weak(claimed, claimed + stimuli)) {
+      return {configuration.simulation.firstStimulus + claimed, stimuli};
+    }
+  }
+  return {configuration.simulation.firstStimulus + claimed, 0U};
+}
 
-        if (results.equivalence ==
-            EquivalenceCriterion::ProbablyNotEquivalent) {
-          std::clog
-              << "The ZX checker suggests that the circuits are not "
-                 "equivalent, but the simulation checker suggests that they "
-                 "are probably equivalent. Thus, no conclusion can be drawn.\n";
-          setAndSignalDone();
-          results.equivalence = EquivalenceCriterion::NoInformation;
-          break;
-        }
-        // if all simulations finished and none of them showed non-equivalence,
-        // the run continues uninterrupted.
-        continue;
-      }
+void EquivalenceCheckingManager::recordCounterexample(
+    const DDSimulationChecker& checker) {
+  results.cexInput = checker.getInitialState();
+  results.cexOutput1 = checker.getInternalState1();
+  results.cexOutput2 = checker.getInternalState2();
+  results.cexStimulus = checker.getCounterexampleStimulus();
+  results.counterexample = Counterexample::summarize(
+      results.cexInput, results.cexOutput1, results.cexOutput2,
+      checker.getStimulusType(),
+      std::max(qc1->getNqubits(), qc2->getNqubits()),
+      configuration.execution.counterexampleAmplitudes);
+}
 
-      // it has to be checked, whether further simulations shall be
-      // conducted
-      if (results.startedSimulations < configuration.simulation.maxSims) {
-        futures[*completedID] =
-            asyncRunChecker<DDSimulationChecker>(*completedID, queue);
-        ++results.startedSimulations;
-      }
+void EquivalenceCheckingManager::releaseFinishedCheckers() {
+  results.cexInput = {};
+  results.cexOutput1 = {};
+  results.cexOutput2 = {};
+  const std::lock_guard checkersLock(checkersMutex);
+  for (std::size_t i = 0U; i < checkers.size(); ++i) {
+    // checkers that are still winding down are released on the next run
+    if (i < pendingTasks.size() && pendingTasks[i].valid() &&
+        pendingTasks[i].wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+      continue;
     }
+    checkers[i].reset();
   }
+}
 
-  const auto end = std::chrono::steady_clock::now();
-  results.checkTime = std::chrono::duration<double>(end - start).count();
+void EquivalenceCheckingManager::runSimulationWorker(
+    DDSimulationChecker& checker) {
+  while (!done) {
+    const auto [first, stimuli] = claimSimulationStimuli();
+    if (stimuli == 0U) {
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const auto type = nextSimulationStateType();
+    // the claimed indices are unique, so no synchronization is needed
+    checker.setInitialStates(stateGenerator, first, stimuli, type);
+    const auto result = checker.run();
+    if (done || result == EquivalenceCriterion::NotEquivalent ||
+        result == EquivalenceCriterion::NoInformation) {
+      return;
+    }
+    if (result != EquivalenceCriterion::Equivalent) {
+      inexactSimulations = true;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    // the statistics are recorded before the stimuli are accounted for, such
+    // that the simulations are only considered finished afterwards
+    recordSimulations(type, stimuli,
+                      std::chrono::duration<double>(end - start).count());
+    passedSimulations += stimuli;
+  }
+}
+
+EquivalenceCheckingManager::Progress
+EquivalenceCheckingManager::takeProgressSnapshot(
+    const std::chrono::steady_clock::time_point start) {
+  Progress snapshot{};
+  snapshot.elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  snapshot.startedSimulations = claimedSimulations;
+  snapshot.performedSimulations = passedSimulations;
+  const std::lock_guard checkersLock(checkersMutex);
+  for (const auto& checker : checkers) {
+    if (checker) {
+      snapshot.checkers.emplace_back(
+          Progress::Checker{checker->getName(), checker->getProgress()});
+      checker->requestProgress();
+    }
+  }
+  return snapshot;
+}
+
+void EquivalenceCheckingManager::resetSimulations() {
+  claimedSimulations = 0U;
+  passedSimulations = 0U;
+  inexactSimulations = false;
+  confidentSimulations = false;
+  const std::lock_guard statisticsLock(simulationStatisticsMutex);
+  simulationStatistics = SimulationStatistics{};
+}
+
+namespace {
+// the evidence a single successful stimulus of the given type provides, i.e.,
+// -log of the probability that it misses an existing error
+double stimulusEvidence(const Configuration::Simulation& simulation,
+                        const StateType type) {
+  switch (type) {
+  case StateType::Random1QBasis:
+    return -std::log1p(-simulation.random1QDetectionProbability);
+  case StateType::Stabilizer:
+    return -std::log1p(-simulation.stabilizerDetectionProbability);
+  default:
+    return -std::log1p(-simulation.basisDetectionProbability);
+  }
+}
+} // namespace
+
+StateType EquivalenceCheckingManager::nextSimulationStateType() {
+  const auto& simulation = configuration.simulation;
+  if (!simulation.adaptiveStateType) {
+    return simulation.stateType;
+  }
+
+  constexpr std::array TYPES{StateType::ComputationalBasis,
+                             StateType::Random1QBasis, StateType::Stabilizer};
+  const std::lock_guard statisticsLock(simulationStatisticsMutex);
+  const auto& stats = simulationStatistics;
+  // computational basis stimuli are no longer useful once all of them have
+  // been used
+  const auto used = [&](const StateType type) {
+    return stats.stimuli[static_cast<std::size_t>(type)];
+  };
+  const auto available = [&](const StateType type) {
+    return type != StateType::ComputationalBasis || used(type) < basisStimuli;
+  };
+
+  // every type of stimuli is tried once before any decision is made
+  for (const auto type : TYPES) {
+    if (available(type) && used(type) == 0U) {
+      return type;
+    }
+  }
 
-  // Futures are not explicitly waited for here, since the destructor of the
-  // `std::future` object will block until the associated thread has finished.
-  // If any thread is still stuck in a long-running operation, this might take a
-  // while, but the program will terminate anyway. C++20 introduces
-  // `std::jthread`, which allows to explicitly cancel a thread. This could be a
-  // solution for the future to avoid this problem (and reduce the number of
-  // `isDone` checks).
+  // afterwards, the type that gathered the most evidence per second is used
+  auto best = StateType::Stabilizer;
+  auto bestRate = -1.;
+  for (const auto type : TYPES) {
+    if (!available(type)) {
+      continue;
+    }
+    const auto time = stats.time[static_cast<std::size_t>(type)];
+    const auto evidence =
+        static_cast<double>(used(type)) * stimulusEvidence(simulation, type);
+    const auto rate =
+        time > 0. ? evidence / time : std::numeric_limits<double>::infinity();
+    if (rate > bestRate) {
+      best = type;
+      bestRate = rate;
+    }
+  }
+  return best;
+}
+
+void EquivalenceCheckingManager::recordSimulations(const StateType type,
+                                                   const std::size_t stimuli,
+                                                   const double time) {
+  const std::lock_guard statisticsLock(simulationStatisticsMutex);
+  auto& stats = simulationStatistics;
+  const auto t = static_cast<std::size_t>(type);
+  stats.stimuli[t] += stimuli;
+  stats.time[t] += time;
+  stats.evidence += static_cast<double>(stimuli) *
+                    stimulusEvidence(configuration.simulation, type);
+
+  // after k_t successful stimuli of each type t, an existing error has gone
+  // undetected with probability at most prod_t (1 - p_t)^k_t
+  const auto bound = configuration.simulation.falseNegativeBound;
+  if (bound > 0. && stats.evidence >= -std::log(bound)) {
+    confidentSimulations = true;
+  }
 }
 
 void EquivalenceCheckingManager::checkSymbolic() {
@@ -852,28 +1928,94 @@ void EquivalenceCheckingManager::checkSymbolic() {
     });
   }
 
-  if (!done) {
-    if (zx::FunctionalityConstruction::transformableToZX(&qc1) &&
-        zx::FunctionalityConstruction::transformableToZX(&qc2)) {
-      checkers.emplace_back(
-          std::make_unique<ZXEquivalenceChecker>(qc1, qc2, configuration));
-      const auto& zxChecker = checkers.back();
+  const bool transformable =
+      zx::FunctionalityConstruction::transformableToZX(qc1.get()) &&
+      zx::FunctionalityConstruction::transformableToZX(qc2.get());
+  if (!transformable) {
+    std::clog << "Checking symbolic circuits with the ZX checker requires "
+                 "transformation to ZX-diagram but one of the circuits "
+                 "contains operations not supported by this checker!"
+              << '\n';
+  }
+
+  auto instanceConfig = configuration;
+  instanceConfig.execution.runZXChecker = false;
+  const bool race = transformable && configuration.execution.parallel &&
+                    configuration.execution.nthreads > 1U &&
+                    instanceConfig.anythingToExecute();
+
+  if (race && !done) {
+    // the ZX checker runs on the thread pool, while the instantiations are
+    // checked on the remaining threads. The first conclusive result decides
+    // and cancels the other side.
+    setupThreadPool();
+    const auto maxThreads = configuration.execution.nthreads;
+    const auto instances = std::min(
+        maxThreads - 1U,
+        configuration.parameterized.nAdditionalInstantiations + 2U);
+    {
+      const std::lock_guard checkersLock(checkersMutex);
+      zxThreads = maxThreads - instances;
+      checkers.resize(1U);
+    }
+    // the ZX checker and the wake-up of its watcher report through the channel
+    const auto channel = std::make_shared<ResultChannel<Completion>>(2U);
+    pendingTasks.clear();
+    pendingTasks.emplace_back(
+        asyncRunChecker<ZXEquivalenceChecker>(0U, channel));
+
+    // the ZX checker can only prove equivalence. In that case, it stops the
+    // instantiations as soon as it has finished.
+    std::atomic<bool> zxProved{false};
+    std::thread zxWatcher([&] {
+      const auto [id, result] = channel->waitAndPop();
+      if (id != 0U) {
+        return;
+      }
+      const bool proved =
+          result == EquivalenceCriterion::Equivalent ||
+          result == EquivalenceCriterion::EquivalentUpToGlobalPhase;
+      if (!done && proved) {
+        zxProved = true;
+        setAndSignalDone();
+      }
+    });
+
+    // the ZX checker keeps its threads, the instantiations share the others
+    checkInstantiations(start, instances);
+    if (zxProved) {
+      results.equivalence = checkers.front()->getEquivalence();
+    }
+    // stop the ZX checker in case the instantiations have been conclusive.
+    // It finishes in the background and is waited for before the next run.
+    setAndSignalDone();
+    // wake up the watcher in case the ZX checker is still winding down
+    channel->push({1U, EquivalenceCriterion::NoInformation});
+    zxWatcher.join();
+    if (pendingTasks.front().wait_for(std::chrono::seconds(0)) ==
+        std::future_status::ready) {
+      pendingTasks.front().get();
+    }
+  } else {
+    if (transformable && !done) {
+      auto* const zxChecker = addChecker<ZXEquivalenceChecker>();
+      if (configuration.execution.nthreads > 1U) {
+        setupThreadPool();
+        auto* const zx = dynamic_cast<ZXEquivalenceChecker*>(zxChecker);
+        zx->setNumThreads(configuration.execution.nthreads);
+        zx->setThreadPool(threadPool);
+      }
       if (!done) {
-        const auto result = zxChecker->run();
-        results.equivalence = result;
-        done = true;
-        doneCond.notify_one();
+        results.equivalence = zxChecker->run();
       }
-    } else {
-      std::clog << "Checking symbolic circuits requires transformation "
-                   "to ZX-diagram but one of the circuits contains "
-                   "operations not supported by this checker! Exiting!"
-                << '\n';
-      checkers.clear();
-      results.equivalence = EquivalenceCriterion::NoInformation;
-      return;
+    }
+    if (!done && !results.consideredEquivalent()) {
+      checkInstantiations(start, configuration.execution.nthreads);
     }
   }
+  done = true;
+  doneCond.notify_one();
+
   const auto end = std::chrono::steady_clock::now();
   results.checkTime = std::chrono::duration<double>(end - start).count();
   // appropriately join the timeout thread, if it was launched
@@ -882,19 +2024,406 @@ void EquivalenceCheckingManager::checkSymbolic() {
   }
 }
 
+namespace {
+// the options of sub-problems that are checked within the time and on the
+// threads of the given configuration (concurrently iff a pool is given)
+SubproblemScheduler::Options
+subproblemOptions(const Configuration& configuration,
+                  std::shared_ptr<ThreadPool> threadPool,
+                  const SubproblemScheduler::Cancellation cancellation,
+                  const std::chrono::steady_clock::time_point start) {
+  SubproblemScheduler::Options options{};
+  if (threadPool != nullptr) {
+    options.concurrency = configuration.execution.nthreads;
+    options.threadPool = std::move(threadPool);
+  }
+  options.cancellation = cancellation;
+  options.timeout = configuration.execution.timeout;
+  options.start = start;
+  return options;
+}
+} // namespace
+
+std::vector<std::optional<EquivalenceCheckingManager::Results>>
+EquivalenceCheckingManager::runSubproblems(SubproblemScheduler& scheduler,
+                                           const std::size_t count,
+                                           const Configuration& config,
+                                           const SubproblemFactory& factory) {
+  {
+    const std::lock_guard instancesLock(instancesMutex);
+    activeScheduler = &scheduler;
+  }
+  // a cancellation before the scheduler has been registered is caught here
+  if (done) {
+    scheduler.cancel();
+  }
+  std::vector<std::optional<Results>> subResults{};
+  try {
+    subResults = scheduler.run(count, config, factory);
+  } catch (...) {
+    const std::lock_guard instancesLock(instancesMutex);
+    activeScheduler = nullptr;
+    throw;
+  }
+  const std::lock_guard instancesLock(instancesMutex);
+  activeScheduler = nullptr;
+  return subResults;
+}
+
+void EquivalenceCheckingManager::checkInstantiations(
+    const std::chrono::steady_clock::time_point start,
+    const std::size_t concurrency) {
+  auto instanceConfig = configuration;
+  // the instances are nested managers using the tolerance set by this one
+  instanceConfig.shareTolerance();
+  instanceConfig.execution.runZXChecker = false;
+  if (!instanceConfig.anythingToExecute()) {
+    return;
+  }
+
+  // the system of equations only depends on the circuits, so it is only set
+  // up (and pseudo-inverted) once for all instantiations
+  const ParameterInstantiation instantiation(*qc1, *qc2);
+  const auto nAdditional =
+      configuration.parameterized.nAdditionalInstantiations;
+  const auto count = nAdditional + 2U;
+  auto seed = configuration.simulation.seed;
+  if (seed == 0U) {
+    seed = std::random_device{}();
+  }
+  std::mt19937_64 mt(seed);
+  std::vector<qc::VariableAssignment> assignments{};
+  assignments.reserve(count);
+  assignments.emplace_back(instantiation.zero());
+  for (std::size_t i = 0U; i < nAdditional; ++i) {
+    assignments.emplace_back(instantiation.randomPhases(mt));
+  }
+  assignments.emplace_back(instantiation.random(mt));
+
+  const bool parallel = configuration.execution.parallel &&
+                        configuration.execution.nthreads > 1U;
+  if (parallel) {
+    // the instantiations share the threads instead of each of them spawning
+    // its own parallel check
+    instanceConfig.execution.parallel = false;
+    setupThreadPool();
+  }
+
+  // any non-equivalent instantiation decides the check, so only the earlier
+  // instantiations are still of interest once one has been disproved
+  auto options =
+      subproblemOptions(configuration, parallel ? threadPool : nullptr,
+                        SubproblemScheduler::Cancellation::Later, start);
+  if (parallel) {
+    options.concurrency = std::max<std::size_t>(1U, concurrency);
+  }
+  SubproblemScheduler scheduler(std::move(options));
+  const auto tolerance = configuration.parameterized.parameterizedTol;
+  const auto instanceResults = runSubproblems(
+      scheduler, count, instanceConfig,
+      [this, &assignments, tolerance](const std::size_t i,
+                                      const Configuration& config) {
+        // the instantiated circuits are exclusively owned by the instance,
+        // which preprocesses them in place
+        return std::unique_ptr<EquivalenceCheckingManager>(
+            new EquivalenceCheckingManager(
+                std::make_shared<qc::QuantumComputation>(
+                    ParameterInstantiation::instantiate(*qc1, assignments[i],
+                                                        tolerance)),
+                std::make_shared<qc::QuantumComputation>(
+                    ParameterInstantiation::instantiate(*qc2, assignments[i],
+                                                        tolerance)),
+                config, false, false, true));
+      });
+
+  const auto disproof = scheduler.firstDisproof();
+  const auto performed = disproof ? *disproof + 1U : scheduler.checked();
+  for (std::size_t i = 0U; i < std::min(performed, count); ++i) {
+    if (const auto& res = instanceResults[i]) {
+      results.preprocessingTime += res->preprocessingTime;
+      results.startedSimulations += res->startedSimulations;
+      results.performedSimulations += res->performedSimulations;
+    }
+  }
+  results.performedInstantiations = performed;
+  if (disproof) {
+    results.equivalence = EquivalenceCriterion::NotEquivalent;
+    // the instances act on the same qubits as the symbolic circuits
+    const auto& res = *instanceResults[*disproof];
+    results.cexStimulus = res.cexStimulus;
+    results.counterexample = res.counterexample;
+  } else if (done || remainingTime(start) <= 0. || !instanceResults.back()) {
+    results.equivalence = EquivalenceCriterion::NoInformation;
+  } else {
+    results.equivalence = instanceResults.back()->equivalence;
+  }
+}
+
+namespace {
+// the strength of a (positive) equivalence verdict. The tensor product of the
+// components is only as strong as its weakest component.
+std::size_t strength(const EquivalenceCriterion criterion) {
+  switch (criterion) {
+  case EquivalenceCriterion::Equivalent:
+    return 3U;
+  case EquivalenceCriterion::EquivalentUpToGlobalPhase:
+    return 2U;
+  case EquivalenceCriterion::EquivalentUpToPhase:
+    return 1U;
+  default:
+    return 0U;
+  }
+}
+} // namespace
+
+std::vector<std::optional<EquivalenceCheckingManager::Results>>
+EquivalenceCheckingManager::checkSubproblems(
+    const CircuitPairs& pairs, Configuration config, const std::string_view key,
+    const std::chrono::steady_clock::time_point start) {
+  const auto count = pairs.size();
+  const bool parallel = configuration.execution.parallel &&
+                        configuration.execution.nthreads > 1U;
+  // the sub-problems are nested managers using the tolerance set by this one
+  config.shareTolerance();
+  if (parallel) {
+    // the sub-problems share the threads instead of each of them spawning its
+    // own parallel check
+    config.execution.parallel = false;
+    setupThreadPool();
+  }
+
+  // the first non-equivalent sub-problem decides the check
+  SubproblemScheduler scheduler(
+      subproblemOptions(configuration, parallel ? threadPool : nullptr,
+                        SubproblemScheduler::Cancellation::All, start));
+  // the subcircuits have been split off the preprocessed circuits
+  auto subResults = runSubproblems(
+      scheduler, count, config,
+      [&pairs](const std::size_t i, const Configuration& instanceConfig) {
+        return std::unique_ptr<EquivalenceCheckingManager>(
+            new EquivalenceCheckingManager(pairs[i].first, pairs[i].second,
+                                           instanceConfig, true, true, true));
+      });
+
+  for (std::size_t i = 0U; i < count; ++i) {
+    auto& res = subResults[i];
+    if (!res) {
+      continue;
+    }
+    results.preprocessingTime += res->preprocessingTime;
+    results.startedSimulations += res->startedSimulations;
+    results.performedSimulations += res->performedSimulations;
+    for (auto& j : res->checkerResults) {
+      j[std::string(key)] = i;
+      results.checkerResults.emplace_back(std::move(j));
+    }
+    res->checkerResults = {};
+  }
+  return subResults;
+}
+
+void EquivalenceCheckingManager::checkComponents(
+    const std::chrono::steady_clock::time_point start) {
+  auto config = configuration;
+  config.optimizations.decomposeComponents = false;
+  const auto subResults =
+      checkSubproblems(componentCircuits, config, "component", start);
+
+  double falseNegativeProbability = 0.;
+  auto weakest = EquivalenceCriterion::Equivalent;
+  bool disproved = false;
+  bool complete = true;
+  for (const auto& res : subResults) {
+    if (!res) {
+      complete = false;
+      continue;
+    }
+    if (res->equivalence == EquivalenceCriterion::NotEquivalent) {
+      disproved = true;
+    } else if (res->equivalence == EquivalenceCriterion::ProbablyEquivalent) {
+      falseNegativeProbability += res->falseNegativeProbability;
+    } else if (strength(res->equivalence) == 0U) {
+      complete = false;
+    }
+    if (strength(res->equivalence) < strength(weakest)) {
+      weakest = res->equivalence;
+    }
+  }
+  results.components = componentCircuits.size();
+  results.falseNegativeProbability = std::min(1., falseNegativeProbability);
+  if (disproved) {
+    results.equivalence = EquivalenceCriterion::NotEquivalent;
+  } else if (!complete) {
+    results.equivalence = EquivalenceCriterion::NoInformation;
+  } else {
+    results.equivalence = weakest;
+  }
+  done = true;
+
+  const auto end = std::chrono::steady_clock::now();
+  results.checkTime = std::chrono::duration<double>(end - start).count();
+}
+
+bool EquivalenceCheckingManager::checkSlices(
+    const std::chrono::steady_clock::time_point start) {
+  auto config = configuration;
+  config.execution.slices = 0U;
+  const auto subResults = checkSubproblems(sliceCircuits, config, "slice",
+                                           start);
+  results.slices = sliceCircuits.size();
+
+  // only (global) phases that are independent of the state compose across
+  // the slices
+  double falseNegativeProbability = 0.;
+  auto weakest = EquivalenceCriterion::Equivalent;
+  for (const auto& res : subResults) {
+    if (!res) {
+      return false;
+    }
+    switch (res->equivalence) {
+    case EquivalenceCriterion::Equivalent:
+      break;
+    case EquivalenceCriterion::EquivalentUpToGlobalPhase:
+      if (weakest == EquivalenceCriterion::Equivalent) {
+        weakest = res->equivalence;
+      }
+      break;
+    case EquivalenceCriterion::ProbablyEquivalent:
+      weakest = res->equivalence;
+      falseNegativeProbability += res->falseNegativeProbability;
+      break;
+    default:
+      return false;
+    }
+  }
+  results.falseNegativeProbability = std::min(1., falseNegativeProbability);
+  results.equivalence = weakest;
+  return true;
+}
+
+double EquivalenceCheckingManager::remainingTime(
+    const std::chrono::steady_clock::time_point start) const {
+  if (configuration.execution.timeout <= 0.) {
+    return std::numeric_limits<double>::max();
+  }
+  const auto elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  return configuration.execution.timeout - elapsed;
+}
+
+namespace {
+// the index of the computational basis state represented by the DD (if it
+// represents one)
+std::optional<std::size_t> basisStateIndex(const dd::VectorDD& state) {
+  if (state.w.approximatelyZero()) {
+    return std::nullopt;
+  }
+  std::size_t index = 0U;
+  auto edge = state;
+  while (!edge.isTerminal()) {
+    const auto& successors = edge.p->e;
+    const bool zero = successors[0].w.approximatelyZero();
+    const bool one = successors[1].w.approximatelyZero();
+    if (zero == one || edge.p->v >= std::numeric_limits<std::size_t>::digits) {
+      return std::nullopt;
+    }
+    if (zero) {
+      index |= std::size_t{1} << edge.p->v;
+      edge = successors[1];
+    } else {
+      edge = successors[0];
+    }
+  }
+  return index;
+}
+} // namespace
+
+EquivalenceCheckingManager::Counterexample
+EquivalenceCheckingManager::Counterexample::summarize(
+    const dd::VectorDD& input, const dd::VectorDD& output1,
+    const dd::VectorDD& output2, const StateType type,
+    const std::size_t nqubits, const std::size_t amplitudes) {
+  Counterexample cex{};
+  cex.stimulusType = type;
+  cex.basisState = basisStateIndex(input);
+  if (amplitudes == 0U || nqubits > MAX_AMPLITUDE_QUBITS ||
+      output1.p == nullptr || output2.p == nullptr) {
+    return cex;
+  }
+
+  const auto vector1 = output1.getVector();
+  const auto vector2 = output2.getVector();
+  if (vector1.size() != vector2.size()) {
+    return cex;
+  }
+  std::vector<std::size_t> indices(vector1.size());
+  for (std::size_t i = 0U; i < indices.size(); ++i) {
+    indices[i] = i;
+  }
+  const auto difference = [&](const std::size_t i) {
+    return std::abs(std::complex<double>(vector1[i]) -
+                    std::complex<double>(vector2[i]));
+  };
+  const auto count = std::min(amplitudes, indices.size());
+  std::partial_sort(indices.begin(),
+                    indices.begin() + static_cast<std::ptrdiff_t>(count),
+                    indices.end(), [&](const auto lhs, const auto rhs) {
+                      return difference(lhs) > difference(rhs);
+                    });
+  for (std::size_t k = 0U; k < count && difference(indices[k]) > 0.; ++k) {
+    const auto i = indices[k];
+    cex.amplitudes.push_back({i, vector1[i], vector2[i]});
+  }
+  return cex;
+}
+
+nlohmann::json EquivalenceCheckingManager::Counterexample::json() const {
+  nlohmann::json j{};
+  j["stimulus_type"] = ec::toString(stimulusType);
+  if (basisState) {
+    j["basis_state"] = *basisState;
+  }
+  auto& amps = j["amplitudes"];
+  amps = nlohmann::json::array();
+  for (const auto& [index, output1, output2] : amplitudes) {
+    amps.push_back({{"index", index},
+                    {"output1", {output1.real(), output1.imag()}},
+                    {"output2", {output2.real(), output2.imag()}}});
+  }
+  return j;
+}
+
 nlohmann::json EquivalenceCheckingManager::Results::json() const {
   nlohmann::json res{};
   res["preprocessing_time"] = preprocessingTime;
   res["check_time"] = checkTime;
+  res["preprocessing_cache_hits"] = preprocessingCacheHits;
+  if (decidedDuringPreprocessing) {
+    res["decided_during_preprocessing"] = true;
+  }
   res["equivalence"] = ec::toString(equivalence);
 
   if (startedSimulations > 0) {
     auto& sim = res["simulations"];
     sim["started"] = startedSimulations;
     sim["performed"] = performedSimulations;
+    sim["false_negative_probability"] = falseNegativeProbability;
+    if (cexStimulus) {
+      sim["counterexample_stimulus"] = *cexStimulus;
+    }
+  }
+  if (counterexample) {
+    res["counterexample"] = counterexample->json();
   }
   auto& par = res["parameterized"];
   par["performed_instantiations"] = performedInstantiations;
+  if (components > 0U) {
+    res["components"] = components;
+  }
+  if (slices > 0U) {
+    res["slices"] = slices;
+  }
 
   res["checkers"] = checkerResults;
 
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "IncrementalEquivalenceCheckingManager.hpp"
+
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace ec {
+
+namespace {
+bool isUnitary(const qc::Operation& op) {
+  return op.getType() == qc::Barrier || op.isUnitary();
+}
+
+// the strength of a positive verdict. Verdicts derived from several checks
+// are only as strong as the weakest of them.
+std::size_t strength(const EquivalenceCriterion criterion) {
+  switch (criterion) {
+  case EquivalenceCriterion::Equivalent:
+    return 3U;
+  case EquivalenceCriterion::EquivalentUpToGlobalPhase:
+    return 2U;
+  case EquivalenceCriterion::ProbablyEquivalent:
+    return 1U;
+  default:
+    return 0U;
+  }
+}
+
+// both versions of the second circuit act on the same qubits in the same way
+bool sameQubits(const qc::QuantumComputation& previous,
+                const qc::QuantumComputation& edited) {
+  return previous.getNqubits() == edited.getNqubits() &&
+         previous.initialLayout == edited.initialLayout &&
+         previous.outputPermutation == edited.outputPermutation &&
+         previous.getAncillary() == edited.getAncillary() &&
+         previous.getGarbage() == edited.getGarbage();
+}
+
+// the circuit describes a unitary on all of its qubits
+bool describesUnitary(const qc::QuantumComputation& qc) {
+  return qc.getNancillae() == 0U && qc.getNgarbageQubits() == 0U &&
+         std::ranges::all_of(qc,
+                             [](const auto& op) { return isUnitary(*op); });
+}
+
+// the operations `[begin, end)` of the circuit (on its physical qubits)
+qc::QuantumComputation window(const qc::QuantumComputation& qc,
+                              const std::size_t begin, const std::size_t end) {
+  auto sub = qc::QuantumComputation(qc.getNqubits());
+  for (auto i = begin; i < end; ++i) {
+    sub.emplace_back(qc.at(i)->clone());
+  }
+  sub.gphase(qc.getGlobalPhase());
+  return sub;
+}
+} // namespace
+
+const IncrementalEquivalenceCheckingManager::Results&
+IncrementalEquivalenceCheckingManager::run() {
+  incremental = false;
+  window = {qc2->size(), qc2->size()};
+  EquivalenceCheckingManager ecm(qc1, qc2, configuration);
+  ecm.run();
+  results = ecm.getResults();
+  // the counterexample DDs live in the package of the manager
+  results.cexInput = {};
+  results.cexOutput1 = {};
+  results.cexOutput2 = {};
+  return results;
+}
+
+const IncrementalEquivalenceCheckingManager::Results&
+IncrementalEquivalenceCheckingManager::update(
+    const qc::QuantumComputation& circ2) {
+  const auto n = qc2->size();
+  const auto m = circ2.size();
+  const auto matches = [this, &circ2](const std::size_t i,
+                                      const std::size_t j) {
+    return qc2->at(i)->equals(*circ2.at(j));
+  };
+  std::size_t prefix = 0U;
+  while (prefix < std::min(n, m) && matches(prefix, prefix)) {
+    ++prefix;
+  }
+  std::size_t suffix = 0U;
+  while (suffix < std::min(n, m) - prefix &&
+         matches(n - 1U - suffix, m - 1U - suffix)) {
+    ++suffix;
+  }
+  return recheck(std::make_shared<const qc::QuantumComputation>(circ2), prefix,
+                 n - suffix, m - suffix);
+}
+
+const IncrementalEquivalenceCheckingManager::Results&
+IncrementalEquivalenceCheckingManager::update(
+    const qc::QuantumComputation& circ2, const std::size_t begin,
+    const std::size_t end) {
+  const auto n = qc2->size();
+  const auto m = circ2.size();
+  // the edited range of `circ2` must not end before it begins either
+  if (begin > end || end > n || begin + n > end + m) {
+    throw std::invalid_argument("Invalid range of edited operations.");
+  }
+  const auto editedEnd = end + m - n;
+  for (std::size_t i = 0U; i < begin; ++i) {
+    if (!qc2->at(i)->equals(*circ2.at(i))) {
+      throw std::invalid_argument(
+          "The circuits differ before the range of edited operations.");
+    }
+  }
+  for (std::size_t i = end; i < n; ++i) {
+    if (!qc2->at(i)->equals(*circ2.at(i + m - n))) {
+      throw std::invalid_argument(
+          "The circuits differ after the range of edited operations.");
+    }
+  }
+  return recheck(std::make_shared<const qc::QuantumComputation>(circ2), begin,
+                 end, editedEnd);
+}
+
+const IncrementalEquivalenceCheckingManager::Results&
+IncrementalEquivalenceCheckingManager::recheck(
+    std::shared_ptr<const qc::QuantumComputation> circ2,
+    const std::size_t begin, const std::size_t end,
+    const std::size_t editedEnd) {
+  const auto decided = checkWindow(*circ2, begin, end, editedEnd);
+  qc2 = std::move(circ2);
+  if (!decided) {
+    run();
+  }
+  window = {end - begin, editedEnd - begin};
+  return results;
+}
+
+bool IncrementalEquivalenceCheckingManager::checkWindow(
+    const qc::QuantumComputation& edited, const std::size_t begin,
+    const std::size_t end, const std::size_t editedEnd) {
+  incremental = false;
+  const auto previous = results.equivalence;
+  // only the previous version is known to be equivalent to the first circuit
+  if (strength(previous) == 0U || !sameQubits(*qc2, edited)) {
+    return false;
+  }
+  for (auto i = begin; i < end; ++i) {
+    if (!isUnitary(*qc2->at(i))) {
+      return false;
+    }
+  }
+  for (auto i = begin; i < editedEnd; ++i) {
+    if (!isUnitary(*edited.at(i))) {
+      return false;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  Results windowResults{};
+  if (begin == end && begin == editedEnd) {
+    // only the global phase may have changed
+    const auto phase = std::remainder(
+        edited.getGlobalPhase() - qc2->getGlobalPhase(), 2. * qc::PI);
+    windowResults.equivalence =
+        std::abs(phase) > configuration.execution.numericalTolerance
+            ? EquivalenceCriterion::EquivalentUpToGlobalPhase
+            : EquivalenceCriterion::Equivalent;
+  } else {
+    EquivalenceCheckingManager ecm(window(*qc2, begin, end),
+                                   window(edited, begin, editedEnd),
+                                   configuration);
+    ecm.run();
+    windowResults = ecm.getResults();
+  }
+
+  // the operations outside the window are shared by both versions, so both
+  // versions are equivalent iff their windows are. Replacing the window by an
+  // equivalent one preserves the equivalence to the first circuit. A window
+  // that changes the unitary only disproves the equivalence of the edited
+  // pair if all circuits describe unitaries (on the same qubits).
+  auto equivalence = EquivalenceCriterion::NoInformation;
+  if (strength(windowResults.equivalence) > 0U) {
+    equivalence = strength(windowResults.equivalence) < strength(previous)
+                      ? windowResults.equivalence
+                      : previous;
+  } else if (windowResults.equivalence ==
+                 EquivalenceCriterion::NotEquivalent &&
+             strength(previous) > 1U &&
+             qc1->getNqubits() == edited.getNqubits() &&
+             describesUnitary(*qc1) && describesUnitary(edited)) {
+    equivalence = EquivalenceCriterion::NotEquivalent;
+  } else {
+    return false;
+  }
+
+  // the probabilities of an undetected error add up over both checks
+  double falseNegativeProbability = 0.;
+  for (const auto& res : {results, windowResults}) {
+    if (res.equivalence == EquivalenceCriterion::ProbablyEquivalent) {
+      falseNegativeProbability += res.falseNegativeProbability;
+    }
+  }
+  results = std::move(windowResults);
+  results.equivalence = equivalence;
+  if (equivalence == EquivalenceCriterion::ProbablyEquivalent) {
+    results.falseNegativeProbability = std::min(1., falseNegativeProbability);
+  }
+  // counterexamples of the window are no counterexamples of the full pair
+  results.cexInput = {};
+  results.cexOutput1 = {};
+  results.cexOutput2 = {};
+  results.cexStimulus.reset();
+  results.counterexample.reset();
+  if (begin == end && begin == editedEnd) {
+    const auto stop = std::chrono::steady_clock::now();
+    results.checkTime = std::chrono::duration<double>(stop - start).count();
+  }
+  incremental = true;
+  return true;
+}
+} // namespace ec
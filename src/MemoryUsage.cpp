@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "MemoryUsage.hpp"
+
+#include <cstddef>
+
+#if defined(_WIN32)
+// clang-format off
+#include <windows.h>
+#include <psapi.h>
+// clang-format on
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace ec {
+
+std::size_t getCurrentRSS() noexcept {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS info{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)) == 0) {
+    return 0U;
+  }
+  return static_cast<std::size_t>(info.WorkingSetSize);
+#elif defined(__APPLE__)
+  mach_task_basic_info info{};
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info),
+                &count) != KERN_SUCCESS) {
+    return 0U;
+  }
+  return static_cast<std::size_t>(info.resident_size);
+#elif defined(__linux__)
+  // the second entry of /proc/self/statm is the number of resident pages
+  std::FILE* file = std::fopen("/proc/self/statm", "r");
+  if (file == nullptr) {
+    return 0U;
+  }
+  unsigned long size = 0U;
+  unsigned long resident = 0U;
+  const auto read = std::fscanf(file, "%lu %lu", &size, &resident);
+  std::fclose(file);
+  if (read != 2) {
+    return 0U;
+  }
+  return static_cast<std::size_t>(resident) *
+         static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 0U;
+#endif
+}
+
+std::size_t getPeakRSS() noexcept {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS info{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)) == 0) {
+    return 0U;
+  }
+  return static_cast<std::size_t>(info.PeakWorkingSetSize);
+#elif defined(__APPLE__) || defined(__linux__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0U;
+  }
+#if defined(__APPLE__)
+  // reported in bytes on macOS
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  // reported in kilobytes on Linux
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024U;
+#endif
+#else
+  return 0U;
+#endif
+}
+} // namespace ec
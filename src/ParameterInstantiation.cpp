@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ParameterInstantiation.hpp"
+
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Expression.hpp"
+#include "ir/operations/SymbolicOperation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ec {
+
+namespace {
+using Matrix = std::vector<std::vector<double>>;
+
+// the Moore-Penrose pseudo-inverse of the given matrix A, computed from the
+// eigendecomposition A^T A = V diag(l) V^T (via Jacobi rotations) as
+// V diag(1/l) V^T A^T. The number of columns (variables) is typically small.
+Matrix pseudoInverse(const Matrix& a, const std::size_t cols) {
+  const auto rows = a.size();
+  Matrix ata(cols, std::vector<double>(cols, 0.));
+  for (const auto& row : a) {
+    for (std::size_t i = 0U; i < cols; ++i) {
+      for (std::size_t j = 0U; j < cols; ++j) {
+        ata[i][j] += row[i] * row[j];
+      }
+    }
+  }
+
+  Matrix v(cols, std::vector<double>(cols, 0.));
+  for (std::size_t i = 0U; i < cols; ++i) {
+    v[i][i] = 1.;
+  }
+
+  constexpr std::size_t maxSweeps = 100U;
+  for (std::size_t sweep = 0U; sweep < maxSweeps; ++sweep) {
+    double off = 0.;
+    double diagonal = 0.;
+    for (std::size_t p = 0U; p < cols; ++p) {
+      diagonal += ata[p][p] * ata[p][p];
+      for (std::size_t q = p + 1U; q < cols; ++q) {
+        off += ata[p][q] * ata[p][q];
+      }
+    }
+    if (off <= std::numeric_limits<double>::epsilon() *
+                   std::numeric_limits<double>::epsilon() * diagonal) {
+      break;
+    }
+    for (std::size_t p = 0U; p < cols; ++p) {
+      for (std::size_t q = p + 1U; q < cols; ++q) {
+        if (ata[p][q] == 0.) {
+          continue;
+        }
+        // the rotation that eliminates the (p, q) entry
+        const auto theta = (ata[q][q] - ata[p][p]) / (2. * ata[p][q]);
+        const auto t = std::copysign(1., theta) /
+                       (std::abs(theta) + std::sqrt((theta * theta) + 1.));
+        const auto c = 1. / std::sqrt((t * t) + 1.);
+        const auto s = t * c;
+        for (std::size_t k = 0U; k < cols; ++k) {
+          const auto akp = ata[k][p];
+          const auto akq = ata[k][q];
+          ata[k][p] = (c * akp) - (s * akq);
+          ata[k][q] = (s * akp) + (c * akq);
+        }
+        for (std::size_t k = 0U; k < cols; ++k) {
+          const auto apk = ata[p][k];
+          const auto aqk = ata[q][k];
+          ata[p][k] = (c * apk) - (s * aqk);
+          ata[q][k] = (s * apk) + (c * aqk);
+        }
+        for (std::size_t k = 0U; k < cols; ++k) {
+          const auto vkp = v[k][p];
+          const auto vkq = v[k][q];
+          v[k][p] = (c * vkp) - (s * vkq);
+          v[k][q] = (s * vkp) + (c * vkq);
+        }
+      }
+    }
+  }
+
+  // eigenvalues below the tolerance correspond to the null space of A
+  double largest = 0.;
+  for (std::size_t i = 0U; i < cols; ++i) {
+    largest = std::max(largest, std::abs(ata[i][i]));
+  }
+  const auto cutoff = static_cast<double>(std::max(rows, cols)) *
+                      std::numeric_limits<double>::epsilon() * largest;
+
+  // (A^T A)^+ = V diag(1/l) V^T
+  Matrix inverse(cols, std::vector<double>(cols, 0.));
+  for (std::size_t k = 0U; k < cols; ++k) {
+    if (ata[k][k] <= cutoff) {
+      continue;
+    }
+    const auto factor = 1. / ata[k][k];
+    for (std::size_t i = 0U; i < cols; ++i) {
+      for (std::size_t j = 0U; j < cols; ++j) {
+        inverse[i][j] += v[i][k] * factor * v[j][k];
+      }
+    }
+  }
+
+  // A^+ = (A^T A)^+ A^T
+  Matrix result(cols, std::vector<double>(rows, 0.));
+  for (std::size_t i = 0U; i < cols; ++i) {
+    for (std::size_t r = 0U; r < rows; ++r) {
+      for (std::size_t j = 0U; j < cols; ++j) {
+        result[i][r] += inverse[i][j] * a[r][j];
+      }
+    }
+  }
+  return result;
+}
+} // namespace
+
+ParameterInstantiation::ParameterInstantiation(
+    const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2) {
+  for (const auto* qc : {&qc1, &qc2}) {
+    for (const auto& variable : qc->getVariables()) {
+      if (std::ranges::find(variables, variable) == variables.end()) {
+        variables.emplace_back(variable);
+      }
+    }
+  }
+  // the order of the variables determines the random instantiations
+  std::ranges::sort(variables, [](const auto& lhs, const auto& rhs) {
+    return lhs.getName() < rhs.getName();
+  });
+  std::unordered_map<sym::Variable, std::size_t> columns{};
+  for (std::size_t i = 0U; i < variables.size(); ++i) {
+    columns.emplace(variables[i], i);
+  }
+
+  Matrix equations{};
+  for (const auto* qc : {&qc1, &qc2}) {
+    for (const auto& op : *qc) {
+      if (!op->isSymbolicOperation()) {
+        continue;
+      }
+      const auto* symOp = dynamic_cast<const qc::SymbolicOperation*>(op.get());
+      for (const auto& parameter : symOp->getParameters()) {
+        const auto* expr = std::get_if<qc::Symbolic>(&parameter);
+        if (expr == nullptr || expr->isConstant()) {
+          continue;
+        }
+        auto& row = equations.emplace_back(variables.size(), 0.);
+        for (const auto& term : *expr) {
+          row[columns.at(term.getVar())] += term.getCoeff();
+        }
+        offsets.emplace_back(-expr->getConst());
+      }
+    }
+  }
+
+  if (!equations.empty() && !variables.empty()) {
+    pseudoInverse = ec::pseudoInverse(equations, variables.size());
+  } else {
+    pseudoInverse.assign(variables.size(),
+                         std::vector<double>(offsets.size(), 0.));
+  }
+}
+
+qc::VariableAssignment
+ParameterInstantiation::solve(const std::vector<double>& values) const {
+  qc::VariableAssignment assignment{};
+  for (std::size_t i = 0U; i < variables.size(); ++i) {
+    double value = 0.;
+    for (std::size_t r = 0U; r < values.size(); ++r) {
+      value += pseudoInverse[i][r] * values[r];
+    }
+    assignment.emplace(variables[i], value);
+  }
+  return assignment;
+}
+
+qc::VariableAssignment ParameterInstantiation::zero() const {
+  return solve(offsets);
+}
+
+qc::VariableAssignment
+ParameterInstantiation::randomPhases(std::mt19937_64& mt) const {
+  constexpr std::array PHASES{0., qc::PI, qc::PI_2, -qc::PI_2, qc::PI_4,
+                              -qc::PI_4};
+  std::uniform_int_distribution<std::size_t> distribution(0U,
+                                                          PHASES.size() - 1U);
+  auto values = offsets;
+  for (auto& value : values) {
+    value += PHASES.at(distribution(mt));
+  }
+  return solve(values);
+}
+
+qc::VariableAssignment
+ParameterInstantiation::random(std::mt19937_64& mt) const {
+  std::uniform_real_distribution<double> distribution(0., 2. * qc::PI);
+  qc::VariableAssignment assignment{};
+  for (const auto& variable : variables) {
+    assignment.emplace(variable, distribution(mt));
+  }
+  return assignment;
+}
+
+qc::QuantumComputation
+ParameterInstantiation::instantiate(const qc::QuantumComputation& qc,
+                                    const qc::VariableAssignment& assignment,
+                                    const double tolerance) {
+  auto instantiated = qc.instantiate(assignment);
+  // parameters that vanish (up to numerical inaccuracies) are rounded to zero
+  for (auto& op : instantiated) {
+    auto parameters = op->getParameter();
+    bool rounded = false;
+    for (auto& parameter : parameters) {
+      if (parameter != 0. && std::abs(parameter) < tolerance) {
+        parameter = 0.;
+        rounded = true;
+      }
+    }
+    if (rounded) {
+      op->setParameter(parameters);
+    }
+  }
+  return instantiated;
+}
+} // namespace ec
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "PreprocessingCache.hpp"
+
+#include "Configuration.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+#include "ir/operations/Operation.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace ec {
+
+namespace {
+// bumped whenever the preprocessing or the on-disk format changes
+constexpr std::uint64_t FORMAT_VERSION = 2U;
+
+constexpr std::uint64_t FNV_OFFSET = 14'695'981'039'346'656'037ULL;
+constexpr std::uint64_t FNV_PRIME = 1'099'511'628'211ULL;
+
+void combine(std::uint64_t& h, const std::uint64_t value) noexcept {
+  for (std::size_t i = 0U; i < sizeof(value); ++i) {
+    h ^= (value >> (8U * i)) & 0xFFU;
+    h *= FNV_PRIME;
+  }
+}
+
+void combine(std::uint64_t& h, const std::string_view str) noexcept {
+  for (const auto c : str) {
+    h ^= static_cast<unsigned char>(c);
+    h *= FNV_PRIME;
+  }
+  combine(h, str.size());
+}
+
+std::uint64_t hashOptimizations(const Configuration::Optimizations& opt) {
+  std::uint64_t flags = 0U;
+  for (const auto flag :
+       {opt.fuseSingleQubitGates, opt.reconstructSWAPs,
+        opt.removeDiagonalGatesBeforeMeasure, opt.transformDynamicCircuit,
+        opt.reorderOperations, opt.backpropagateOutputPermutation,
+        opt.elidePermutations}) {
+    flags = (flags << 1U) | (flag ? 1U : 0U);
+  }
+  return flags;
+}
+
+std::string toHex(const std::uint64_t value) {
+  std::ostringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << value;
+  return ss.str();
+}
+
+nlohmann::json layoutJson(const qc::Permutation& permutation) {
+  auto j = nlohmann::json::array();
+  for (const auto& [physical, logical] : permutation) {
+    j.push_back({physical, logical});
+  }
+  return j;
+}
+
+qc::Permutation layoutFromJson(const nlohmann::json& j) {
+  qc::Permutation permutation{};
+  for (const auto& entry : j) {
+    permutation[entry.at(0).get<qc::Qubit>()] = entry.at(1).get<qc::Qubit>();
+  }
+  return permutation;
+}
+
+// OpenQASM has no notion of compound operations (e.g., fused single-qubit
+// gates), so they are exported as their individual operations. Their structure
+// is described by pairs of the index of their first operation (in the exported
+// circuit) and their number of operations.
+std::optional<nlohmann::json>
+compoundStructure(const qc::QuantumComputation& qc) {
+  auto compounds = nlohmann::json::array();
+  std::size_t position = 0U;
+  for (const auto& op : qc) {
+    if (!op->isCompoundOperation()) {
+      ++position;
+      continue;
+    }
+    const auto& compound = dynamic_cast<const qc::CompoundOperation&>(*op);
+    for (const auto& nested : compound) {
+      if (nested->isCompoundOperation()) {
+        // nested compound operations are not supported
+        return std::nullopt;
+      }
+    }
+    if (compound.empty()) {
+      return std::nullopt;
+    }
+    compounds.push_back({position, compound.size()});
+    position += compound.size();
+  }
+  return compounds;
+}
+
+void restoreCompounds(qc::QuantumComputation& qc,
+                      const nlohmann::json& compounds) {
+  if (compounds.empty()) {
+    return;
+  }
+  std::vector<std::unique_ptr<qc::Operation>> ops{};
+  ops.reserve(qc.getNops());
+  for (auto& op : qc) {
+    ops.emplace_back(std::move(op));
+  }
+  qc.clear();
+  std::size_t position = 0U;
+  for (const auto& entry : compounds) {
+    const auto first = entry.at(0).get<std::size_t>();
+    const auto count = entry.at(1).get<std::size_t>();
+    if (first < position || count > ops.size() - first) {
+      throw std::invalid_argument("Invalid compound operation in cache entry");
+    }
+    for (; position < first; ++position) {
+      qc.emplace_back(std::move(ops[position]));
+    }
+    const auto begin = ops.begin() + static_cast<std::ptrdiff_t>(first);
+    std::vector<std::unique_ptr<qc::Operation>> group(
+        std::make_move_iterator(begin),
+        std::make_move_iterator(begin + static_cast<std::ptrdiff_t>(count)));
+    qc.emplace_back(std::make_unique<qc::CompoundOperation>(std::move(group)));
+    position = first + count;
+  }
+  for (; position < ops.size(); ++position) {
+    qc.emplace_back(std::move(ops[position]));
+  }
+}
+
+std::filesystem::path entryPath(const std::string& directory,
+                                const std::string& key,
+                                const std::string& suffix) {
+  return std::filesystem::path(directory) / (key + suffix);
+}
+
+// the suffix of the temporary files of this thread. Processes sharing a cache
+// directory (and threads within them) write the same entry to separate files.
+std::string temporarySuffix() {
+#if defined(_WIN32)
+  const auto pid = static_cast<std::uint64_t>(_getpid());
+#elif defined(__unix__) || defined(__APPLE__)
+  const auto pid = static_cast<std::uint64_t>(getpid());
+#else
+  const std::uint64_t pid = 0U;
+#endif
+  const auto thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return ".tmp" + std::to_string(pid) + "-" + std::to_string(thread);
+}
+
+// write to a temporary file first so that concurrent readers never observe
+// partially written entries
+void writeAtomically(const std::filesystem::path& path,
+                     const std::string& content) {
+  auto tmp = path;
+  tmp += temporarySuffix();
+  {
+    std::ofstream ofs(tmp, std::ios::binary);
+    ofs << content;
+    if (!ofs) {
+      return;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp, path, ec);
+  if (ec) {
+    std::filesystem::remove(tmp, ec);
+  }
+}
+
+std::optional<PreprocessingCache::Circuits>
+load(const std::string& directory, const std::string& key) {
+  std::ifstream meta(entryPath(directory, key, ".json"));
+  if (!meta) {
+    return std::nullopt;
+  }
+  try {
+    const auto j = nlohmann::json::parse(meta);
+    if (j.at("version").get<std::uint64_t>() != FORMAT_VERSION) {
+      return std::nullopt;
+    }
+    PreprocessingCache::Circuits circuits{};
+    const auto& descriptions = j.at("circuits");
+    for (std::size_t i = 0U; i < descriptions.size(); ++i) {
+      const auto& desc = descriptions[i];
+      auto qc = qasm3::Importer::importf(
+          entryPath(directory, key, "." + std::to_string(i) + ".qasm")
+              .string());
+      if (qc.getNqubits() != desc.at("nqubits").get<std::size_t>() ||
+          qc.getNops() != desc.at("operations").get<std::size_t>()) {
+        return std::nullopt;
+      }
+      restoreCompounds(qc, desc.at("compounds"));
+      for (const auto q : desc.at("ancillary").get<std::vector<qc::Qubit>>()) {
+        qc.setLogicalQubitAncillary(q);
+      }
+      for (const auto q : desc.at("garbage").get<std::vector<qc::Qubit>>()) {
+        qc.setLogicalQubitGarbage(q);
+      }
+      // restore the layout last since marking garbage qubits adjusts it
+      qc.initialLayout = layoutFromJson(desc.at("initial_layout"));
+      qc.outputPermutation = layoutFromJson(desc.at("output_permutation"));
+      circuits.emplace_back(
+          std::make_shared<const qc::QuantumComputation>(std::move(qc)));
+    }
+    return circuits;
+  } catch (const std::exception& /*e*/) {
+    // corrupt or incompatible entries are treated as misses
+    return std::nullopt;
+  }
+}
+
+void save(const std::string& directory, const std::string& key,
+          const PreprocessingCache::Circuits& circuits) {
+  std::vector<nlohmann::json> structures{};
+  for (const auto& qc : circuits) {
+    auto structure = compoundStructure(*qc);
+    if (!structure) {
+      return;
+    }
+    structures.emplace_back(std::move(*structure));
+  }
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec) {
+    return;
+  }
+  nlohmann::json j{};
+  j["version"] = FORMAT_VERSION;
+  auto& descriptions = j["circuits"];
+  descriptions = nlohmann::json::array();
+  for (std::size_t i = 0U; i < circuits.size(); ++i) {
+    const auto& qc = *circuits[i];
+    nlohmann::json desc{};
+    desc["nqubits"] = qc.getNqubits();
+    std::vector<qc::Qubit> ancillary{};
+    std::vector<qc::Qubit> garbage{};
+    for (qc::Qubit q = 0U; q < qc.getNqubits(); ++q) {
+      if (qc.logicalQubitIsAncillary(q)) {
+        ancillary.emplace_back(q);
+      }
+      if (qc.logicalQubitIsGarbage(q)) {
+        garbage.emplace_back(q);
+      }
+    }
+    desc["ancillary"] = ancillary;
+    desc["garbage"] = garbage;
+    desc["initial_layout"] = layoutJson(qc.initialLayout);
+    desc["output_permutation"] = layoutJson(qc.outputPermutation);
+    desc["compounds"] = structures[i];
+    std::size_t operations = qc.getNops();
+    for (const auto& compound : structures[i]) {
+      operations += compound.at(1).get<std::size_t>() - 1U;
+    }
+    desc["operations"] = operations;
+    descriptions.push_back(desc);
+    writeAtomically(
+        entryPath(directory, key, "." + std::to_string(i) + ".qasm"),
+        qc.toQASM());
+  }
+  // the metadata is written last and marks the entry as complete
+  writeAtomically(entryPath(directory, key, ".json"), j.dump());
+}
+} // namespace
+
+PreprocessingCache& PreprocessingCache::global() {
+  static PreprocessingCache cache{};
+  return cache;
+}
+
+std::uint64_t PreprocessingCache::hash(const qc::QuantumComputation& qc) {
+  std::uint64_t h = FNV_OFFSET;
+  combine(h, FORMAT_VERSION);
+  combine(h, qc.getNqubits());
+  combine(h, qc.getNcbits());
+  combine(h, qc.toQASM());
+  for (const auto* permutation : {&qc.initialLayout, &qc.outputPermutation}) {
+    combine(h, permutation->size());
+    for (const auto& [physical, logical] : *permutation) {
+      combine(h, physical);
+      combine(h, logical);
+    }
+  }
+  for (qc::Qubit q = 0U; q < qc.getNqubits(); ++q) {
+    combine(h, (qc.logicalQubitIsAncillary(q) ? 1U : 0U) |
+                   (qc.logicalQubitIsGarbage(q) ? 2U : 0U));
+  }
+  return h;
+}
+
+std::string
+PreprocessingCache::circuitKey(const std::uint64_t circuitHash,
+                               const Configuration::Optimizations& opt) {
+  std::uint64_t h = FNV_OFFSET;
+  combine(h, circuitHash);
+  combine(h, hashOptimizations(opt));
+  return "circuit-" + toHex(h);
+}
+
+std::string PreprocessingCache::pairKey(const std::uint64_t hash1,
+                                        const std::uint64_t hash2,
+                                        const Configuration::Optimizations& opt,
+                                        const bool optimized1,
+                                        const bool optimized2) {
+  std::uint64_t h = FNV_OFFSET;
+  combine(h, hash1);
+  combine(h, hash2);
+  combine(h, hashOptimizations(opt));
+  combine(h, (optimized1 ? 1U : 0U) | (optimized2 ? 2U : 0U));
+  return "pair-" + toHex(h);
+}
+
+std::optional<PreprocessingCache::Circuits>
+PreprocessingCache::lookup(const std::string& key,
+                           const std::string& directory) {
+  {
+    const std::lock_guard lock(mutex);
+    if (const auto it = entries.find(key); it != entries.end()) {
+      ++hits;
+      return it->second;
+    }
+  }
+  if (!directory.empty()) {
+    if (auto circuits = load(directory, key)) {
+      const std::lock_guard lock(mutex);
+      ++hits;
+      insert(key, *circuits);
+      return circuits;
+    }
+  }
+  const std::lock_guard lock(mutex);
+  ++misses;
+  return std::nullopt;
+}
+
+void PreprocessingCache::store(const std::string& key,
+                               const Circuits& circuits,
+                               const std::string& directory) {
+  {
+    const std::lock_guard lock(mutex);
+    insert(key, circuits);
+  }
+  if (!directory.empty()) {
+    save(directory, key, circuits);
+  }
+}
+
+void PreprocessingCache::insert(const std::string& key,
+                                const Circuits& circuits) {
+  if (maxEntries == 0U) {
+    return;
+  }
+  if (entries.insert_or_assign(key, circuits).second) {
+    order.emplace_back(key);
+  }
+  while (entries.size() > maxEntries) {
+    entries.erase(order.front());
+    order.pop_front();
+  }
+}
+
+std::size_t PreprocessingCache::size() const {
+  const std::lock_guard lock(mutex);
+  return entries.size();
+}
+
+std::size_t PreprocessingCache::getHits() const {
+  const std::lock_guard lock(mutex);
+  return hits;
+}
+
+std::size_t PreprocessingCache::getMisses() const {
+  const std::lock_guard lock(mutex);
+  return misses;
+}
+
+void PreprocessingCache::clear() {
+  const std::lock_guard lock(mutex);
+  entries.clear();
+  order.clear();
+}
+} // namespace ec
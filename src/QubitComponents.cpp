@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "QubitComponents.hpp"
+
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+namespace {
+class UnionFind {
+public:
+  explicit UnionFind(const std::size_t n) : parents(n) {
+    std::iota(parents.begin(), parents.end(), 0U);
+  }
+
+  [[nodiscard]] std::size_t find(std::size_t i) {
+    while (parents[i] != i) {
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  }
+
+  void unite(const std::size_t i, const std::size_t j) {
+    const auto a = find(i);
+    const auto b = find(j);
+    if (a != b) {
+      parents[std::max(a, b)] = std::min(a, b);
+    }
+  }
+
+private:
+  std::vector<std::size_t> parents;
+};
+
+bool decomposable(const qc::QuantumComputation& qc, const std::size_t n) {
+  const auto inRange = [n](const auto& pair) {
+    return pair.first < n && pair.second < n;
+  };
+  return qc.getNqubits() == n && qc.initialLayout.size() == n &&
+         qc.outputPermutation.size() == n &&
+         std::ranges::all_of(qc.initialLayout, inRange) &&
+         std::ranges::all_of(qc.outputPermutation, inRange) &&
+         std::ranges::all_of(qc, [](const auto& op) {
+           return op->getType() == qc::Barrier || op->isUnitary();
+         });
+}
+
+// merge the logical qubits that are connected by the circuit
+void connect(const qc::QuantumComputation& qc, UnionFind& components) {
+  for (const auto& [physical, logical] : qc.initialLayout) {
+    components.unite(logical, qc.outputPermutation.at(physical));
+  }
+  for (const auto& op : qc) {
+    if (op->getType() == qc::Barrier) {
+      continue;
+    }
+    const auto used = op->getUsedQubits();
+    if (used.empty()) {
+      continue;
+    }
+    const auto first = qc.initialLayout.at(*used.begin());
+    for (const auto qubit : used) {
+      components.unite(first, qc.initialLayout.at(qubit));
+    }
+  }
+}
+
+// the restriction of the circuit to the given (sorted) logical qubits
+qc::QuantumComputation restrict(const qc::QuantumComputation& qc,
+                                const std::vector<qc::Qubit>& logicals,
+                                const bool withGlobalPhase) {
+  std::unordered_map<qc::Qubit, qc::Qubit> local{};
+  for (std::size_t i = 0U; i < logicals.size(); ++i) {
+    local.emplace(logicals[i], static_cast<qc::Qubit>(i));
+  }
+  // the physical qubits carrying the component are renumbered in order
+  qc::Permutation physicals{};
+  for (const auto& [physical, logical] : qc.initialLayout) {
+    if (local.contains(logical)) {
+      const auto next = static_cast<qc::Qubit>(physicals.size());
+      physicals.emplace(physical, next);
+    }
+  }
+
+  auto sub = qc::QuantumComputation(logicals.size());
+  sub.initialLayout.clear();
+  sub.outputPermutation.clear();
+  for (const auto& [physical, next] : physicals) {
+    sub.initialLayout.emplace(next, local.at(qc.initialLayout.at(physical)));
+    sub.outputPermutation.emplace(
+        next, local.at(qc.outputPermutation.at(physical)));
+  }
+  for (const auto logical : logicals) {
+    if (qc.logicalQubitIsAncillary(logical)) {
+      sub.setLogicalQubitAncillary(local.at(logical));
+    }
+    if (qc.logicalQubitIsGarbage(logical)) {
+      sub.setLogicalQubitGarbage(local.at(logical));
+    }
+  }
+
+  for (const auto& op : qc) {
+    if (op->getType() == qc::Barrier) {
+      continue;
+    }
+    const auto used = op->getUsedQubits();
+    if (used.empty()) {
+      // operations without qubits (e.g., global phases) only occur once
+      if (withGlobalPhase) {
+        sub.emplace_back(op->clone());
+      }
+      continue;
+    }
+    if (!physicals.contains(*used.begin())) {
+      continue;
+    }
+    auto copy = op->clone();
+    copy->apply(physicals);
+    sub.emplace_back(std::move(copy));
+  }
+  if (withGlobalPhase) {
+    sub.gphase(qc.getGlobalPhase());
+  }
+  return sub;
+}
+} // namespace
+
+std::vector<ComponentPair>
+splitIntoComponents(const qc::QuantumComputation& qc1,
+                    const qc::QuantumComputation& qc2) {
+  const auto n = qc1.getNqubits();
+  if (n < 2U || !decomposable(qc1, n) || !decomposable(qc2, n)) {
+    return {};
+  }
+
+  UnionFind components(n);
+  connect(qc1, components);
+  connect(qc2, components);
+
+  std::unordered_map<std::size_t, std::size_t> indices{};
+  std::vector<std::vector<qc::Qubit>> groups{};
+  for (std::size_t logical = 0U; logical < n; ++logical) {
+    const auto root = components.find(logical);
+    const auto [it, inserted] = indices.try_emplace(root, groups.size());
+    if (inserted) {
+      groups.emplace_back();
+    }
+    groups[it->second].emplace_back(static_cast<qc::Qubit>(logical));
+  }
+  if (groups.size() < 2U) {
+    return {};
+  }
+
+  // small components are checked first, since they are the quickest to show
+  // a potential non-equivalence
+  std::ranges::stable_sort(groups, [](const auto& lhs, const auto& rhs) {
+    return lhs.size() < rhs.size();
+  });
+  std::vector<ComponentPair> pairs{};
+  pairs.reserve(groups.size());
+  for (std::size_t i = 0U; i < groups.size(); ++i) {
+    pairs.emplace_back(restrict(qc1, groups[i], i == 0U),
+                       restrict(qc2, groups[i], i == 0U));
+  }
+  return pairs;
+}
+} // namespace ec
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "SubproblemScheduler.hpp"
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+namespace {
+// the state shared with the tasks on the thread pool. Tasks that only start
+// once the run has been closed return right away, since everything else
+// referenced by them might not exist anymore.
+struct RunState {
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::size_t running = 0U;
+  bool closed = false;
+  const std::function<void()>* work = nullptr;
+};
+} // namespace
+
+bool SubproblemScheduler::pending(const std::size_t index) const {
+  if (cancelled) {
+    return false;
+  }
+  return options.cancellation != Cancellation::Later || index < disproof;
+}
+
+void SubproblemScheduler::disprove(const std::size_t index) {
+  auto current = disproof.load();
+  while (index < current && !disproof.compare_exchange_weak(current, index)) {
+  }
+  if (options.cancellation == Cancellation::None) {
+    return;
+  }
+  const std::lock_guard lock(activeMutex);
+  for (std::size_t j = 0U; j < active.size(); ++j) {
+    if (active[j] != nullptr && j != index &&
+        (options.cancellation == Cancellation::All || j > index)) {
+      active[j]->setAndSignalDone();
+    }
+  }
+}
+
+void SubproblemScheduler::cancel() {
+  cancelled = true;
+  const std::lock_guard lock(activeMutex);
+  for (auto* const manager : active) {
+    if (manager != nullptr) {
+      manager->setAndSignalDone();
+    }
+  }
+}
+
+std::optional<std::size_t> SubproblemScheduler::firstDisproof() const {
+  if (disproof >= numSubproblems) {
+    return std::nullopt;
+  }
+  return disproof.load();
+}
+
+std::vector<std::optional<SubproblemScheduler::Results>>
+SubproblemScheduler::run(const std::size_t count, const Configuration& config,
+                         const Factory& factory,
+                         const ResultCallback& callback) {
+  numSubproblems = count;
+  disproof = count;
+  numChecked = 0U;
+  {
+    const std::lock_guard lock(activeMutex);
+    active.assign(count, nullptr);
+  }
+
+  std::vector<std::optional<Results>> results(count);
+  std::mutex callbackMutex;
+  std::exception_ptr firstError{};
+
+  const auto check = [&](const std::size_t i) {
+    if (!pending(i)) {
+      return;
+    }
+    auto subConfig = config;
+    if (options.timeout > 0.) {
+      const auto elapsed = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - options.start)
+                               .count();
+      const auto remaining = options.timeout - elapsed;
+      if (remaining <= 0.) {
+        return;
+      }
+      subConfig.execution.timeout = remaining;
+    }
+    const auto manager = factory(i, subConfig);
+    if (manager == nullptr) {
+      return;
+    }
+    {
+      const std::lock_guard lock(activeMutex);
+      active[i] = manager.get();
+    }
+    // a cancellation that races with the start of the run only costs time,
+    // since the results of cancelled sub-problems are not conclusive anyway
+    if (pending(i)) {
+      manager->run();
+    }
+    {
+      const std::lock_guard lock(activeMutex);
+      active[i] = nullptr;
+    }
+
+    auto& res = results[i].emplace(manager->getResults());
+    // the counterexample DDs live in the package of the manager
+    res.cexInput = {};
+    res.cexOutput1 = {};
+    res.cexOutput2 = {};
+    ++numChecked;
+    if (res.equivalence == EquivalenceCriterion::NotEquivalent) {
+      disprove(i);
+    }
+    if (callback) {
+      const std::lock_guard lock(callbackMutex);
+      callback(i, res);
+    }
+  };
+
+  std::atomic<std::size_t> next{0U};
+  const std::function<void()> work = [&] {
+    while (true) {
+      const auto i = next.fetch_add(1U);
+      if (i >= count) {
+        return;
+      }
+      try {
+        check(i);
+      } catch (...) {
+        {
+          const std::lock_guard lock(callbackMutex);
+          if (!firstError) {
+            firstError = std::current_exception();
+          }
+        }
+        if (options.cancellation != Cancellation::None) {
+          cancel();
+        }
+      }
+    }
+  };
+
+  const auto workers = std::min(options.concurrency, count);
+  if (workers <= 1U || options.threadPool == nullptr) {
+    work();
+  } else {
+    const auto state = std::make_shared<RunState>();
+    state->work = &work;
+    for (std::size_t i = 1U; i < workers; ++i) {
+      static_cast<void>(options.threadPool->submit([state] {
+        {
+          const std::lock_guard lock(state->mutex);
+          if (state->closed) {
+            return;
+          }
+          ++state->running;
+        }
+        (*state->work)();
+        const std::lock_guard lock(state->mutex);
+        --state->running;
+        state->finished.notify_all();
+      }));
+    }
+    // the calling thread checks sub-problems as well and then waits for the
+    // sub-problems still being checked on the pool
+    work();
+    std::unique_lock lock(state->mutex);
+    state->closed = true;
+    state->finished.wait(lock, [&state] { return state->running == 0U; });
+  }
+
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+  return results;
+}
+} // namespace ec
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ec {
+
+namespace {
+// identifies the pool (and the worker within it) the current thread belongs to
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentWorker = 0U;
+} // namespace
+
+ThreadPool::ThreadPool(const std::size_t nthreads) {
+  const auto n = std::max<std::size_t>(1U, nthreads);
+  queues.reserve(n);
+  for (std::size_t i = 0U; i < n; ++i) {
+    queues.emplace_back(std::make_unique<WorkQueue>());
+  }
+  workers.reserve(n);
+  for (std::size_t i = 0U; i < n; ++i) {
+    workers.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard lock(sleepMutex);
+    stopping = true;
+  }
+  sleepCond.notify_all();
+  for (auto& worker : workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void ThreadPool::enqueue(Task task) {
+  std::size_t index = 0U;
+  if (currentPool == this) {
+    // tasks spawned by a worker stay local to that worker
+    index = currentWorker;
+  } else {
+    const std::lock_guard lock(sleepMutex);
+    index = nextQueue;
+    nextQueue = (nextQueue + 1U) % queues.size();
+  }
+  {
+    auto& queue = *queues[index];
+    const std::lock_guard lock(queue.mutex);
+    queue.tasks.emplace_back(std::move(task));
+  }
+  {
+    const std::lock_guard lock(sleepMutex);
+    ++pending;
+  }
+  sleepCond.notify_one();
+}
+
+bool ThreadPool::tryPop(const std::size_t index, Task& task) {
+  // first, try the own queue (most recently pushed task first)
+  {
+    auto& own = *queues[index];
+    const std::lock_guard lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  // then, try to steal the oldest task from any other queue
+  for (std::size_t offset = 1U; offset < queues.size(); ++offset) {
+    auto& other = *queues[(index + offset) % queues.size()];
+    const std::lock_guard lock(other.mutex);
+    if (!other.tasks.empty()) {
+      task = std::move(other.tasks.front());
+      other.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::runPendingTask() {
+  {
+    const std::lock_guard lock(sleepMutex);
+    if (pending == 0U) {
+      return false;
+    }
+    // reserve one of the pending tasks
+    --pending;
+  }
+  const auto index = currentPool == this ? currentWorker : 0U;
+  Task task{};
+  // a reserved task is guaranteed to be present in one of the queues
+  while (!tryPop(index, task)) {
+    std::this_thread::yield();
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::workerLoop(const std::size_t index) {
+  currentPool = this;
+  currentWorker = index;
+  while (true) {
+    {
+      std::unique_lock lock(sleepMutex);
+      sleepCond.wait(lock, [this] { return stopping || pending > 0U; });
+      if (pending == 0U) {
+        // only reached when stopping and all work has been processed
+        return;
+      }
+      --pending;
+    }
+    Task task{};
+    while (!tryPop(index, task)) {
+      std::this_thread::yield();
+    }
+    // exceptions are captured in the future of the packaged task
+    task();
+  }
+}
+} // namespace ec
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ToleranceLease.hpp"
+
+#include "dd/ComplexNumbers.hpp"
+#include "dd/DDDefinitions.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace ec {
+
+namespace {
+// the leases currently held in the process
+std::mutex leaseMutex;
+std::size_t holders = 0U;
+bool exclusivelyHeld = false;
+dd::fp leasedTolerance = 0.;
+} // namespace
+
+ToleranceLease::ToleranceLease(const dd::fp tolerance, const bool exclusive)
+    : exclusive(exclusive) {
+  const std::lock_guard lock(leaseMutex);
+  if (holders > 0U) {
+    if (exclusive || exclusivelyHeld) {
+      throw std::runtime_error(
+          "Checks with per-checker numerical tolerances must not run "
+          "concurrently with other checks, since the tolerance is a "
+          "process-wide setting of the DD package.");
+    }
+    if (tolerance != leasedTolerance) {
+      throw std::runtime_error(
+          "Checks running concurrently must use the same numerical tolerance "
+          "(requested " +
+          std::to_string(tolerance) + " while " +
+          std::to_string(leasedTolerance) + " is in use).");
+    }
+  } else {
+    dd::ComplexNumbers::setTolerance(tolerance);
+    leasedTolerance = tolerance;
+    exclusivelyHeld = exclusive;
+  }
+  ++holders;
+}
+
+ToleranceLease::~ToleranceLease() {
+  const std::lock_guard lock(leaseMutex);
+  --holders;
+  if (holders == 0U) {
+    exclusivelyHeld = false;
+  }
+}
+
+void ToleranceLease::use(const dd::fp tolerance) const {
+  if (exclusive) {
+    // no other lease is held, so nothing else depends on the tolerance
+    dd::ComplexNumbers::setTolerance(tolerance);
+  }
+}
+} // namespace ec
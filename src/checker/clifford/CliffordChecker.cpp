@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/clifford/CliffordChecker.hpp"
+
+#include "EquivalenceCriterion.hpp"
+#include "checker/EquivalenceChecker.hpp"
+#include "checker/zx/ZXChecker.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/CompoundOperation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ec {
+namespace {
+// rotation angles within this distance of a multiple of pi/2 are considered
+// Clifford
+constexpr double ANGLE_TOLERANCE = 1e-12;
+
+// the number of quarter turns (modulo 4) the angle amounts to (if any)
+std::optional<std::size_t> quarterTurns(const double angle) {
+  const auto turns = std::round(angle / qc::PI_2);
+  if (std::abs(angle - (turns * qc::PI_2)) > ANGLE_TOLERANCE) {
+    return std::nullopt;
+  }
+  const auto k = static_cast<std::int64_t>(turns) % 4;
+  return static_cast<std::size_t>(k < 0 ? k + 4 : k);
+}
+
+// the layout as a vector mapping each physical qubit to its logical qubit
+// (empty if it is no permutation of the first `n` qubits)
+std::vector<std::size_t> layoutVector(const qc::Permutation& layout,
+                                      const std::size_t n) {
+  if (layout.size() != n) {
+    return {};
+  }
+  std::vector<std::size_t> logical(n, n);
+  std::vector<bool> used(n, false);
+  for (const auto& [physical, qubit] : layout) {
+    if (physical >= n || qubit >= n || used[qubit]) {
+      return {};
+    }
+    logical[physical] = qubit;
+    used[qubit] = true;
+  }
+  return logical;
+}
+
+std::vector<std::size_t> inverse(const std::vector<std::size_t>& permutation) {
+  std::vector<std::size_t> inv(permutation.size());
+  for (std::size_t i = 0U; i < permutation.size(); ++i) {
+    inv[permutation[i]] = i;
+  }
+  return inv;
+}
+
+// where the logical qubits of the circuit are located at its start and end
+struct Layouts {
+  std::vector<std::size_t> initial;
+  std::vector<std::size_t> output;
+};
+
+std::optional<Layouts> layouts(const qc::QuantumComputation& qc) {
+  const auto n = qc.getNqubits();
+  auto initial = layoutVector(qc.initialLayout, n);
+  if (initial.empty()) {
+    return std::nullopt;
+  }
+  auto output =
+      layoutVector(complete(qc.outputPermutation, qc.initialLayout), n);
+  if (output.empty()) {
+    return std::nullopt;
+  }
+  return Layouts{std::move(initial), std::move(output)};
+}
+} // namespace
+
+CliffordEquivalenceChecker::Tableau::Tableau(const std::size_t nqubits)
+    : xs(nqubits, Column((nqubits + 63U) / 64U, 0U)),
+      zs(nqubits, Column((nqubits + 63U) / 64U, 0U)),
+      signs((nqubits + 63U) / 64U, 0U) {
+  // the i-th generator of the all-zero state is Z_i
+  for (std::size_t q = 0U; q < nqubits; ++q) {
+    zs[q][q / 64U] = std::uint64_t{1} << (q % 64U);
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::h(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xs[q][k] & zs[q][k];
+  }
+  std::swap(xs[q], zs[q]);
+}
+
+void CliffordEquivalenceChecker::Tableau::s(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xs[q][k] & zs[q][k];
+    zs[q][k] ^= xs[q][k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::sdg(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xs[q][k] & ~zs[q][k];
+    zs[q][k] ^= xs[q][k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::x(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= zs[q][k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::y(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xs[q][k] ^ zs[q][k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::z(const std::size_t q) {
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xs[q][k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::cx(const std::size_t control,
+                                             const std::size_t target) {
+  auto& xc = xs[control];
+  auto& zc = zs[control];
+  auto& xt = xs[target];
+  auto& zt = zs[target];
+  for (std::size_t k = 0U; k < signs.size(); ++k) {
+    signs[k] ^= xc[k] & zt[k] & ~(xt[k] ^ zc[k]);
+    xt[k] ^= xc[k];
+    zc[k] ^= zt[k];
+  }
+}
+
+void CliffordEquivalenceChecker::Tableau::swap(const std::size_t q0,
+                                               const std::size_t q1) {
+  std::swap(xs[q0], xs[q1]);
+  std::swap(zs[q0], zs[q1]);
+}
+
+void CliffordEquivalenceChecker::Tableau::permute(
+    const std::vector<std::size_t>& permutation) {
+  std::vector<Column> permutedXs(permutation.size());
+  std::vector<Column> permutedZs(permutation.size());
+  for (std::size_t q = 0U; q < permutation.size(); ++q) {
+    permutedXs[permutation[q]] = std::move(xs[q]);
+    permutedZs[permutation[q]] = std::move(zs[q]);
+  }
+  std::ranges::move(permutedXs, xs.begin());
+  std::ranges::move(permutedZs, zs.begin());
+}
+
+bool CliffordEquivalenceChecker::Tableau::isChoiState(
+    const std::vector<std::size_t>& references) const {
+  /*
+   * The stabilizer group of the state is generated by X_q X_r and Z_q Z_r for
+   * every qubit q with reference r, and Z_q for every other qubit. Since the
+   * tableau has as many independent generators, the states are equal iff each
+   * generator of the tableau is an element of this group. These are exactly
+   * the Pauli strings that act alike on each qubit and its reference, and
+   * trivially or as Z on all other qubits. Their sign is determined by the
+   * number of pairs acted on by Y x Y = -(X x X)(Z x Z).
+   */
+  Column expected(signs.size(), 0U);
+  for (std::size_t q = 0U; q < references.size(); ++q) {
+    const auto r = references[q];
+    if (r >= getNqubits()) {
+      const auto nonzero = [](const auto word) { return word != 0U; };
+      if (std::ranges::any_of(xs[q], nonzero)) {
+        return false;
+      }
+      continue;
+    }
+    if (xs[q] != xs[r] || zs[q] != zs[r]) {
+      return false;
+    }
+    for (std::size_t k = 0U; k < signs.size(); ++k) {
+      expected[k] ^= xs[q][k] & zs[q][k];
+    }
+  }
+  return signs == expected;
+}
+
+bool CliffordEquivalenceChecker::decompose(const qc::Operation& op,
+                                           std::vector<Step>& steps) {
+  if (const auto* compound = dynamic_cast<const qc::CompoundOperation*>(&op)) {
+    for (const auto& sub : *compound) {
+      if (!decompose(*sub, steps)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (!op.isStandardOperation()) {
+    return false;
+  }
+  const auto type = op.getType();
+  // global phases cannot be told apart anyway
+  if (type == qc::I || type == qc::Barrier || type == qc::GPhase) {
+    return true;
+  }
+
+  const auto add = [&steps](const Gate gate, const qc::Qubit q0,
+                            const qc::Qubit q1 = 0U) {
+    steps.emplace_back(Step{gate, q0, q1});
+  };
+  const auto& targets = op.getTargets();
+  const auto& controls = op.getControls();
+
+  if (!controls.empty()) {
+    if (controls.size() != 1U || targets.size() != 1U) {
+      return false;
+    }
+    const auto& control = *controls.begin();
+    const auto c = control.qubit;
+    const auto t = targets.front();
+    const auto negative = control.type == qc::Control::Type::Neg;
+    // controlled Paulis are CX up to a change of the basis of the target
+    std::optional<std::pair<Gate, Gate>> basisChange{};
+    if (type == qc::Z) {
+      basisChange = {Gate::H, Gate::H};
+    } else if (type == qc::Y) {
+      basisChange = {Gate::Sdg, Gate::S};
+    } else if (type != qc::X) {
+      return false;
+    }
+    if (negative) {
+      add(Gate::X, c);
+    }
+    if (basisChange) {
+      add(basisChange->first, t);
+    }
+    add(Gate::CX, c, t);
+    if (basisChange) {
+      add(basisChange->second, t);
+    }
+    if (negative) {
+      add(Gate::X, c);
+    }
+    return true;
+  }
+
+  const auto& parameters = op.getParameter();
+  const auto turns = [&parameters]() -> std::optional<std::size_t> {
+    if (parameters.empty()) {
+      return std::nullopt;
+    }
+    return quarterTurns(parameters.front());
+  };
+  const auto repeat = [](const std::size_t k, const auto& fun) {
+    for (std::size_t i = 0U; i < k; ++i) {
+      fun();
+    }
+  };
+  const auto q = targets.front();
+  switch (type) {
+  case qc::H:
+    add(Gate::H, q);
+    return true;
+  case qc::X:
+    add(Gate::X, q);
+    return true;
+  case qc::Y:
+    add(Gate::Y, q);
+    return true;
+  case qc::Z:
+    add(Gate::Z, q);
+    return true;
+  case qc::S:
+    add(Gate::S, q);
+    return true;
+  case qc::Sdg:
+    add(Gate::Sdg, q);
+    return true;
+  case qc::SX:
+    add(Gate::H, q);
+    add(Gate::S, q);
+    add(Gate::H, q);
+    return true;
+  case qc::SXdg:
+    add(Gate::H, q);
+    add(Gate::Sdg, q);
+    add(Gate::H, q);
+    return true;
+  case qc::P:
+  case qc::RZ: {
+    const auto k = turns();
+    if (!k) {
+      return false;
+    }
+    repeat(*k, [&] { add(Gate::S, q); });
+    return true;
+  }
+  case qc::RX: {
+    const auto k = turns();
+    if (!k) {
+      return false;
+    }
+    add(Gate::H, q);
+    repeat(*k, [&] { add(Gate::S, q); });
+    add(Gate::H, q);
+    return true;
+  }
+  case qc::RY: {
+    // RY(pi/2) = H Z
+    const auto k = turns();
+    if (!k) {
+      return false;
+    }
+    repeat(*k, [&] {
+      add(Gate::Z, q);
+      add(Gate::H, q);
+    });
+    return true;
+  }
+  case qc::SWAP:
+    add(Gate::SWAP, targets[0], targets[1]);
+    return true;
+  case qc::iSWAP:
+    // iSWAP = SWAP CZ (S x S)
+    add(Gate::S, targets[0]);
+    add(Gate::S, targets[1]);
+    add(Gate::H, targets[1]);
+    add(Gate::CX, targets[0], targets[1]);
+    add(Gate::H, targets[1]);
+    add(Gate::SWAP, targets[0], targets[1]);
+    return true;
+  case qc::iSWAPdg:
+    add(Gate::SWAP, targets[0], targets[1]);
+    add(Gate::H, targets[1]);
+    add(Gate::CX, targets[0], targets[1]);
+    add(Gate::H, targets[1]);
+    add(Gate::Sdg, targets[0]);
+    add(Gate::Sdg, targets[1]);
+    return true;
+  case qc::RZZ:
+  case qc::RXX: {
+    // RZZ(theta) = CX (I x RZ(theta)) CX, RXX is RZZ in the X basis
+    const auto k = turns();
+    if (!k) {
+      return false;
+    }
+    if (type == qc::RXX) {
+      add(Gate::H, targets[0]);
+      add(Gate::H, targets[1]);
+    }
+    add(Gate::CX, targets[0], targets[1]);
+    repeat(*k, [&] { add(Gate::S, targets[1]); });
+    add(Gate::CX, targets[0], targets[1]);
+    if (type == qc::RXX) {
+      add(Gate::H, targets[0]);
+      add(Gate::H, targets[1]);
+    }
+    return true;
+  }
+  default:
+    return false;
+  }
+}
+
+bool CliffordEquivalenceChecker::canHandle(const qc::QuantumComputation& qc1,
+                                           const qc::QuantumComputation& qc2) {
+  const auto n = qc1.getNqubits();
+  if (n == 0U || qc2.getNqubits() != n || !qc1.isVariableFree() ||
+      !qc2.isVariableFree()) {
+    return false;
+  }
+  // the ancillary qubits are fixed to |0> in the input of both circuits
+  for (qc::Qubit q = 0U; q < n; ++q) {
+    if (qc1.logicalQubitIsAncillary(q) != qc2.logicalQubitIsAncillary(q)) {
+      return false;
+    }
+  }
+  if (!layouts(qc1) || !layouts(qc2)) {
+    return false;
+  }
+  std::vector<Step> steps{};
+  for (const auto* qc : {&qc1, &qc2}) {
+    for (const auto& op : *qc) {
+      steps.clear();
+      if (!decompose(*op, steps)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CliffordEquivalenceChecker::apply(const qc::QuantumComputation& qc,
+                                       Tableau& tableau, const bool inverse,
+                                       std::atomic<std::size_t>& gates) {
+  std::vector<Step> steps{};
+  const auto nops = qc.size();
+  for (std::size_t i = 0U; i < nops; ++i) {
+    if (isDone()) {
+      return false;
+    }
+    steps.clear();
+    decompose(*qc.at(inverse ? nops - 1U - i : i), steps);
+    if (inverse) {
+      std::ranges::reverse(steps);
+    }
+    for (const auto& [gate, q0, q1] : steps) {
+      switch (gate) {
+      case Gate::H:
+        tableau.h(q0);
+        break;
+      case Gate::S:
+      case Gate::Sdg:
+        // S and Sdg are each other's inverse
+        if ((gate == Gate::S) != inverse) {
+          tableau.s(q0);
+        } else {
+          tableau.sdg(q0);
+        }
+        break;
+      case Gate::X:
+        tableau.x(q0);
+        break;
+      case Gate::Y:
+        tableau.y(q0);
+        break;
+      case Gate::Z:
+        tableau.z(q0);
+        break;
+      case Gate::CX:
+        tableau.cx(q0, q1);
+        break;
+      case Gate::SWAP:
+        tableau.swap(q0, q1);
+        break;
+      }
+    }
+    appliedGates += steps.size();
+    gates.store(i + 1U, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+EquivalenceCriterion CliffordEquivalenceChecker::run() {
+  const auto start = std::chrono::steady_clock::now();
+  equivalence = EquivalenceCriterion::NoInformation;
+  if (!canHandle(*qc1, *qc2)) {
+    return equivalence;
+  }
+  const auto layouts1 = *layouts(*qc1);
+  const auto layouts2 = *layouts(*qc2);
+
+  // every data qubit is paired with a reference qubit
+  const auto n = qc1->getNqubits();
+  std::size_t data = 0U;
+  for (qc::Qubit q = 0U; q < n; ++q) {
+    data += qc1->logicalQubitIsAncillary(q) ? 0U : 1U;
+  }
+  const auto ntotal = n + data;
+  std::vector<std::size_t> references(n, ntotal);
+  auto next = n;
+  for (qc::Qubit q = 0U; q < n; ++q) {
+    if (!qc1->logicalQubitIsAncillary(q)) {
+      references[q] = next++;
+    }
+  }
+  tableauQubits = ntotal;
+
+  Tableau tableau(ntotal);
+  for (std::size_t q = 0U; q < n; ++q) {
+    if (references[q] < ntotal) {
+      tableau.h(q);
+      tableau.cx(q, references[q]);
+    }
+  }
+
+  // the tableau is indexed by logical qubits in between the circuits
+  tableau.permute(inverse(layouts1.initial));
+  bool finished = apply(*qc1, tableau, false, progress.gates1);
+  if (finished) {
+    tableau.permute(layouts1.output);
+    tableau.permute(inverse(layouts2.output));
+    finished = apply(*qc2, tableau, true, progress.gates2);
+  }
+  if (finished) {
+    tableau.permute(layouts2.initial);
+    equivalence = tableau.isChoiState(references)
+                      ? EquivalenceCriterion::EquivalentUpToGlobalPhase
+                      : EquivalenceCriterion::NotEquivalent;
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  runtime += std::chrono::duration<double>(end - start).count();
+  return equivalence;
+}
+
+void CliffordEquivalenceChecker::json(
+    nlohmann::basic_json<>& j) const noexcept {
+  EquivalenceChecker::json(j);
+  j["checker"] = "clifford";
+  j["tableau_qubits"] = tableauQubits;
+  j["gates"] = appliedGates;
+}
+} // namespace ec
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/Checkpoint.hpp"
+
+#include "PreprocessingCache.hpp"
+#include "dd/Export.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ec {
+
+namespace {
+constexpr std::string_view MAGIC = "QCEC-CHECKPOINT";
+
+nlohmann::json layoutJson(const qc::Permutation& permutation) {
+  auto j = nlohmann::json::array();
+  for (const auto& [physical, logical] : permutation) {
+    j.push_back({physical, logical});
+  }
+  return j;
+}
+
+qc::Permutation layoutFromJson(const nlohmann::json& j) {
+  qc::Permutation permutation{};
+  for (const auto& entry : j) {
+    permutation[entry.at(0).get<qc::Qubit>()] = entry.at(1).get<qc::Qubit>();
+  }
+  return permutation;
+}
+
+std::vector<bool> ancillaryQubits(const qc::QuantumComputation& qc) {
+  std::vector<bool> ancillary(qc.getNqubits());
+  for (qc::Qubit q = 0U; q < qc.getNqubits(); ++q) {
+    ancillary[q] = qc.logicalQubitIsAncillary(q);
+  }
+  return ancillary;
+}
+
+std::vector<bool> garbageQubits(const qc::QuantumComputation& qc) {
+  std::vector<bool> garbage(qc.getNqubits());
+  for (qc::Qubit q = 0U; q < qc.getNqubits(); ++q) {
+    garbage[q] = qc.logicalQubitIsGarbage(q);
+  }
+  return garbage;
+}
+} // namespace
+
+Checkpoint::Checkpoint(std::string checkerName, std::string schemeName,
+                       const qc::QuantumComputation& qc1,
+                       const qc::QuantumComputation& qc2)
+    : checker(std::move(checkerName)), scheme(std::move(schemeName)),
+      hash1(PreprocessingCache::hash(qc1)),
+      hash2(PreprocessingCache::hash(qc2)),
+      nqubits(std::max(qc1.getNqubits(), qc2.getNqubits())),
+      ancillary{ancillaryQubits(qc1), ancillaryQubits(qc2)},
+      garbage{garbageQubits(qc1), garbageQubits(qc2)},
+      permutations{qc1.initialLayout, qc2.initialLayout} {}
+
+bool Checkpoint::save(const std::string& filename,
+                      const dd::MatrixDD& dd) const {
+  nlohmann::json j{};
+  j["version"] = FORMAT_VERSION;
+  j["checker"] = checker;
+  j["scheme"] = scheme;
+  // hashes are stored as strings since JSON numbers may lose precision
+  j["hash1"] = std::to_string(hash1);
+  j["hash2"] = std::to_string(hash2);
+  j["nqubits"] = nqubits;
+  j["ancillary"] = ancillary;
+  j["garbage"] = garbage;
+  j["positions"] = positions;
+  j["permutations"] = {layoutJson(permutations[0]),
+                       layoutJson(permutations[1])};
+
+  // concurrent writers (e.g., checkers of a portfolio) use separate files
+  const std::filesystem::path path(filename);
+  auto tmp = path;
+  const auto thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  tmp += ".tmp" + std::to_string(thread);
+  {
+    std::ofstream ofs(tmp, std::ios::binary);
+    ofs << MAGIC << '\n' << j.dump() << '\n';
+    dd::serialize(dd, ofs, true);
+    if (!ofs) {
+      return false;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp, path, ec);
+  if (ec) {
+    std::filesystem::remove(tmp, ec);
+    return false;
+  }
+  return true;
+}
+
+std::optional<std::pair<Checkpoint, dd::MatrixDD>>
+Checkpoint::load(const std::string& filename, dd::Package& package) const {
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs) {
+    return std::nullopt;
+  }
+  try {
+    std::string line{};
+    if (!std::getline(ifs, line) || line != MAGIC ||
+        !std::getline(ifs, line)) {
+      return std::nullopt;
+    }
+    const auto j = nlohmann::json::parse(line);
+    if (j.at("version").get<std::uint64_t>() != FORMAT_VERSION) {
+      return std::nullopt;
+    }
+    Checkpoint stored{};
+    stored.checker = j.at("checker").get<std::string>();
+    stored.scheme = j.at("scheme").get<std::string>();
+    stored.hash1 = std::stoull(j.at("hash1").get<std::string>());
+    stored.hash2 = std::stoull(j.at("hash2").get<std::string>());
+    stored.nqubits = j.at("nqubits").get<std::size_t>();
+    stored.ancillary =
+        j.at("ancillary").get<std::array<std::vector<bool>, 2>>();
+    stored.garbage = j.at("garbage").get<std::array<std::vector<bool>, 2>>();
+    // the DD has to fit into the package it is reconstructed in
+    if (!matches(stored) || stored.nqubits > package.qubits()) {
+      return std::nullopt;
+    }
+    stored.positions = j.at("positions").get<std::array<std::size_t, 2>>();
+    const auto& permutations = j.at("permutations");
+    stored.permutations = {layoutFromJson(permutations.at(0)),
+                           layoutFromJson(permutations.at(1))};
+
+    auto dd = package.deserialize<dd::mNode>(ifs, true);
+    // a DD acting on more qubits than the check cannot be resumed from
+    if (!dd.isTerminal() && dd.p->v >= stored.nqubits) {
+      return std::nullopt;
+    }
+    package.incRef(dd);
+    return std::pair{std::move(stored), dd};
+  } catch (const std::exception& /*e*/) {
+    // corrupt or incompatible checkpoints are ignored
+    return std::nullopt;
+  }
+}
+} // namespace ec
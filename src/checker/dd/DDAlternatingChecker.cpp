@@ -13,15 +13,18 @@
 #include "EquivalenceCriterion.hpp"
 #include "checker/dd/DDEquivalenceChecker.hpp"
 #include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/applicationscheme/AdaptiveApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/LookaheadApplicationScheme.hpp"
 #include "dd/Package.hpp"
 #include "ir/Definitions.hpp"
 
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <nlohmann/json.hpp>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -56,6 +59,51 @@ void DDAlternatingChecker::initialize() {
   // [1 0] (= |0><0|) for an ancillary only acted on in one circuit
   // [0 0]
   functionality = dd->reduceAncillae(functionality, ancillary);
+
+  if (checkpoint) {
+    resumeFromCheckpoint();
+    lastCheckpoint = std::chrono::steady_clock::now();
+  }
+}
+
+void DDAlternatingChecker::resumeFromCheckpoint() {
+  const auto& file = configuration.execution.checkpointFile;
+  auto loaded = checkpoint->load(file, *dd);
+  if (!loaded) {
+    return;
+  }
+  auto& [stored, state] = *loaded;
+  if (stored.positions[0] > qc1->getNops() ||
+      stored.positions[1] > qc2->getNops()) {
+    dd->decRef(state);
+    return;
+  }
+  dd->decRef(functionality);
+  functionality = state;
+  taskManager1.seek(stored.positions[0], stored.permutations[0]);
+  taskManager2.seek(stored.positions[1], stored.permutations[1]);
+  resumed = true;
+}
+
+void DDAlternatingChecker::writeCheckpoint() {
+  checkpoint->positions = {taskManager1.getPosition(),
+                           taskManager2.getPosition()};
+  checkpoint->permutations = {taskManager1.getPermutation(),
+                              taskManager2.getPermutation()};
+  if (checkpoint->save(configuration.execution.checkpointFile,
+                       functionality)) {
+    ++checkpointsWritten;
+  }
+  lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+void DDAlternatingChecker::writeCheckpointIfDue() {
+  const auto elapsed = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - lastCheckpoint)
+                           .count();
+  if (elapsed >= configuration.execution.checkpointInterval) {
+    writeCheckpoint();
+  }
 }
 
 void DDAlternatingChecker::execute() {
@@ -85,11 +133,33 @@ void DDAlternatingChecker::execute() {
       if (!isDone()) {
         taskManager2.advance(functionality, apply2);
       }
+      sampleProgress();
+      if (checkpoint) {
+        writeCheckpointIfDue();
+      }
     }
   }
+  // keep the progress in case the check has been stopped (e.g., by a timeout)
+  if (checkpoint && isDone()) {
+    writeCheckpoint();
+  }
 }
 
 void DDAlternatingChecker::finish() {
+  if (checkpoint) {
+    // apply the remaining gates one by one, such that checkpoints continue to
+    // be written
+    for (auto* const task : {&taskManager1, &taskManager2}) {
+      while (!task->finished() && !isDone()) {
+        task->advance(functionality);
+        writeCheckpointIfDue();
+      }
+    }
+    if (isDone()) {
+      writeCheckpoint();
+    }
+    return;
+  }
   taskManager1.finish(functionality);
   if (!isDone()) {
     taskManager2.finish(functionality);
@@ -175,12 +245,23 @@ DDAlternatingChecker::DDAlternatingChecker(const qc::QuantumComputation& circ1,
                                            const qc::QuantumComputation& circ2,
                                            Configuration config)
     : DDEquivalenceChecker(circ1, circ2, std::move(config),
-                           AlternatingDDPackageConfig{}) {
+                           &makeAlternatingDDPackageConfig) {
   // gates from the second circuit shall be applied "from the right"
   taskManager2.flipDirection();
 
   initializeApplicationScheme(configuration.application.alternatingScheme);
 
+  // the lookahead scheme caches gate DDs and the adaptive scheme tracks the
+  // history of the DD size, neither of which are part of checkpoints
+  const auto scheme = configuration.application.alternatingScheme;
+  if (!configuration.execution.checkpointFile.empty() &&
+      scheme != ApplicationSchemeType::Lookahead &&
+      scheme != ApplicationSchemeType::Adaptive) {
+    checkpoint.emplace(std::string(getName()),
+                       toString(configuration.application.alternatingScheme),
+                       *qc1, *qc2);
+  }
+
   // special treatment for the lookahead application scheme
   if (auto* lookahead =
           dynamic_cast<LookaheadApplicationScheme*>(applicationScheme.get())) {
@@ -188,12 +269,35 @@ DDAlternatingChecker::DDAlternatingChecker(const qc::QuantumComputation& circ1,
     // lookahead scheme
     lookahead->setInternalState(functionality);
     lookahead->setPackage(dd.get());
+    lookahead->setGarbageCollector(&garbageCollector);
+    lookahead->setCostModel(
+        configuration.application.lookaheadEstimateThreshold,
+        configuration.application.lookaheadMultiplicationBudget);
+  }
+  if (auto* adaptive =
+          dynamic_cast<AdaptiveApplicationScheme*>(applicationScheme.get())) {
+    adaptive->setInternalState(functionality);
   }
 }
 
 void DDAlternatingChecker::json(nlohmann::basic_json<>& j) const noexcept {
   DDEquivalenceChecker::json(j);
   j["checker"] = "decision_diagram_alternating";
+  j["application_scheme"] =
+      toString(configuration.application.alternatingScheme);
+  if (const auto* lookahead = dynamic_cast<const LookaheadApplicationScheme*>(
+          applicationScheme.get())) {
+    lookahead->json(j["lookahead"]);
+  }
+  if (const auto* adaptive = dynamic_cast<const AdaptiveApplicationScheme*>(
+          applicationScheme.get())) {
+    adaptive->json(j["adaptive"]);
+  }
+  if (checkpoint) {
+    auto& cp = j["checkpoint"];
+    cp["resumed"] = resumed;
+    cp["written"] = checkpointsWritten;
+  }
 }
 
 } // namespace ec
@@ -15,24 +15,96 @@
 #include "checker/dd/DDPackageConfigs.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "dd/Complex.hpp"
+#include "dd/ComplexValue.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+namespace {
+// segments with fewer operations are not worth a separate package
+constexpr std::size_t MIN_SEGMENT_SIZE = 16U;
+
+using NodeCopies = std::unordered_map<const dd::mNode*, dd::MatrixDD>;
+
+// copy a DD of another package into the target package. The source package
+// must not be modified concurrently.
+dd::MatrixDD transfer(const dd::MatrixDD& e, dd::Package& target,
+                      NodeCopies& copies) {
+  if (e.w.exactlyZero()) {
+    return dd::MatrixDD::zero();
+  }
+  const auto weight = static_cast<dd::ComplexValue>(e.w);
+  if (e.isTerminal()) {
+    return dd::MatrixDD::terminal(target.cn.lookup(weight));
+  }
+  auto it = copies.find(e.p);
+  if (it == copies.end()) {
+    decltype(e.p->e) edges{};
+    for (std::size_t i = 0U; i < edges.size(); ++i) {
+      edges[i] = transfer(e.p->e[i], target, copies);
+    }
+    it = copies.emplace(e.p, target.makeDDNode(e.p->v, edges)).first;
+  }
+  // the copy is normalized, so its weight has to be combined with the
+  // weight of the original edge
+  const auto& copy = it->second;
+  return {copy.p,
+          target.cn.lookup(weight * static_cast<dd::ComplexValue>(copy.w))};
+}
+
+// run the given functions in separate threads and rethrow the first exception
+template <class Task>
+void runConcurrently(const std::size_t count, const Task& task) {
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> threads{};
+  threads.reserve(count);
+  for (std::size_t i = 0U; i < count; ++i) {
+    threads.emplace_back([&task, &errors, i] {
+      try {
+        task(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+} // namespace
 
 ec::DDConstructionChecker::DDConstructionChecker(
     const qc::QuantumComputation& circ1, const qc::QuantumComputation& circ2,
     Configuration config)
     : DDEquivalenceChecker(circ1, circ2, std::move(config),
-                           ConstructionDDPackageConfig{}) {
+                           &makeConstructionDDPackageConfig) {
   if (configuration.application.constructionScheme ==
       ApplicationSchemeType::Lookahead) {
     throw std::invalid_argument("Lookahead application scheme must not be "
                                 "used with DD construction checker.");
   }
+  if (configuration.application.constructionScheme ==
+      ApplicationSchemeType::Adaptive) {
+    throw std::invalid_argument("Adaptive application scheme must not be "
+                                "used with DD construction checker.");
+  }
   initializeApplicationScheme(configuration.application.constructionScheme);
 }
 
@@ -42,6 +114,9 @@ ec::DDConstructionChecker::DDConstructionChecker(
 void ec::DDConstructionChecker::json(nlohmann::basic_json<>& j) const noexcept {
   DDEquivalenceChecker::json(j);
   j["checker"] = "decision_diagram_construction";
+  if (configuration.execution.constructionThreads > 1U) {
+    j["segments"] = {segments1, segments2};
+  }
 }
 
 void ec::DDConstructionChecker::initializeTask(
@@ -52,3 +127,92 @@ void ec::DDConstructionChecker::initializeTask(
   taskManager.incRef();
   taskManager.reduceAncillae();
 }
+
+void ec::DDConstructionChecker::execute() {
+  if (configuration.execution.constructionThreads <= 1U) {
+    DDEquivalenceChecker::execute();
+    return;
+  }
+  // both functionalities are constructed independently of each other, so the
+  // application scheme is not consulted
+  segments1 = executeSegmented(taskManager1);
+  if (!isDone()) {
+    segments2 = executeSegmented(taskManager2);
+  }
+}
+
+std::size_t
+ec::DDConstructionChecker::executeSegmented(TaskManager<dd::MatrixDD>& task) {
+  const auto nops = task.getRemaining();
+  const auto segments = std::min(configuration.execution.constructionThreads,
+                                 nops / MIN_SEGMENT_SIZE);
+  if (segments < 2U) {
+    task.finish();
+    return 0U;
+  }
+
+  // split the circuit while tracking the permutation up to each segment
+  const auto& circ = *task.getCircuit();
+  std::vector<qc::QuantumComputation> parts{};
+  parts.reserve(segments);
+  for (std::size_t s = 0U; s < segments; ++s) {
+    const auto end = ((s + 1U) * nops) / segments;
+    auto& part = parts.emplace_back(circ.getNqubits());
+    part.initialLayout = task.getPermutation();
+    while (!task.finished() && task.getPosition() < end) {
+      part.emplace_back((*task.getIterator())->clone());
+      if (!task.applySwapOperation()) {
+        task.advanceIterator();
+      }
+    }
+  }
+
+  // build the unitaries of the segments
+  std::vector<std::unique_ptr<dd::Package>> packages(segments);
+  std::vector<dd::MatrixDD> results(segments);
+  runConcurrently(segments, [&](const std::size_t s) {
+    packages[s] = std::make_unique<dd::Package>(nqubits, packageConfiguration);
+    auto tm = TaskManager<dd::MatrixDD>(parts[s], *packages[s]);
+    tm.setStopFlag(&getDoneFlag());
+    auto functionality = dd::Package::makeIdent();
+    tm.incRef(functionality);
+    tm.finish(functionality);
+    results[s] = functionality;
+  });
+
+  // multiply the unitaries in a balanced tree. Later segments are applied
+  // from the left.
+  for (std::size_t width = 1U; width < segments && !isDone(); width *= 2U) {
+    const auto pairs = (segments - width + (2U * width) - 1U) / (2U * width);
+    runConcurrently(pairs, [&](const std::size_t pair) {
+      const auto s = pair * 2U * width;
+      auto& package = *packages[s];
+      NodeCopies copies{};
+      auto later = transfer(results[s + width], package, copies);
+      package.incRef(later);
+      auto product = package.multiply(later, results[s]);
+      package.incRef(product);
+      package.decRef(later);
+      package.decRef(results[s]);
+      results[s] = product;
+      // the package of the later segment is no longer needed
+      packages[s + width].reset();
+    });
+  }
+  if (isDone()) {
+    return segments;
+  }
+
+  // apply the functionality of the whole circuit to the internal state
+  NodeCopies copies{};
+  auto functionality = transfer(results.front(), *dd, copies);
+  packages.front().reset();
+  dd->incRef(functionality);
+  auto state = task.getInternalState();
+  auto next = dd->multiply(functionality, state);
+  dd->incRef(next);
+  dd->decRef(state);
+  dd->decRef(functionality);
+  task.setInternalState(next);
+  return segments;
+}
@@ -11,20 +11,157 @@
 #include "checker/dd/DDEquivalenceChecker.hpp"
 
 #include "EquivalenceCriterion.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
 #include "checker/dd/TaskManager.hpp"
+#include "checker/dd/applicationscheme/AdaptiveApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+#include "checker/dd/applicationscheme/GateCostProfileStore.hpp"
 #include "checker/dd/applicationscheme/LookaheadApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/OneToOneApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/ProportionalApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/SequentialApplicationScheme.hpp"
+#include "dd/Complex.hpp"
+#include "dd/ComplexValue.hpp"
+#include "dd/DDDefinitions.hpp"
 #include "dd/Node.hpp"
+#include "dd/statistics/PackageStatistics.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <optional>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 namespace ec {
 
+namespace {
+using NodePair = std::pair<const dd::mNode*, const dd::mNode*>;
+
+struct NodePairHash {
+  std::size_t operator()(const NodePair& pair) const noexcept {
+    const auto h1 = std::hash<const dd::mNode*>{}(pair.first);
+    const auto h2 = std::hash<const dd::mNode*>{}(pair.second);
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6U) + (h1 >> 2U));
+  }
+};
+
+// a normalized inner product further than this from one in magnitude cannot
+// stem from (numerically perturbed) equivalent unitaries
+constexpr dd::fp NON_EQUIVALENCE_GAP = 1e-6;
+
+std::complex<dd::fp> toComplex(const dd::Complex& c) {
+  const auto value = static_cast<dd::ComplexValue>(c);
+  return {value.r, value.i};
+}
+
+// the level of the node an edge points to (-1 for the terminal)
+std::int64_t level(const dd::MatrixDD& e) {
+  return e.isTerminal() ? -1 : static_cast<std::int64_t>(e.p->v);
+}
+
+// whether the nodes both edges point to have the same structure and all edge
+// weights below them differ by at most the given tolerance
+bool approximatelyEqualNodes(const dd::MatrixDD& e, const dd::MatrixDD& f,
+                             const dd::fp tolerance,
+                             std::unordered_set<NodePair, NodePairHash>& seen) {
+  if (e.p == f.p) {
+    return true;
+  }
+  if (e.isTerminal() || f.isTerminal() || e.p->v != f.p->v) {
+    return false;
+  }
+  // the comparison stops at the first difference, so any pair that has been
+  // seen before has been found to match
+  if (!seen.emplace(e.p, f.p).second) {
+    return true;
+  }
+  for (std::size_t i = 0U; i < e.p->e.size(); ++i) {
+    const auto& x = e.p->e[i];
+    const auto& y = f.p->e[i];
+    if (std::abs(toComplex(x.w) - toComplex(y.w)) > tolerance) {
+      return false;
+    }
+    if (x.w.exactlyZero() && y.w.exactlyZero()) {
+      continue;
+    }
+    if (!approximatelyEqualNodes(x, y, tolerance, seen)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// the Frobenius inner product tr(E^+ F) divided by the dimension of the
+// matrices. Levels skipped by an edge represent identities, which do not
+// change the normalized value.
+std::complex<dd::fp> normalizedInnerProduct(
+    const dd::MatrixDD& e, const dd::MatrixDD& f,
+    std::unordered_map<NodePair, std::complex<dd::fp>, NodePairHash>& memo) {
+  if (e.w.exactlyZero() || f.w.exactlyZero()) {
+    return 0.;
+  }
+  const auto weight = std::conj(toComplex(e.w)) * toComplex(f.w);
+  if (e.isTerminal() && f.isTerminal()) {
+    return weight;
+  }
+  const auto key = NodePair{e.p, f.p};
+  if (const auto it = memo.find(key); it != memo.end()) {
+    return weight * it->second;
+  }
+  const auto top = std::max(level(e), level(f));
+  const auto block = [top](const dd::MatrixDD& edge,
+                           const std::size_t i) -> dd::MatrixDD {
+    if (level(edge) == top) {
+      return edge.p->e[i];
+    }
+    // the diagonal blocks of an identity level are the node itself
+    if (i == 0U || i == 3U) {
+      return {edge.p, dd::Complex::one()};
+    }
+    return dd::MatrixDD::zero();
+  };
+  std::complex<dd::fp> sum = 0.;
+  for (std::size_t i = 0U; i < 4U; ++i) {
+    sum += normalizedInnerProduct(block(e, i), block(f, i), memo);
+  }
+  // each block has half the dimension of the matrix
+  const auto result = sum / 2.;
+  memo.emplace(key, result);
+  return weight * result;
+}
+
+// decide whether two unitaries are close (up to a global phase) without
+// multiplying them. Returns nothing if neither test is conclusive.
+std::optional<bool> compareUnitaries(const dd::MatrixDD& e,
+                                     const dd::MatrixDD& f,
+                                     const std::size_t nqubits,
+                                     const dd::fp traceThreshold) {
+  // the deviations of the edge weights accumulate along the paths
+  const auto tolerance =
+      traceThreshold / static_cast<dd::fp>(std::max<std::size_t>(nqubits, 1U));
+  std::unordered_set<NodePair, NodePairHash> seen{};
+  if (approximatelyEqualNodes(e, f, tolerance, seen)) {
+    return true;
+  }
+  std::unordered_map<NodePair, std::complex<dd::fp>, NodePairHash> memo{};
+  const auto overlap = std::abs(normalizedInnerProduct(e, f, memo));
+  if (1. - overlap > std::max(NON_EQUIVALENCE_GAP, 10. * traceThreshold)) {
+    return false;
+  }
+  return std::nullopt;
+}
+} // namespace
+
 template <class DDType>
 EquivalenceCriterion DDEquivalenceChecker<DDType>::equals(const DDType& e,
                                                           const DDType& f) {
@@ -62,12 +199,28 @@ EquivalenceCriterion DDEquivalenceChecker<DDType>::equals(const DDType& e,
       // be decided by whether both DDs are close enough to the identity.
       isClose = eIsClose && fIsClose;
     } else {
-      // otherwise, one DD needs to be inverted before multiplying both of them
-      // together and checking whether the resulting DD is close enough to the
-      // identity.
-      auto g = dd->multiply(e, dd->conjugateTranspose(f));
-      isClose =
-          dd->isCloseToIdentity(g, configuration.functionality.traceThreshold);
+      // for unitaries, it is usually enough to compare both DDs node by node
+      // (up to a tolerance) or to compute their normalized inner product.
+      // Their product is only computed if both tests are inconclusive.
+      const bool unitary =
+          qc1->getNancillae() == 0U && qc2->getNancillae() == 0U &&
+          (!configuration.functionality.checkPartialEquivalence ||
+           (qc1->getNgarbageQubits() == 0U && qc2->getNgarbageQubits() == 0U));
+      std::optional<bool> decided{};
+      if (unitary) {
+        decided = compareUnitaries(e, f, nqubits,
+                                   configuration.functionality.traceThreshold);
+      }
+      if (decided) {
+        isClose = *decided;
+      } else {
+        // otherwise, one DD needs to be inverted before multiplying both of
+        // them together and checking whether the resulting DD is close enough
+        // to the identity.
+        auto g = dd->multiply(e, dd->conjugateTranspose(f));
+        isClose = dd->isCloseToIdentity(
+            g, configuration.functionality.traceThreshold);
+      }
     }
 
     if (isClose) {
@@ -102,22 +255,57 @@ EquivalenceCriterion DDEquivalenceChecker<DDType>::equals(const DDType& e,
   return EquivalenceCriterion::NotEquivalent;
 }
 
+template <class DDType>
+void DDEquivalenceChecker<DDType>::json(nlohmann::json& j) const noexcept {
+  EquivalenceChecker::json(j);
+  garbageCollector.json(j["garbage_collection"]);
+  toJson(packageConfiguration, j["dd_package"]);
+  garbageCollector.memoryJson(j["memory"]);
+  if (configuration.execution.instrumentation) {
+    j["phases"] = {{"initialize", phaseTimes.initialize},
+                   {"execute", phaseTimes.execute},
+                   {"finish", phaseTimes.finish},
+                   {"postprocess", phaseTimes.postprocess},
+                   {"check_equivalence", phaseTimes.checkEquivalence}};
+    auto& ddJson = j["dd"];
+    ddJson["peak_nodes"] = peakNodes;
+    ddJson["final_nodes"] = finalNodes;
+    ddJson["package"] = dd::getStatistics(*dd);
+  }
+}
+
 template <class DDType>
 EquivalenceCriterion DDEquivalenceChecker<DDType>::run() {
   const auto start = std::chrono::steady_clock::now();
 
+  // attribute the time since the previous phase to the given one
+  auto lap = start;
+  const auto measure = [this, &lap](double& phase) {
+    if (!configuration.execution.instrumentation) {
+      return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    phase += std::chrono::duration<double>(now - lap).count();
+    lap = now;
+    peakNodes = std::max(peakNodes, currentNodes());
+  };
+
   // initialize the internal representation (initial state, initial matrix,
   // etc.)
   initialize();
+  measure(phaseTimes.initialize);
 
   // execute the equivalence checking scheme
   execute();
+  measure(phaseTimes.execute);
 
   // finish off both circuits
   finish();
+  measure(phaseTimes.finish);
 
   // postprocess the result
   postprocess();
+  measure(phaseTimes.postprocess);
 
   if (isDone()) {
     return equivalence;
@@ -125,6 +313,10 @@ EquivalenceCriterion DDEquivalenceChecker<DDType>::run() {
 
   // check the equivalence
   equivalence = checkEquivalence();
+  measure(phaseTimes.checkEquivalence);
+  if (configuration.execution.instrumentation) {
+    finalNodes = currentNodes();
+  }
 
   const auto end = std::chrono::steady_clock::now();
   runtime += std::chrono::duration<double>(end - start).count();
@@ -160,6 +352,7 @@ template <class DDType> void DDEquivalenceChecker<DDType>::execute() {
       if (!isDone()) {
         taskManager2.advance(apply2);
       }
+      sampleProgress();
     }
   }
 }
@@ -230,17 +423,43 @@ void DDEquivalenceChecker<DDType>::initializeApplicationScheme(
           "Lookahead application scheme can only be used for matrices.");
     }
     break;
-  case ApplicationSchemeType::GateCost:
-    if (!configuration.application.profile.empty()) {
+  case ApplicationSchemeType::Adaptive:
+    if constexpr (std::is_same_v<DDType, dd::MatrixDD>) {
+      applicationScheme = std::make_unique<AdaptiveApplicationScheme>(
+          taskManager1, taskManager2);
+    } else {
+      throw std::invalid_argument(
+          "Adaptive application scheme can only be used for matrices.");
+    }
+    break;
+  case ApplicationSchemeType::GateCost: {
+    const auto& loaded = configuration.application.gateCostProfile;
+    if (loaded != nullptr &&
+        loaded->getSource() == configuration.application.profile) {
+      applicationScheme = std::make_unique<GateCostApplicationScheme<DDType>>(
+          taskManager1, taskManager2, loaded,
+          configuration.optimizations.fuseSingleQubitGates);
+    } else if (!configuration.application.profile.empty()) {
       applicationScheme = std::make_unique<GateCostApplicationScheme<DDType>>(
           taskManager1, taskManager2, configuration.application.profile,
           configuration.optimizations.fuseSingleQubitGates);
+    } else if (!configuration.application.profileStore.empty()) {
+      const auto store =
+          GateCostProfileStore::open(configuration.application.profileStore,
+                                     configuration.application.costFunction);
+      applicationScheme = std::make_unique<GateCostApplicationScheme<DDType>>(
+          taskManager1, taskManager2,
+          [store](const GateCostLookupTableKeyType& key) {
+            return store->cost(key);
+          },
+          configuration.optimizations.fuseSingleQubitGates);
     } else {
       applicationScheme = std::make_unique<GateCostApplicationScheme<DDType>>(
           taskManager1, taskManager2, configuration.application.costFunction,
           configuration.optimizations.fuseSingleQubitGates);
     }
     break;
+  }
   default:
     applicationScheme = std::make_unique<ProportionalApplicationScheme<DDType>>(
         taskManager1, taskManager2,
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/DDPackageConfigs.hpp"
+
+#include "Configuration.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+
+namespace ec {
+
+namespace {
+constexpr std::size_t MIN_BUCKETS = 256U;
+constexpr std::size_t MAX_BUCKETS = 1U << 20U;
+// rough number of nodes per qubit expected in the course of a check
+constexpr std::size_t BUCKETS_PER_QUBIT = 2'048U;
+// rough number of compute table entries per applied gate
+constexpr std::size_t COMPUTE_ENTRIES_PER_GATE = 16U;
+
+std::size_t toBuckets(const std::size_t n) noexcept {
+  return std::bit_ceil(std::clamp(n, MIN_BUCKETS, MAX_BUCKETS));
+}
+
+// upper bound on the number of distinct nodes of an n-qubit vector (2^n) or
+// matrix (4^n), saturated at the maximum table size
+std::size_t nodeBound(const std::size_t nqubits, const bool matrices) noexcept {
+  const auto bits = (matrices ? 2U : 1U) * nqubits;
+  if (bits >= static_cast<std::size_t>(std::countr_zero(MAX_BUCKETS))) {
+    return MAX_BUCKETS;
+  }
+  return std::size_t{1U} << bits;
+}
+
+std::size_t totalGates(const qc::QuantumComputation& circ1,
+                       const qc::QuantumComputation& circ2) noexcept {
+  return circ1.getNops() + circ2.getNops();
+}
+
+std::size_t totalQubits(const qc::QuantumComputation& circ1,
+                        const qc::QuantumComputation& circ2) noexcept {
+  return std::max(circ1.getNqubits(), circ2.getNqubits());
+}
+
+// tables that are not needed by a checker are kept at the smallest size
+constexpr std::size_t UNUSED = 1U;
+
+void makeMatrixOnly(dd::DDPackageConfig& config,
+                    const DDPackageSizes& sizes) noexcept {
+  config.utMatNumBucket = sizes.uniqueTableBuckets;
+  config.ctMatAddNumBucket = sizes.computeTableBuckets;
+  config.ctMatMatMultNumBucket = sizes.computeTableBuckets;
+
+  // no vector nodes are needed
+  config.utVecNumBucket = UNUSED;
+  config.utVecInitialAllocationSize = UNUSED;
+
+  // no vector addition, matrix-vector multiplication, kronecker products, or
+  // inner products are needed
+  config.ctVecAddNumBucket = UNUSED;
+  config.ctMatVecMultNumBucket = UNUSED;
+  config.ctVecKronNumBucket = UNUSED;
+  config.ctMatKronNumBucket = UNUSED;
+  config.ctVecInnerProdNumBucket = UNUSED;
+}
+} // namespace
+
+DDPackageSizes
+estimateDDPackageSizes(const std::size_t nqubits, const std::size_t ngates,
+                       const bool matrices,
+                       const Configuration::Execution& execution) noexcept {
+  const auto bound = nodeBound(nqubits, matrices);
+  DDPackageSizes sizes{};
+  if (execution.ddUniqueTableBuckets > 0U) {
+    sizes.uniqueTableBuckets = std::bit_ceil(execution.ddUniqueTableBuckets);
+  } else {
+    sizes.uniqueTableBuckets =
+        toBuckets(std::min(nqubits * BUCKETS_PER_QUBIT, bound));
+  }
+  if (execution.ddComputeTableBuckets > 0U) {
+    sizes.computeTableBuckets = std::bit_ceil(execution.ddComputeTableBuckets);
+  } else {
+    const auto estimate = std::max(nqubits * BUCKETS_PER_QUBIT,
+                                   ngates * COMPUTE_ENTRIES_PER_GATE);
+    sizes.computeTableBuckets = toBuckets(std::min(estimate, bound));
+  }
+  return sizes;
+}
+
+dd::DDPackageConfig
+makeSimulationDDPackageConfig(const qc::QuantumComputation& circ1,
+                              const qc::QuantumComputation& circ2,
+                              const Configuration::Execution& execution) {
+  const auto sizes = estimateDDPackageSizes(
+      totalQubits(circ1, circ2), totalGates(circ1, circ2), false, execution);
+  dd::DDPackageConfig config{};
+  config.utVecNumBucket = sizes.uniqueTableBuckets;
+  config.ctVecAddNumBucket = sizes.computeTableBuckets;
+  config.ctMatVecMultNumBucket = sizes.computeTableBuckets;
+  config.ctVecInnerProdNumBucket =
+      std::max<std::size_t>(UNUSED, sizes.computeTableBuckets / 2U);
+
+  // simulation only needs matrices for representing operations. Hence, very
+  // little is needed here.
+  config.utMatNumBucket = 128U;
+  config.utMatInitialAllocationSize = 32U;
+
+  // simulation needs no matrix addition, conjugate transposition, matrix-matrix
+  // multiplication, or kronecker products.
+  config.ctMatAddNumBucket = UNUSED;
+  config.ctMatConjTransNumBucket = UNUSED;
+  config.ctMatMatMultNumBucket = UNUSED;
+  config.ctVecKronNumBucket = UNUSED;
+  config.ctMatKronNumBucket = UNUSED;
+  return config;
+}
+
+dd::DDPackageConfig
+makeConstructionDDPackageConfig(const qc::QuantumComputation& circ1,
+                                const qc::QuantumComputation& circ2,
+                                const Configuration::Execution& execution) {
+  const auto sizes = estimateDDPackageSizes(
+      totalQubits(circ1, circ2), totalGates(circ1, circ2), true, execution);
+  dd::DDPackageConfig config{};
+  makeMatrixOnly(config, sizes);
+  // construction additionally requires the conjugate transpose
+  config.ctMatConjTransNumBucket =
+      std::max<std::size_t>(UNUSED, sizes.computeTableBuckets / 2U);
+  return config;
+}
+
+dd::DDPackageConfig
+makeAlternatingDDPackageConfig(const qc::QuantumComputation& circ1,
+                               const qc::QuantumComputation& circ2,
+                               const Configuration::Execution& execution) {
+  // in the alternating scheme, the functionality stays close to the identity
+  // for equivalent circuits, so the gate count hardly matters
+  const auto sizes = estimateDDPackageSizes(totalQubits(circ1, circ2),
+                                            std::max(circ1.getNops(),
+                                                     circ2.getNops()),
+                                            true, execution);
+  dd::DDPackageConfig config{};
+  makeMatrixOnly(config, sizes);
+  return config;
+}
+
+void toJson(const dd::DDPackageConfig& config, nlohmann::json& j) {
+  auto& ut = j["unique_table_buckets"];
+  ut["vector"] = config.utVecNumBucket;
+  ut["matrix"] = config.utMatNumBucket;
+  auto& ct = j["compute_table_buckets"];
+  ct["vector_add"] = config.ctVecAddNumBucket;
+  ct["matrix_add"] = config.ctMatAddNumBucket;
+  ct["matrix_vector_mult"] = config.ctMatVecMultNumBucket;
+  ct["matrix_matrix_mult"] = config.ctMatMatMultNumBucket;
+  ct["matrix_conjugate_transpose"] = config.ctMatConjTransNumBucket;
+  ct["vector_inner_product"] = config.ctVecInnerProdNumBucket;
+}
+} // namespace ec
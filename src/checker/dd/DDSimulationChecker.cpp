@@ -16,18 +16,24 @@
 #include "checker/dd/DDPackageConfigs.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/simulation/StateGenerator.hpp"
+#include "checker/dd/simulation/StateType.hpp"
 #include "dd/StateGeneration.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace ec {
 DDSimulationChecker::DDSimulationChecker(const qc::QuantumComputation& circ1,
                                          const qc::QuantumComputation& circ2,
                                          Configuration config)
     : DDEquivalenceChecker(circ1, circ2, std::move(config),
-                           SimulationDDPackageConfig{}) {
+                           &makeSimulationDDPackageConfig) {
   initialState = dd::makeZeroState(nqubits, *dd);
   initializeApplicationScheme(configuration.application.simulationScheme);
 }
@@ -51,16 +57,181 @@ EquivalenceCriterion DDSimulationChecker::checkEquivalence() {
 }
 
 void DDSimulationChecker::setRandomInitialState(StateGenerator& generator) {
+  setRandomInitialStates(generator, 1U);
+}
+
+void DDSimulationChecker::setRandomInitialStates(StateGenerator& generator,
+                                                 const std::size_t count) {
   const auto nancillary = nqubits - qc1->getNqubitsWithoutAncillae();
   const auto stateType = configuration.simulation.stateType;
 
-  initialState =
-      generator.generateRandomState(*dd, nqubits, nancillary, stateType);
+  numStimuli = std::max<std::size_t>(1U, count);
+  initialStates.clear();
+  firstStimulus.reset();
+  counterexampleOffset = 0U;
+  stimulusType = stateType;
+  if (numStimuli == 1U) {
+    initialState =
+        generator.generateRandomState(*dd, nqubits, nancillary, stateType);
+    return;
+  }
+  initialStates.reserve(numStimuli);
+  for (std::size_t i = 0U; i < numStimuli; ++i) {
+    initialStates.emplace_back(
+        generator.generateRandomState(*dd, nqubits, nancillary, stateType));
+  }
+}
+
+void DDSimulationChecker::setInitialStates(const StateGenerator& generator,
+                                           const std::size_t first,
+                                           const std::size_t count,
+                                           const StateType type) {
+  const auto nancillary = nqubits - qc1->getNqubitsWithoutAncillae();
+
+  const auto generate = [&](const std::size_t index) {
+    if (configuration.simulation.exhaustive) {
+      return StateGenerator::generateGrayCodeState(*dd, index, nqubits,
+                                                   nancillary);
+    }
+    return generator.generateState(*dd, index, nqubits, nancillary, type);
+  };
+
+  numStimuli = std::max<std::size_t>(1U, count);
+  initialStates.clear();
+  firstStimulus = first;
+  counterexampleOffset = 0U;
+  // exhaustive simulations enumerate the basis states
+  stimulusType = configuration.simulation.exhaustive
+                     ? StateType::ComputationalBasis
+                     : type;
+  if (numStimuli == 1U) {
+    initialState = generate(first);
+    return;
+  }
+  initialStates.reserve(numStimuli);
+  for (std::size_t i = 0U; i < numStimuli; ++i) {
+    initialStates.emplace_back(generate(first + i));
+  }
+}
+
+EquivalenceCriterion DDSimulationChecker::run() {
+  const auto start = std::chrono::steady_clock::now();
+  const auto result =
+      initialStates.empty() ? DDEquivalenceChecker::run() : runBatch();
+  if (isDone()) {
+    return result;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto latency = std::chrono::duration<double>(end - start).count();
+  if (runs == 0U) {
+    firstRunTime = latency;
+    minRunTime = latency;
+    maxRunTime = latency;
+  }
+  ++runs;
+  totalRunTime += latency;
+  minRunTime = std::min(minRunTime, latency);
+  maxRunTime = std::max(maxRunTime, latency);
+  return result;
+}
+
+EquivalenceCriterion DDSimulationChecker::runBatch() {
+  const auto start = std::chrono::steady_clock::now();
+
+  taskManager1.reset();
+  taskManager2.reset();
+
+  auto states1 = initialStates;
+  auto states2 = initialStates;
+  for (std::size_t i = 0U; i < initialStates.size(); ++i) {
+    dd->incRef(states1[i]);
+    dd->incRef(states2[i]);
+  }
+
+  // the order in which the circuits are simulated is irrelevant for vectors.
+  // Hence, the application scheme is not consulted in batched runs.
+  taskManager1.finish(states1);
+  if (!isDone()) {
+    taskManager2.finish(states2);
+  }
+  const auto simulated = std::chrono::steady_clock::now();
+
+  std::optional<std::size_t> counterexample{};
+  if (!isDone()) {
+    for (std::size_t i = 0U; i < initialStates.size(); ++i) {
+      taskManager1.changePermutation(states1[i]);
+      taskManager2.changePermutation(states2[i]);
+      if (configuration.functionality.checkPartialEquivalence) {
+        taskManager1.reduceGarbage(states1[i]);
+        taskManager2.reduceGarbage(states2[i]);
+      }
+    }
+    const auto postprocessed = std::chrono::steady_clock::now();
+
+    equivalence = EquivalenceCriterion::Equivalent;
+    for (std::size_t i = 0U; i < initialStates.size(); ++i) {
+      const auto result = equals(states1[i], states2[i]);
+      if (result == EquivalenceCriterion::NotEquivalent) {
+        counterexample = i;
+        equivalence = result;
+        break;
+      }
+      if (equivalence == EquivalenceCriterion::Equivalent) {
+        equivalence = result;
+      }
+    }
+
+    if (configuration.execution.instrumentation) {
+      // the whole batch is simulated at once, so there are no separate
+      // execute and finish phases
+      const auto checked = std::chrono::steady_clock::now();
+      phaseTimes.finish +=
+          std::chrono::duration<double>(simulated - start).count();
+      phaseTimes.postprocess +=
+          std::chrono::duration<double>(postprocessed - simulated).count();
+      phaseTimes.checkEquivalence +=
+          std::chrono::duration<double>(checked - postprocessed).count();
+    }
+  }
+
+  if (counterexample) {
+    counterexampleOffset = *counterexample;
+    initialState = initialStates[*counterexample];
+    taskManager1.setInternalState(states1[*counterexample]);
+    taskManager2.setInternalState(states2[*counterexample]);
+  }
+
+  // adjust reference counts to facilitate reuse of the simulation checker
+  for (std::size_t i = 0U; i < initialStates.size(); ++i) {
+    dd->decRef(states1[i]);
+    dd->decRef(states2[i]);
+    dd->decRef(initialStates[i]);
+  }
+  initialStates.clear();
+
+  if (isDone()) {
+    return equivalence;
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  runtime += std::chrono::duration<double>(end - start).count();
+
+  return equivalence;
 }
 
 void DDSimulationChecker::json(nlohmann::basic_json<>& j) const noexcept {
   DDEquivalenceChecker::json(j);
   j["checker"] = "decision_diagram_simulation";
+  auto& latency = j["runs"];
+  latency["count"] = runs;
+  latency["first"] = firstRunTime;
+  latency["min"] = minRunTime;
+  latency["max"] = maxRunTime;
+  latency["mean"] = runs > 0U ? totalRunTime / static_cast<double>(runs) : 0.;
+  // the amortized latency once the package is warm
+  latency["mean_after_first"] =
+      runs > 1U ? (totalRunTime - firstRunTime) / static_cast<double>(runs - 1U)
+                : 0.;
 }
 
 } // namespace ec
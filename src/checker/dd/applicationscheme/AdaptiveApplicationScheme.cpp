@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/applicationscheme/AdaptiveApplicationScheme.hpp"
+
+#include "checker/dd/TaskManager.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "dd/Node.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <utility>
+
+namespace ec {
+
+AdaptiveApplicationScheme::AdaptiveApplicationScheme(
+    TaskManager<dd::MatrixDD>& tm1, TaskManager<dd::MatrixDD>& tm2) noexcept
+    : ApplicationScheme(tm1, tm2) {}
+
+void AdaptiveApplicationScheme::setInternalState(
+    dd::MatrixDD& state) noexcept {
+  internalState = &state;
+}
+
+AdaptiveApplicationScheme::Side
+AdaptiveApplicationScheme::choose(const std::size_t size,
+                                  Reason& reason) const {
+  const auto position1 = taskManager1->getPosition();
+  const auto position2 = taskManager2->getPosition();
+  const auto total1 = position1 + taskManager1->getRemaining();
+  const auto total2 = position2 + taskManager2->getRemaining();
+  const auto lead =
+      (static_cast<double>(position1) / static_cast<double>(total1)) -
+      (static_cast<double>(position2) / static_cast<double>(total2));
+
+  if (lead > MAX_LEAD) {
+    reason = Reason::Lead;
+    return Side::Second;
+  }
+  if (lead < -MAX_LEAD) {
+    reason = Reason::Lead;
+    return Side::First;
+  }
+
+  const auto behind = lead > 0. ? Side::Second : Side::First;
+  if (lastSide == Side::None || size <= baseline) {
+    reason = Reason::Balanced;
+    return behind;
+  }
+  if (size > lastSize) {
+    // the last gates made the DD grow, so try to cancel them with the gates
+    // of the other circuit
+    reason = Reason::Grown;
+    return lastSide == Side::First ? Side::Second : Side::First;
+  }
+  reason = Reason::Stable;
+  return lastSide;
+}
+
+void AdaptiveApplicationScheme::record(const Side side, const Reason reason,
+                                       const std::size_t size) {
+  if (side == Side::First) {
+    ++steps1;
+  } else {
+    ++steps2;
+  }
+  if (reason == Reason::Lead) {
+    ++corrections;
+  }
+  if (side == lastSide) {
+    return;
+  }
+  if (lastSide != Side::None) {
+    ++switches;
+  }
+  if (decisions.size() < MAX_DECISIONS) {
+    decisions.emplace_back(Decision{taskManager1->getPosition(),
+                                    taskManager2->getPosition(), size, side,
+                                    reason});
+  }
+}
+
+std::pair<size_t, size_t> AdaptiveApplicationScheme::operator()() {
+  assert(internalState != nullptr);
+
+  const auto size = internalState->size();
+  if (lastSide == Side::None) {
+    baseline = size;
+  }
+  peak = std::max(peak, size);
+
+  auto reason = Reason::Balanced;
+  const auto side = choose(size, reason);
+  record(side, reason, size);
+  lastSide = side;
+  lastSize = size;
+
+  // gates of the larger circuit are applied in proportion to the sizes of the
+  // circuits, such that both sides make similar progress
+  const auto remaining1 = taskManager1->getRemaining();
+  const auto remaining2 = taskManager2->getRemaining();
+  assert(remaining1 > 0U && remaining2 > 0U);
+  if (side == Side::First) {
+    const auto ratio = remaining1 > remaining2
+                           ? (remaining1 + (remaining2 / 2U)) / remaining2
+                           : 1U;
+    return {std::max<std::size_t>(ratio, 1U), 0U};
+  }
+  const auto ratio = remaining2 > remaining1
+                         ? (remaining2 + (remaining1 / 2U)) / remaining1
+                         : 1U;
+  return {0U, std::max<std::size_t>(ratio, 1U)};
+}
+
+void AdaptiveApplicationScheme::json(nlohmann::json& j) const {
+  j["baseline_nodes"] = baseline;
+  j["peak_nodes"] = peak;
+  j["steps_first"] = steps1;
+  j["steps_second"] = steps2;
+  j["switches"] = switches;
+  j["lead_corrections"] = corrections;
+  auto& decisionsJson = j["decisions"];
+  decisionsJson = nlohmann::json::array();
+  for (const auto& decision : decisions) {
+    std::string reason{};
+    switch (decision.reason) {
+    case Reason::Balanced:
+      reason = "balanced";
+      break;
+    case Reason::Grown:
+      reason = "grown";
+      break;
+    case Reason::Stable:
+      reason = "stable";
+      break;
+    default:
+      reason = "lead";
+      break;
+    }
+    decisionsJson.push_back({{"position1", decision.position1},
+                             {"position2", decision.position2},
+                             {"nodes", decision.nodes},
+                             {"side", decision.side == Side::First ? "first"
+                                                                   : "second"},
+                             {"reason", reason}});
+  }
+}
+} // namespace ec
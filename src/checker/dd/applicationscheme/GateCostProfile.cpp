@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ec {
+
+namespace {
+// layout of the binary profile format: the header is followed by the dense
+// cost table of `NUM_OP_TYPES * (maxControls + 1)` entries
+constexpr std::array<char, 8> MAGIC{'Q', 'C', 'E', 'C', 'G', 'C', 'P', '\0'};
+constexpr std::uint32_t VERSION = 1U;
+// used to detect profiles compiled on a platform with different endianness
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304U;
+
+struct Header {
+  std::array<char, 8> magic{};
+  std::uint32_t version{};
+  std::uint32_t byteOrder{};
+  std::uint64_t maxControls{};
+  std::uint64_t entries{};
+};
+static_assert(sizeof(Header) == 32U);
+
+std::size_t tableSize(const std::size_t maxControls) {
+  return GateCostProfile::NUM_OP_TYPES * (maxControls + 1U);
+}
+
+// returns whether the data describes a valid compiled profile
+bool validate(const void* data, const std::size_t size,
+              const std::string& filename) {
+  if (size < sizeof(Header)) {
+    return false;
+  }
+  Header header{};
+  std::memcpy(&header, data, sizeof(Header));
+  if (header.magic != MAGIC) {
+    return false;
+  }
+  if (header.version != VERSION || header.byteOrder != BYTE_ORDER_MARK) {
+    throw std::invalid_argument("Unsupported compiled gate cost profile: " +
+                                filename);
+  }
+  if (header.maxControls >= size ||
+      size != sizeof(Header) + (tableSize(header.maxControls) *
+                                sizeof(std::uint64_t))) {
+    throw std::invalid_argument("Corrupt compiled gate cost profile: " +
+                                filename);
+  }
+  return true;
+}
+} // namespace
+
+GateCostProfile::GateCostProfile(const GateCostLookupTable& table) {
+  initialize(table);
+}
+
+GateCostLookupTable GateCostProfile::parse(std::istream& is) {
+  GateCostLookupTable table{};
+  qc::OpType opType = qc::OpType::None;
+  std::size_t nControls = 0U;
+  std::size_t cost = 1U;
+
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    if (iss >> opType >> nControls >> cost) {
+      table.emplace(std::pair{opType, nControls}, cost);
+    }
+  }
+  return table;
+}
+
+GateCostProfile::~GateCostProfile() {
+  if (mapping == nullptr) {
+    return;
+  }
+#if defined(_WIN32)
+  UnmapViewOfFile(mapping);
+#elif defined(__unix__) || defined(__APPLE__)
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  munmap(const_cast<void*>(mapping), mappingSize);
+#endif
+}
+
+void GateCostProfile::initialize(const GateCostLookupTable& table) {
+  for (const auto& [key, cost] : table) {
+    maxControls = std::max(maxControls, key.second);
+  }
+  storage.assign(tableSize(maxControls), 1U);
+  for (const auto& [key, cost] : table) {
+    const auto& [type, nControls] = key;
+    storage[(static_cast<std::size_t>(type) * (maxControls + 1U)) +
+            nControls] = cost;
+  }
+  costs = storage.data();
+  entries = table.size();
+}
+
+std::shared_ptr<const GateCostProfile>
+GateCostProfile::load(const std::string& filename) {
+  // the constructor is private, hence `std::make_shared` cannot be used
+  auto profile = std::shared_ptr<GateCostProfile>(new GateCostProfile());
+  profile->source = filename;
+
+#if defined(_WIN32)
+  auto* const file =
+      CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) != 0 && fileSize.QuadPart > 0) {
+      auto* const map =
+          CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (map != nullptr) {
+        const void* data = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(map);
+        if (data != nullptr) {
+          profile->mapping = data;
+          profile->mappingSize = static_cast<std::size_t>(fileSize.QuadPart);
+        }
+      }
+    }
+    CloseHandle(file);
+  }
+#elif defined(__unix__) || defined(__APPLE__)
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const auto fd = open(filename.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat info{};
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+      const auto size = static_cast<std::size_t>(info.st_size);
+      void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      if (data != MAP_FAILED) {
+        profile->mapping = data;
+        profile->mappingSize = size;
+      }
+    }
+    close(fd);
+  }
+#endif
+
+  if (profile->mapping != nullptr) {
+    if (validate(profile->mapping, profile->mappingSize, filename)) {
+      Header header{};
+      std::memcpy(&header, profile->mapping, sizeof(Header));
+      profile->maxControls = static_cast<std::size_t>(header.maxControls);
+      profile->entries = static_cast<std::size_t>(header.entries);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      profile->costs = reinterpret_cast<const std::uint64_t*>(
+          static_cast<const char*>(profile->mapping) + sizeof(Header));
+      return profile;
+    }
+    // text profiles are parsed, after which the mapping is no longer needed
+    auto mapped = std::string(static_cast<const char*>(profile->mapping),
+                              profile->mappingSize);
+    std::istringstream iss(std::move(mapped));
+    auto parsed = std::make_shared<GateCostProfile>(iss);
+    parsed->source = filename;
+    return parsed;
+  }
+
+  // memory-mapping is not available (or the file is empty)
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs.good()) {
+    throw std::invalid_argument("Error opening LUT file: " + filename);
+  }
+  const auto contents = std::string(std::istreambuf_iterator<char>(ifs),
+                                    std::istreambuf_iterator<char>());
+  if (validate(contents.data(), contents.size(), filename)) {
+    Header header{};
+    std::memcpy(&header, contents.data(), sizeof(Header));
+    profile->maxControls = static_cast<std::size_t>(header.maxControls);
+    profile->entries = static_cast<std::size_t>(header.entries);
+    profile->storage.resize(tableSize(profile->maxControls));
+    std::memcpy(profile->storage.data(), contents.data() + sizeof(Header),
+                profile->storage.size() * sizeof(std::uint64_t));
+    profile->costs = profile->storage.data();
+    return profile;
+  }
+  std::istringstream iss(contents);
+  auto parsed = std::make_shared<GateCostProfile>(iss);
+  parsed->source = filename;
+  return parsed;
+}
+
+void GateCostProfile::save(const std::string& filename) const {
+  std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+  if (!ofs.good()) {
+    throw std::invalid_argument("Error opening file for writing: " + filename);
+  }
+  Header header{};
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.maxControls = maxControls;
+  header.entries = entries;
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  ofs.write(reinterpret_cast<const char*>(costs),
+            static_cast<std::streamsize>(tableSize(maxControls) *
+                                         sizeof(std::uint64_t)));
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (!ofs.good()) {
+    throw std::runtime_error("Error writing compiled gate cost profile: " +
+                             filename);
+  }
+}
+
+void GateCostProfile::compile(const std::string& input,
+                              const std::string& output) {
+  load(input)->save(output);
+}
+} // namespace ec
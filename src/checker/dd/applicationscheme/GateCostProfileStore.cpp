@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/applicationscheme/GateCostProfileStore.hpp"
+
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace ec {
+
+namespace {
+// the stores of all files opened by the process
+std::mutex registryMutex;
+std::unordered_map<std::string, std::shared_ptr<GateCostProfileStore>>
+    registry;
+} // namespace
+
+GateCostProfileStore::GateCostProfileStore(std::string filename,
+                                           CostFunction function)
+    : file(std::move(filename)), costFunction(std::move(function)) {
+  std::ifstream ifs(file);
+  if (ifs.good()) {
+    costs = GateCostProfile::parse(ifs);
+  }
+}
+
+std::shared_ptr<GateCostProfileStore>
+GateCostProfileStore::open(const std::string& filename,
+                           CostFunction costFunction) {
+  const std::lock_guard lock(registryMutex);
+  auto& store = registry[filename];
+  if (store == nullptr) {
+    // the constructor is private, hence `std::make_shared` cannot be used
+    store = std::shared_ptr<GateCostProfileStore>(
+        new GateCostProfileStore(filename, std::move(costFunction)));
+  }
+  return store;
+}
+
+void GateCostProfileStore::clear() {
+  const std::lock_guard lock(registryMutex);
+  registry.clear();
+}
+
+std::size_t GateCostProfileStore::cost(const GateCostLookupTableKeyType& key) {
+  // the first request for a cost computes it, while concurrent requests for
+  // the same cost wait for the result, such that every cost is only computed
+  // once no matter how many checkers request it
+  std::promise<std::size_t> promise{};
+  std::shared_future<std::size_t> result{};
+  {
+    const std::lock_guard lock(mutex);
+    if (const auto it = costs.find(key); it != costs.end()) {
+      return it->second;
+    }
+    if (const auto it = pending.find(key); it != pending.end()) {
+      result = it->second;
+    } else {
+      pending.emplace(key, promise.get_future().share());
+    }
+  }
+  if (result.valid()) {
+    return result.get();
+  }
+
+  std::size_t value = 0U;
+  try {
+    value = costFunction(key);
+  } catch (...) {
+    {
+      const std::lock_guard lock(mutex);
+      pending.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+
+  {
+    const std::lock_guard lock(mutex);
+    costs.emplace(key, value);
+    pending.erase(key);
+    ++computedCosts;
+
+    // appending a single line keeps the entries of concurrent processes intact
+    std::ofstream ofs(file, std::ios::app);
+    if (ofs.good()) {
+      ofs << qc::toString(key.first) << ' ' << key.second << ' ' << value
+          << '\n';
+    }
+  }
+  promise.set_value(value);
+  return value;
+}
+
+std::size_t GateCostProfileStore::size() const {
+  const std::lock_guard lock(mutex);
+  return costs.size();
+}
+
+std::size_t GateCostProfileStore::computed() const {
+  const std::lock_guard lock(mutex);
+  return computedCosts;
+}
+} // namespace ec
@@ -10,17 +10,48 @@
 
 #include "checker/dd/applicationscheme/LookaheadApplicationScheme.hpp"
 
+#include "checker/dd/GarbageCollector.hpp"
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <limits>
+#include <nlohmann/json.hpp>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace ec {
 
+namespace {
+// invoke the given function on every non-terminal node of the DD (once)
+template <class Visitor>
+void forEachNode(const dd::MatrixDD& e, Visitor&& visit) {
+  std::unordered_set<const dd::mNode*> visited{};
+  std::vector<const dd::mNode*> stack{};
+  if (!e.isTerminal()) {
+    stack.emplace_back(e.p);
+  }
+  while (!stack.empty()) {
+    const auto* node = stack.back();
+    stack.pop_back();
+    if (!visited.insert(node).second) {
+      continue;
+    }
+    visit(*node);
+    for (const auto& child : node->e) {
+      if (!child.isTerminal()) {
+        stack.emplace_back(child.p);
+      }
+    }
+  }
+}
+} // namespace
+
 LookaheadApplicationScheme::LookaheadApplicationScheme(
     TaskManager<dd::MatrixDD>& tm1, TaskManager<dd::MatrixDD>& tm2) noexcept
     : ApplicationScheme(tm1, tm2) {}
@@ -31,6 +62,68 @@ void LookaheadApplicationScheme::setInternalState(
 void LookaheadApplicationScheme::setPackage(dd::Package* dd) noexcept {
   package = dd;
 }
+void LookaheadApplicationScheme::setGarbageCollector(
+    GarbageCollector* collector) noexcept {
+  garbageCollector = collector;
+}
+void LookaheadApplicationScheme::setCostModel(
+    const double threshold, const std::size_t budget) noexcept {
+  estimateThreshold = threshold;
+  multiplicationBudget = budget;
+}
+
+void LookaheadApplicationScheme::json(nlohmann::json& j) const {
+  j["estimate_threshold"] = estimateThreshold;
+  j["multiplication_budget"] = multiplicationBudget;
+  j["evaluated_steps"] = evaluatedSteps;
+  j["estimated_steps"] = estimatedSteps;
+  j["budgeted_steps"] = budgetedSteps;
+}
+
+void LookaheadApplicationScheme::countNodes(const dd::MatrixDD& state) {
+  std::fill(nodesPerLevel.begin(), nodesPerLevel.end(), 0U);
+  stateSize = 0U;
+  forEachNode(state, [this](const dd::mNode& node) {
+    const auto level = static_cast<std::size_t>(node.v);
+    if (level >= nodesPerLevel.size()) {
+      nodesPerLevel.resize(level + 1U, 0U);
+    }
+    ++nodesPerLevel[level];
+    ++stateSize;
+  });
+}
+
+double
+LookaheadApplicationScheme::estimateSize(const dd::MatrixDD& op) const {
+  // identity levels are skipped in the DD of an operation, so its nodes
+  // reside exactly on the levels of the qubits it acts on
+  std::size_t opNodes = 0U;
+  auto lowest = std::numeric_limits<std::size_t>::max();
+  auto highest = std::size_t{0U};
+  forEachNode(op, [&](const dd::mNode& node) {
+    const auto level = static_cast<std::size_t>(node.v);
+    lowest = std::min(lowest, level);
+    highest = std::max(highest, level);
+    ++opNodes;
+  });
+  if (opNodes == 0U) {
+    return static_cast<double>(stateSize);
+  }
+
+  // the part of the state below the lowest level acted upon is only shared,
+  // whereas all nodes from that level upwards are rebuilt. Each of them might
+  // be split into as many nodes as the operation has per level.
+  std::size_t below = 0U;
+  for (std::size_t level = 0U;
+       level < std::min(lowest, nodesPerLevel.size()); ++level) {
+    below += nodesPerLevel[level];
+  }
+  const auto levels = static_cast<double>(highest - lowest + 1U);
+  const auto branching = std::max(1., static_cast<double>(opNodes) / levels);
+  return static_cast<double>(below) +
+         (static_cast<double>(stateSize - below) * branching);
+}
+
 std::pair<size_t, size_t> LookaheadApplicationScheme::operator()() {
   assert(internalState != nullptr);
   assert(package != nullptr);
@@ -49,14 +142,45 @@ std::pair<size_t, size_t> LookaheadApplicationScheme::operator()() {
     cached2 = true;
   }
 
-  // compute both possible applications and measure the resulting size
   auto saved = *internalState;
-  const auto dd1 = package->multiply(op1, saved);
-  const auto size1 = dd1.size();
-  const auto dd2 = package->multiply(saved, op2);
+
+  // decide which candidates have to be computed
+  bool compute1 = true;
+  bool compute2 = true;
+  if (estimateThreshold > 0. || multiplicationBudget > 0U) {
+    countNodes(saved);
+    const auto estimate1 = estimateSize(op1);
+    const auto estimate2 = estimateSize(op2);
+    if (estimateThreshold > 0. && estimate1 * estimateThreshold <= estimate2) {
+      compute2 = false;
+      ++estimatedSteps;
+    } else if (estimateThreshold > 0. &&
+               estimate2 * estimateThreshold <= estimate1) {
+      compute1 = false;
+      ++estimatedSteps;
+    } else if (multiplicationBudget > 0U && stateSize > multiplicationBudget) {
+      // the estimate is inconclusive, but speculating is too expensive
+      compute1 = estimate1 <= estimate2;
+      compute2 = !compute1;
+      ++budgetedSteps;
+    }
+  }
+  if (compute1 && compute2) {
+    ++evaluatedSteps;
+  }
+
+  // compute the possible applications and measure the resulting size
+  dd::MatrixDD dd1{};
+  dd::MatrixDD dd2{};
+  if (compute1) {
+    dd1 = package->multiply(op1, saved);
+  }
+  if (compute2) {
+    dd2 = package->multiply(saved, op2);
+  }
 
   // greedily chose the smaller resulting decision diagram
-  if (const auto size2 = dd2.size(); size1 <= size2) {
+  if (!compute2 || (compute1 && dd1.size() <= dd2.size())) {
     assert(!taskManager1->finished());
     *internalState = dd1;
     package->decRef(op1);
@@ -73,7 +197,11 @@ std::pair<size_t, size_t> LookaheadApplicationScheme::operator()() {
   // properly track reference counts
   package->incRef(*internalState);
   package->decRef(saved);
-  package->garbageCollect();
+  if (garbageCollector != nullptr) {
+    garbageCollector->step();
+  } else {
+    package->garbageCollect();
+  }
 
   // no operations shall be applied by the outer loop in which the application
   // scheme is invoked
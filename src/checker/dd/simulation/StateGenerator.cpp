@@ -10,14 +10,13 @@
 
 #include "checker/dd/simulation/StateGenerator.hpp"
 
-#include "algorithms/RandomCliffordCircuit.hpp"
 #include "checker/dd/simulation/StateType.hpp"
 #include "dd/DDDefinitions.hpp"
 #include "dd/Package.hpp"
 #include "dd/Simulation.hpp"
 #include "dd/StateGeneration.hpp"
 #include "ir/Definitions.hpp"
-#include "ir/QuantumComputation.hpp" // NOLINT(misc-include-cleaner)
+#include "ir/QuantumComputation.hpp"
 
 #include <algorithm>
 #include <array>
@@ -33,6 +32,78 @@
 
 namespace ec {
 
+namespace {
+// the finalizer of the SplitMix64 generator, used to derive independent
+// streams from the seed
+std::uint64_t splitmix64(std::uint64_t x) noexcept {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31U);
+}
+
+// a keyed bijection on the integers of the given bitwidth. Each step (adding a
+// constant, multiplying by an odd constant, and xor-ing with a right shift of
+// the value) is invertible modulo 2^bits, hence so is their composition.
+std::uint64_t permute(std::uint64_t x, const std::size_t bits,
+                      const std::uint64_t key) noexcept {
+  if (bits == 0U) {
+    return 0U;
+  }
+  const auto mask = (static_cast<std::uint64_t>(1U) << bits) - 1U;
+  const auto shift = (bits + 1U) / 2U;
+  auto k = key;
+  x &= mask;
+  for (std::size_t round = 0U; round < 3U; ++round) {
+    k = splitmix64(k);
+    x = (x + k) & mask;
+    x = (x * (k | 1U)) & mask;
+    x ^= x >> shift;
+  }
+  return x;
+}
+} // namespace
+
+dd::VectorDD StateGenerator::generateState(dd::Package& dd,
+                                           const std::size_t index,
+                                           const std::size_t totalQubits,
+                                           const std::size_t ancillaryQubits,
+                                           const StateType type) const {
+  const std::size_t randomQubits = totalQubits - ancillaryQubits;
+  constexpr auto bitwidth = std::numeric_limits<std::uint64_t>::digits;
+  if (type == StateType::ComputationalBasis && randomQubits <= bitwidth - 1U) {
+    const auto state = permute(index, randomQubits, key);
+    std::vector<bool> stimulusBits(totalQubits, false);
+    for (std::size_t i = 0U; i < randomQubits; ++i) {
+      stimulusBits[i] = (state & (static_cast<std::uint64_t>(1U) << i)) != 0U;
+    }
+    return dd::makeBasisState(totalQubits, stimulusBits, dd);
+  }
+
+  // split off the stream of this stimulus
+  std::mt19937_64 engine(splitmix64(key ^ splitmix64(index)));
+  switch (type) {
+  case StateType::Random1QBasis:
+    return make1QBasisState(dd, engine, totalQubits, randomQubits);
+  case StateType::Stabilizer:
+    return makeStabilizerState(dd, engine, totalQubits, randomQubits);
+  default:
+    return makeRandomBasisState(dd, engine, totalQubits, randomQubits);
+  }
+}
+
+dd::VectorDD StateGenerator::generateGrayCodeState(
+    dd::Package& dd, const std::size_t index, const std::size_t totalQubits,
+    const std::size_t ancillaryQubits) {
+  const std::size_t randomQubits = totalQubits - ancillaryQubits;
+  const auto code = index ^ (index >> 1U);
+  std::vector<bool> stimulusBits(totalQubits, false);
+  for (std::size_t i = 0U; i < randomQubits; ++i) {
+    stimulusBits[i] = (code & (static_cast<std::size_t>(1U) << i)) != 0U;
+  }
+  return dd::makeBasisState(totalQubits, stimulusBits, dd);
+}
+
 dd::VectorDD StateGenerator::generateRandomState(
     dd::Package& dd, const std::size_t totalQubits,
     const std::size_t ancillaryQubits, const StateType type) {
@@ -76,39 +147,57 @@ dd::VectorDD StateGenerator::generateRandomComputationalBasisState(
       }
     }
   } else {
-    // check how many numbers are needed for each random state
-    const auto nr = static_cast<std::size_t>(
-        std::ceil(static_cast<double>(randomQubits) / bitwidth));
-    // generate enough random numbers
-    std::vector<std::mt19937_64::result_type> randomNumbers(nr, 0U);
-    for (auto i = 0U; i < nr; ++i) {
-      randomNumbers[i] = mt();
-    }
-    // generate the corresponding bitvector
-    for (std::size_t i = 0U; i < randomQubits; ++i) {
-      if ((randomNumbers[i / bitwidth] &
-           (static_cast<std::uint_least64_t>(1U) << (i % bitwidth))) != 0U) {
-        stimulusBits[i] = true;
-      }
-    }
+    return makeRandomBasisState(dd, mt, totalQubits, randomQubits);
   }
 
   // return the appropriate decision diagram
   return dd::makeBasisState(totalQubits, stimulusBits, dd);
 }
 
+dd::VectorDD StateGenerator::makeRandomBasisState(
+    dd::Package& dd, std::mt19937_64& engine, const std::size_t totalQubits,
+    const std::size_t randomQubits) {
+  constexpr auto bitwidth = std::numeric_limits<std::uint64_t>::digits;
+  std::vector<bool> stimulusBits(totalQubits, false);
+  // check how many numbers are needed for each random state
+  const auto nr = static_cast<std::size_t>(
+      std::ceil(static_cast<double>(randomQubits) / bitwidth));
+  // generate enough random numbers
+  std::vector<std::mt19937_64::result_type> randomNumbers(nr, 0U);
+  for (auto i = 0U; i < nr; ++i) {
+    randomNumbers[i] = engine();
+  }
+  // generate the corresponding bitvector
+  for (std::size_t i = 0U; i < randomQubits; ++i) {
+    if ((randomNumbers[i / bitwidth] &
+         (static_cast<std::uint_least64_t>(1U) << (i % bitwidth))) != 0U) {
+      stimulusBits[i] = true;
+    }
+  }
+  return dd::makeBasisState(totalQubits, stimulusBits, dd);
+}
+
 dd::VectorDD
 StateGenerator::generateRandom1QBasisState(dd::Package& dd,
                                            const std::size_t totalQubits,
                                            const std::size_t ancillaryQubits) {
-  // determine how many qubits truly are random
-  const std::size_t randomQubits = totalQubits - ancillaryQubits;
+  return make1QBasisState(dd, mt, totalQubits, totalQubits - ancillaryQubits);
+}
+
+dd::VectorDD StateGenerator::make1QBasisState(dd::Package& dd,
+                                              std::mt19937_64& engine,
+                                              const std::size_t totalQubits,
+                                              const std::size_t randomQubits) {
+  // this generator produces random bases from the set { |0>, |1>, |+>, |->,
+  // |L>, |R> }
+  std::uniform_int_distribution<std::size_t> distribution(
+      0U, ONE_QUBIT_BASE_ELEMENTS - 1U);
 
   // choose a random basis state for each qubit
   auto randomBasisState =
       std::vector<dd::BasisStates>(totalQubits, dd::BasisStates::zero);
   for (std::size_t i = 0U; i < randomQubits; ++i) {
-    switch (random1QBasisDistribution(mt)) {
+    switch (distribution(engine)) {
     case static_cast<std::size_t>(dd::BasisStates::zero):
       randomBasisState[i] = dd::BasisStates::zero;
       break;
@@ -139,18 +228,68 @@ StateGenerator::generateRandom1QBasisState(dd::Package& dd,
 dd::VectorDD StateGenerator::generateRandomStabilizerState(
     dd::Package& dd, const std::size_t totalQubits,
     const std::size_t ancillaryQubits) {
-  // determine how many qubits truly are random
-  const std::size_t randomQubits = totalQubits - ancillaryQubits;
+  return makeStabilizerState(dd, mt, totalQubits,
+                             totalQubits - ancillaryQubits);
+}
 
-  // generate a random Clifford circuit with the appropriate depth
-  const auto rcs = qc::createRandomCliffordCircuit(
-      static_cast<qc::Qubit>(randomQubits),
-      static_cast<std::size_t>(std::round(std::log2(randomQubits))), mt());
+dd::VectorDD StateGenerator::makeStabilizerState(
+    dd::Package& dd, std::mt19937_64& engine, const std::size_t totalQubits,
+    const std::size_t randomQubits) {
+  // Every stabilizer state is equivalent to a graph state up to local
+  // Clifford operations, i.e., |psi> = (C_0 x ... x C_{n-1}) |G>. Each C_i is
+  // a Pauli followed by one of the six representatives of the single-qubit
+  // Clifford group modulo Paulis. Since X_i |G> = Z_{N(i)} |G>, it suffices
+  // to consider Pauli-Z corrections. Instead of simulating a random Clifford
+  // circuit, which requires a quadratic number of random two-qubit Cliffords
+  // per layer, a random graph, Z-mask, and local Cliffords are sampled. The
+  // resulting circuit consists of at most one CZ gate per pair of qubits and
+  // at most four single-qubit gates per qubit.
+  qc::QuantumComputation graph(randomQubits);
+  std::bernoulli_distribution coin(0.5);
+  for (std::size_t target = 1U; target < randomQubits; ++target) {
+    for (std::size_t control = 0U; control < target; ++control) {
+      if (coin(engine)) {
+        graph.cz(static_cast<qc::Qubit>(control),
+                 static_cast<qc::Qubit>(target));
+      }
+    }
+  }
+  std::uniform_int_distribution<std::size_t> representative(0U, 5U);
+  for (std::size_t i = 0U; i < randomQubits; ++i) {
+    const auto q = static_cast<qc::Qubit>(i);
+    if (coin(engine)) {
+      graph.z(q);
+    }
+    switch (representative(engine)) {
+    case 1U:
+      graph.h(q);
+      break;
+    case 2U:
+      graph.s(q);
+      break;
+    case 3U:
+      graph.h(q);
+      graph.s(q);
+      break;
+    case 4U:
+      graph.s(q);
+      graph.h(q);
+      break;
+    case 5U:
+      graph.h(q);
+      graph.s(q);
+      graph.h(q);
+      break;
+    default:
+      break;
+    }
+  }
 
-  // generate the associated stabilizer state by simulating the Clifford
-  // circuit
-  const auto stabilizer =
-      simulate(rcs, dd::makeZeroState(randomQubits, dd), dd);
+  // the graph state is prepared from |+...+>, which is constructed directly
+  const auto plus = dd::makeBasisState(
+      randomQubits,
+      std::vector<dd::BasisStates>(randomQubits, dd::BasisStates::plus), dd);
+  const auto stabilizer = simulate(graph, plus, dd);
 
   // add |0> edges for all the ancillary qubits
   auto initial = stabilizer;
@@ -174,8 +313,10 @@ void StateGenerator::seedGenerator(const std::size_t s) {
     std::ranges::generate(randomData, std::ref(rd));
     std::seed_seq seeds(std::begin(randomData), std::end(randomData));
     mt.seed(seeds);
+    key = splitmix64((static_cast<std::uint64_t>(rd()) << 32U) | rd());
   } else {
     mt.seed(seed);
+    key = splitmix64(seed);
   }
 }
 
@@ -20,9 +20,13 @@
 #include "zx/ZXDefinitions.hpp"
 #include "zx/ZXDiagram.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <nlohmann/json.hpp>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -32,14 +36,32 @@ ZXEquivalenceChecker::ZXEquivalenceChecker(const qc::QuantumComputation& circ1,
                                            const qc::QuantumComputation& circ2,
                                            Configuration config) noexcept
     : EquivalenceChecker(circ1, circ2, std::move(config)),
-      miter(zx::FunctionalityConstruction::buildFunctionality(qc1)),
-      tolerance(configuration.functionality.traceThreshold) {
-  zx::ZXDiagram dPrime = zx::FunctionalityConstruction::buildFunctionality(qc2);
-
+      tolerance(configuration.functionality.traceThreshold),
+      stallRounds(configuration.functionality.zxStallRounds) {
   if ((qc1->getNancillae() != 0U) || (qc2->getNancillae() != 0U)) {
     ancilla = true;
   }
 
+  // without ancillaries, the miter is built incrementally once the check runs
+  streaming = !ancilla && qc1->getNqubits() != 0U &&
+              qc1->getNqubits() == qc2->getNqubits();
+  if (streaming) {
+    miter = zx::ZXDiagram(qc1->getNqubits());
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  buildFullMiter();
+  phaseTimes.construction =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  peakVertices = miter.getNVertices();
+}
+
+void ZXEquivalenceChecker::buildFullMiter() {
+  miter = zx::FunctionalityConstruction::buildFunctionality(qc1);
+  zx::ZXDiagram dPrime = zx::FunctionalityConstruction::buildFunctionality(qc2);
+
   const auto& p1 = invertPermutations(*qc1);
   const auto& p2 = invertPermutations(*qc2);
 
@@ -73,8 +95,131 @@ ZXEquivalenceChecker::ZXEquivalenceChecker(const qc::QuantumComputation& circ1,
   miter.concat(dPrime);
 }
 
+namespace {
+// the diagram of the operations in [begin, end) of the given circuit
+zx::ZXDiagram buildChunk(const qc::QuantumComputation& qc,
+                         const std::size_t begin, const std::size_t end) {
+  qc::QuantumComputation chunk(qc.getNqubits());
+  // all chunks map the qubits to the wires of the diagram in the same way
+  chunk.initialLayout = qc.initialLayout;
+  if (begin == 0U) {
+    chunk.gphase(qc.getGlobalPhase());
+  }
+  for (auto i = begin; i < end; ++i) {
+    chunk.emplace_back(qc.at(i)->clone());
+  }
+  return zx::FunctionalityConstruction::buildFunctionality(&chunk);
+}
+} // namespace
+
+void ZXEquivalenceChecker::buildMiter() {
+  const auto nops1 = qc1->getNops();
+  const auto nops2 = qc2->getNops();
+  const auto nchunks = std::clamp<std::size_t>(
+      std::max(nops1, nops2) / MIN_CHUNK_SIZE, 1U, MAX_CHUNKS);
+  const auto chunkSize1 = (nops1 + nchunks - 1U) / nchunks;
+  const auto chunkSize2 = (nops2 + nchunks - 1U) / nchunks;
+
+  /*
+   * The miter G1^-1 G2 is grown from the middle, where the first gates of
+   * both circuits meet. Chunks of the second circuit are appended to the
+   * outputs of the miter. Chunks of the first circuit are appended to the
+   * outputs of the inverted miter, i.e., they are prepended in inverted form
+   * to the inputs of the miter. In between, cheap local rules cancel what has
+   * been matched up so far.
+   */
+  std::size_t pos1 = 0U;
+  std::size_t pos2 = 0U;
+  while ((pos1 < nops1 || pos2 < nops2) && !aborted()) {
+    if (pos2 < nops2) {
+      const auto end = std::min(pos2 + chunkSize2, nops2);
+      miter.concat(buildChunk(*qc2, pos2, end));
+      pos2 = end;
+    }
+    if (pos1 < nops1) {
+      const auto end = std::min(pos1 + chunkSize1, nops1);
+      miter.invert();
+      miter.concat(buildChunk(*qc1, pos1, end));
+      miter.invert();
+      pos1 = end;
+    }
+    peakVertices = std::max(peakVertices, miter.getNVertices());
+    spiderSimp();
+    idSimp();
+    recordSample();
+  }
+}
+
+void ZXEquivalenceChecker::recordSample() {
+  progress.rewrites.store(rewrites, std::memory_order_relaxed);
+  reportNodes(miter.getNVertices());
+  if (samples.size() >= MAX_SAMPLES) {
+    return;
+  }
+  const auto now = std::chrono::steady_clock::now();
+  samples.emplace_back(Sample{
+      .time = std::chrono::duration<double>(now - startTime).count(),
+      .vertices = miter.getNVertices(),
+      .edges = miter.getNEdges()});
+}
+
+void ZXEquivalenceChecker::endRound() {
+  recordSample();
+  if (stallRounds == 0U) {
+    return;
+  }
+  const auto size = miter.getNVertices();
+  if (size < smallestSize) {
+    smallestSize = size;
+    roundsWithoutProgress = 0U;
+    return;
+  }
+  if (++roundsWithoutProgress >= stallRounds) {
+    stalled = true;
+  }
+}
+
+void ZXEquivalenceChecker::json(nlohmann::basic_json<>& j) const noexcept {
+  EquivalenceChecker::json(j);
+  j["checker"] = "zx";
+  j["rewrites"] = rewrites;
+  j["threads"] = getNumThreads();
+  j["peak_vertices"] = peakVertices;
+  j["vertices"] = miter.getNVertices();
+  j["edges"] = miter.getNEdges();
+  j["stalled"] = stalled;
+
+  auto& rules = j["rules"];
+  rules = nlohmann::basic_json<>::object();
+  for (const auto& [name, statistics] : ruleStatistics) {
+    rules[std::string(name)] = {{"applications", statistics.applications},
+                                {"time", statistics.time}};
+  }
+
+  j["phases"] = {{"construction", phaseTimes.construction},
+                 {"reduction", phaseTimes.reduction},
+                 {"approximation", phaseTimes.approximation},
+                 {"verification", phaseTimes.verification}};
+
+  auto& trace = j["trace"];
+  trace = nlohmann::basic_json<>::array();
+  for (const auto& sample : samples) {
+    trace.push_back({{"time", sample.time},
+                     {"vertices", sample.vertices},
+                     {"edges", sample.edges}});
+  }
+}
+
 EquivalenceCriterion ZXEquivalenceChecker::run() {
   const auto start = std::chrono::steady_clock::now();
+  startTime = start;
+  if (streaming) {
+    buildMiter();
+    streaming = false;
+    phaseTimes.construction =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count();
+  }
   if (miter.getNQubits() == 0) {
     if (miter.globalPhaseIsZero()) {
       equivalence = EquivalenceCriterion::Equivalent;
@@ -84,7 +229,9 @@ EquivalenceCriterion ZXEquivalenceChecker::run() {
     return equivalence;
   }
   fullReduceApproximate();
+  recordSample();
 
+  const auto verificationStart = std::chrono::steady_clock::now();
   bool equivalent = true;
 
   if (miter.getNEdges() == miter.getNQubits()) {
@@ -121,12 +268,14 @@ EquivalenceCriterion ZXEquivalenceChecker::run() {
   }
 
   const auto end = std::chrono::steady_clock::now();
+  phaseTimes.verification =
+      std::chrono::duration<double>(end - verificationStart).count();
   runtime += std::chrono::duration<double>(end - start).count();
 
   // non-equivalence might be due to incorrect assumption about the state of
-  // ancillaries or the check was aborted prematurely, so no information can be
-  // given
-  if ((!equivalent && ancilla) || isDone()) {
+  // ancillaries or the check was aborted prematurely (or gave up since the
+  // miter stopped shrinking), so no information can be given
+  if ((!equivalent && ancilla) || aborted()) {
     equivalence = EquivalenceCriterion::NoInformation;
   } else {
     if (equivalent) {
@@ -204,23 +353,30 @@ qc::Permutation invertPermutations(const qc::QuantumComputation& qc) {
 }
 
 bool ZXEquivalenceChecker::fullReduceApproximate() {
+  const auto start = std::chrono::steady_clock::now();
   auto simplified = fullReduce();
-  while (!isDone()) {
+  const auto reduced = std::chrono::steady_clock::now();
+  phaseTimes.reduction = std::chrono::duration<double>(reduced - start).count();
+  while (!aborted()) {
     miter.approximateCliffords(tolerance);
     if (!fullReduce()) {
       break;
     }
     simplified = true;
   }
+  phaseTimes.approximation =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - reduced)
+          .count();
   return simplified;
 }
 
 bool ZXEquivalenceChecker::fullReduce() {
-  if (!isDone()) {
+  if (!aborted()) {
     miter.toGraphlike();
   }
   auto simplified = interiorCliffordSimp();
-  while (!isDone()) {
+  endRound();
+  while (!aborted()) {
     auto moreSimplified = cliffordSimp();
     moreSimplified |= gadgetSimp();
     moreSimplified |= interiorCliffordSimp();
@@ -229,36 +385,45 @@ bool ZXEquivalenceChecker::fullReduce() {
       break;
     }
     simplified = true;
+    endRound();
   }
-  if (!isDone()) {
+  if (!aborted()) {
     miter.removeDisconnectedSpiders();
   }
   return simplified;
 }
 
 bool ZXEquivalenceChecker::gadgetSimp() {
+  const auto start = std::chrono::steady_clock::now();
+  const auto rewritesBefore = rewrites;
   auto simplified = false;
-  while (!isDone()) {
-    auto moreSimplified = false;
-    for (const auto& [v, _] : miter.getVertices()) {
-      if (miter.isDeleted(v)) {
-        continue;
-      }
-      if (checkAndFuseGadget(miter, v)) {
-        moreSimplified = true;
-      }
+  Worklist worklist{};
+  initWorklist(worklist);
+  while (!worklist.empty() && !aborted()) {
+    const auto v = worklist.pop();
+    if (miter.isDeleted(v)) {
+      continue;
     }
-    if (!moreSimplified) {
-      break;
+    // fusing a gadget changes the support of the gadget, which is two steps
+    // away from its phase vertex
+    const auto affected = vicinity({v}, 2U);
+    if (checkAndFuseGadget(miter, v)) {
+      ++rewrites;
+      markDirty(worklist, affected);
+      simplified = true;
     }
-    simplified = true;
   }
+  auto& statistics = ruleStatistics["gadget_fusion"];
+  statistics.applications += rewrites - rewritesBefore;
+  statistics.time +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
   return simplified;
 }
 
 bool ZXEquivalenceChecker::interiorCliffordSimp() {
   auto simplified = spiderSimp();
-  while (!isDone()) {
+  while (!aborted()) {
     auto moreSimplified = idSimp();
     moreSimplified |= spiderSimp();
     moreSimplified |= pivotPauliSimp();
@@ -273,7 +438,7 @@ bool ZXEquivalenceChecker::interiorCliffordSimp() {
 
 bool ZXEquivalenceChecker::cliffordSimp() {
   auto simplified = false;
-  while (!isDone()) {
+  while (!aborted()) {
     auto moreSimplified = interiorCliffordSimp();
     moreSimplified |= pivotSimp();
     if (!moreSimplified) {
@@ -0,0 +1,59 @@
+# Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+# Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+# All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Licensed under the MIT License
+
+"""Test the batched verification of many circuit pairs."""
+
+from __future__ import annotations
+
+from mqt.core.ir import QuantumComputation
+
+from mqt.qcec.pyqcec import BatchEquivalenceCheckingManager, Configuration, EquivalenceCheckingManager
+
+
+def _bell() -> QuantumComputation:
+    qc = QuantumComputation(2)
+    qc.h(0)
+    qc.cx(0, 1)
+    return qc
+
+
+def test_batch_results() -> None:
+    """Test that a batch reports the same results as individual checks."""
+    original = _bell()
+    erroneous = _bell()
+    erroneous.x(1)
+
+    config = Configuration()
+    config.execution.nthreads = 2
+    batch = BatchEquivalenceCheckingManager(config)
+    original_id = batch.add_circuit(original)
+    batch.add_pair(original_id, batch.add_circuit(_bell()))
+    batch.add_pair(original_id, batch.add_circuit(erroneous))
+    assert len(batch) == 2
+
+    reported: list[int] = []
+
+    def callback(index: int, results: EquivalenceCheckingManager.Results) -> None:
+        assert (index == 0) == results.considered_equivalent()
+        reported.append(index)
+
+    batch.run(callback)
+    assert sorted(reported) == [0, 1]
+
+    results = batch.results
+    assert len(results) == 2
+    assert results[0].considered_equivalent()
+    assert not results[1].considered_equivalent()
+
+
+def test_batch_add_pair_from_circuits() -> None:
+    """Test adding pairs directly from circuits."""
+    batch = BatchEquivalenceCheckingManager()
+    batch.add_pair(_bell(), _bell())
+    batch.run()
+    assert batch.results[0].considered_equivalent()
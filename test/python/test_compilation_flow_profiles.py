@@ -20,9 +20,18 @@ from pathlib import Path
 from typing import Any, cast
 
 import pytest
+from mqt.core.ir import QuantumComputation
+from mqt.core.ir.operations import OpType
 
+from mqt.qcec import verify
 from mqt.qcec._compat.optional import HAS_QISKIT
-from mqt.qcec.compilation_flow_profiles import AncillaMode, generate_profile, generate_profile_name
+from mqt.qcec.compilation_flow_profiles import (
+    AncillaMode,
+    create_cost_function,
+    generate_profile,
+    generate_profile_name,
+)
+from mqt.qcec.pyqcec import ApplicationScheme
 
 
 @pytest.fixture(params=[0, 1, 2, 3])
@@ -111,3 +120,31 @@ def test_compilation_flow_profile_generation_fails_without_qiskit() -> None:
     """Test that profile generation fails if Qiskit is not available."""
     with HAS_QISKIT.disable_locally(), pytest.raises(ImportError, match=r"The 'qiskit' library is required to .*"):
         generate_profile()
+
+
+def test_cost_function_with_profile_store(tmp_path: Path) -> None:
+    """Test that gate costs are computed on demand and persisted to the profile store."""
+    cost_function = create_cost_function(optimization_level=1)
+    assert cost_function((OpType.x, 0)) == 1
+    assert cost_function((OpType.t, 1)) == cost_function((OpType.p, 1))
+    assert cost_function((OpType.barrier, 0)) == 1
+
+    qc = QuantumComputation(3)
+    qc.mcx({1, 2}, 0)
+    qc.h(0)
+    store = tmp_path / "costs.profile"
+    result = verify(
+        qc,
+        qc,
+        alternating_scheme=ApplicationScheme.gate_cost,
+        profile_store=str(store),
+        cost_function=cost_function,
+        run_simulation_checker=False,
+        run_zx_checker=False,
+    )
+    assert result.considered_equivalent()
+
+    # only the gates of the checked circuits have been compiled
+    costs = {tuple(line.split()[:2]): int(line.split()[2]) for line in store.read_text(encoding="utf-8").splitlines()}
+    assert set(costs) == {("x", "2"), ("h", "0")}
+    assert costs["x", "2"] == cost_function((OpType.x, 2))
@@ -0,0 +1,48 @@
+# Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+# Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+# All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Licensed under the MIT License
+
+"""Test the incremental re-verification of edited circuits."""
+
+from __future__ import annotations
+
+import pytest
+from mqt.core.ir import QuantumComputation
+
+from mqt.qcec.pyqcec import EquivalenceCriterion, IncrementalEquivalenceCheckingManager
+
+
+def _circuit(*, edited: bool = False) -> QuantumComputation:
+    qc = QuantumComputation(2)
+    qc.h(0)
+    if edited:
+        qc.h(1)
+        qc.h(1)
+    qc.cx(0, 1)
+    return qc
+
+
+def test_incremental_update() -> None:
+    """Test that an equivalent edit is decided on the edited window alone."""
+    manager = IncrementalEquivalenceCheckingManager(_circuit(), _circuit())
+    assert manager.run().equivalence == EquivalenceCriterion.equivalent
+    assert not manager.decided_incrementally
+
+    results = manager.update(_circuit(edited=True))
+    assert results.equivalence == EquivalenceCriterion.equivalent
+    assert manager.decided_incrementally
+    assert manager.window_size == (0, 2)
+
+
+def test_incremental_update_range() -> None:
+    """Test that edits outside the given range are rejected."""
+    manager = IncrementalEquivalenceCheckingManager(_circuit(), _circuit())
+    manager.run()
+    with pytest.raises(ValueError, match="differ"):
+        manager.update(_circuit(edited=True), 0, 0)
+    results = manager.update(_circuit(edited=True), 1, 1)
+    assert results.equivalence == EquivalenceCriterion.equivalent
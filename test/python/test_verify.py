@@ -10,12 +10,14 @@
 
 from __future__ import annotations
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 from mqt.core.ir import QuantumComputation
 from qiskit import transpile
 from qiskit.circuit import AncillaRegister, QuantumCircuit
 
-from mqt.qcec import verify
+from mqt.qcec import verify, verify_async, verify_distributed
 from mqt.qcec.pyqcec import ApplicationScheme, Configuration, EquivalenceCriterion
 
 
@@ -73,6 +75,26 @@ def test_verify_config(original_circuit: QuantumCircuit, alternative_circuit: Qu
     assert result.equivalence == EquivalenceCriterion.equivalent
 
 
+def test_verify_async(original_circuit: QuantumCircuit, alternative_circuit: QuantumCircuit) -> None:
+    """Test running multiple verifications concurrently."""
+    futures = [verify_async(original_circuit, alternative_circuit, run_zx_checker=False) for _ in range(4)]
+    for future in futures:
+        assert future.result().equivalence == EquivalenceCriterion.equivalent
+
+
+def test_verify_async_executor(original_circuit: QuantumCircuit) -> None:
+    """Test running verifications on a custom executor (including non-equivalent pairs)."""
+    modified_circuit = QuantumCircuit(3)
+    modified_circuit.h(0)
+    modified_circuit.cx(0, 1)
+    modified_circuit.measure_all()
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        equivalent = verify_async(original_circuit, original_circuit, executor=executor)
+        not_equivalent = verify_async(original_circuit, modified_circuit, executor=executor)
+        assert equivalent.result().equivalence == EquivalenceCriterion.equivalent
+        assert not_equivalent.result().equivalence == EquivalenceCriterion.not_equivalent
+
+
 def test_compiled_circuit_without_measurements() -> None:
     """Regression test for https://github.com/cda-tum/qcec/issues/236.
 
@@ -180,3 +202,52 @@ cx q[7],q[8];
 
     result = verify(qc1, qc2, transform_dynamic_circuit=True)
     assert result.equivalence == EquivalenceCriterion.not_equivalent
+
+
+def test_verify_distributed(original_circuit: QuantumCircuit, alternative_circuit: QuantumCircuit) -> None:
+    """Test distributing the simulations of two equivalent circuits across the workers of an executor."""
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        result = verify_distributed(original_circuit, alternative_circuit, executor, stimuli=32, stimuli_per_task=4)
+    assert result.equivalence == EquivalenceCriterion.probably_equivalent
+    assert result.performed_simulations == 8
+    assert result.cex_stimulus is None
+
+
+def test_verify_distributed_ancillary_qubits() -> None:
+    """Test that the ancillary qubits of the circuits are preserved when they are shipped to the workers."""
+    qc1 = QuantumComputation(2)
+    qc1.cx(1, 0)
+    qc1.set_circuit_qubit_ancillary(1)
+    qc2 = QuantumComputation(2)
+    qc2.set_circuit_qubit_ancillary(1)
+    # the ancillary qubit starts in |0>, so the CNOT never fires
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        result = verify_distributed(qc1, qc2, executor, stimuli=8, stimuli_per_task=1)
+    assert result.equivalence == EquivalenceCriterion.probably_equivalent
+    # only the basis states of the data qubit are simulated
+    assert result.performed_simulations == 2
+
+
+def test_verify_distributed_counterexample(original_circuit: QuantumCircuit) -> None:
+    """Test that a counterexample found by a worker can be reproduced from its stimulus index."""
+    modified_circuit = QuantumCircuit(3)
+    modified_circuit.h(0)
+    modified_circuit.cx(0, 1)
+    modified_circuit.measure_all()
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        result = verify_distributed(original_circuit, modified_circuit, executor, stimuli=64, stimuli_per_task=4, seed=7)
+    assert result.equivalence == EquivalenceCriterion.not_equivalent
+    assert result.cex_stimulus is not None
+
+    reproduced = verify(
+        original_circuit,
+        modified_circuit,
+        run_alternating_checker=False,
+        run_construction_checker=False,
+        run_zx_checker=False,
+        seed=7,
+        first_stimulus=result.cex_stimulus,
+        max_sims=1,
+    )
+    assert reproduced.equivalence == EquivalenceCriterion.not_equivalent
+    assert reproduced.cex_stimulus == result.cex_stimulus
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "BatchEquivalenceCheckingManager.hpp"
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+class BatchTest : public ::testing::Test {
+protected:
+  ec::Configuration config{};
+
+  void SetUp() override {
+    config.execution.nthreads = 4U;
+    config.simulation.maxSims = 4U;
+  }
+};
+
+TEST_F(BatchTest, MatchesIndividualChecks) {
+  const auto original =
+      qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  const auto alternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+  const auto erroneous =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+
+  ec::BatchEquivalenceCheckingManager batch(config);
+  const auto id0 = batch.addCircuit(original);
+  const auto id1 = batch.addCircuit(alternative);
+  const auto id2 = batch.addCircuit(erroneous);
+  EXPECT_EQ(batch.numCircuits(), 3U);
+
+  // the original circuit is shared between both pairs
+  batch.addPair(id0, id1);
+  batch.addPair(id0, id2);
+  EXPECT_EQ(batch.numPairs(), 2U);
+
+  std::vector<std::size_t> reported{};
+  batch.run([&reported](const std::size_t index,
+                        const ec::BatchEquivalenceCheckingManager::Results& r) {
+    std::cout << "Pair " << index << ":\n" << r << '\n';
+    reported.emplace_back(index);
+  });
+  EXPECT_EQ(reported.size(), 2U);
+
+  const auto& results = batch.getResults();
+  ASSERT_EQ(results.size(), 2U);
+
+  ec::EquivalenceCheckingManager ecm1(original, alternative, config);
+  ecm1.run();
+  EXPECT_EQ(results[0].equivalence, ecm1.equivalence());
+
+  ec::EquivalenceCheckingManager ecm2(original, erroneous, config);
+  ecm2.run();
+  EXPECT_EQ(results[1].equivalence, ecm2.equivalence());
+  EXPECT_FALSE(results[1].consideredEquivalent());
+}
+
+TEST_F(BatchTest, SequentialFlow) {
+  using namespace qc::literals;
+  config.execution.parallel = false;
+
+  qc::QuantumComputation qc1(2U);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+  qc::QuantumComputation qc2(2U);
+  qc2.h(0);
+  qc2.cx(0_pc, 1);
+  qc2.z(0);
+
+  ec::BatchEquivalenceCheckingManager batch(config);
+  for (std::size_t i = 0U; i < 8U; ++i) {
+    batch.addPair(qc1, i % 2U == 0U ? qc1 : qc2);
+  }
+  batch.run();
+
+  const auto& results = batch.getResults();
+  ASSERT_EQ(results.size(), 8U);
+  for (std::size_t i = 0U; i < results.size(); ++i) {
+    EXPECT_EQ(results[i].consideredEquivalent(), i % 2U == 0U);
+  }
+}
+
+TEST_F(BatchTest, MorePairsThanThreads) {
+  using namespace qc::literals;
+  qc::QuantumComputation qc1(2U);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+  qc::QuantumComputation qc2(2U);
+  qc2.h(0);
+  qc2.cx(0_pc, 1);
+  qc2.x(1);
+
+  // the pairs are checked on the (externally provided) pool itself
+  ec::BatchEquivalenceCheckingManager batch(config);
+  const auto pool = std::make_shared<ec::ThreadPool>(2U);
+  batch.setThreadPool(pool);
+  const auto id1 = batch.addCircuit(qc1);
+  const auto id2 = batch.addCircuit(qc2);
+  for (std::size_t i = 0U; i < 6U; ++i) {
+    batch.addPair(id1, i % 3U == 0U ? id2 : id1);
+  }
+  batch.run();
+  EXPECT_EQ(batch.getThreadPool(), pool);
+
+  const auto& results = batch.getResults();
+  ASSERT_EQ(results.size(), 6U);
+  for (std::size_t i = 0U; i < results.size(); ++i) {
+    EXPECT_EQ(results[i].consideredEquivalent(), i % 3U != 0U);
+  }
+}
+
+TEST_F(BatchTest, EmptyBatch) {
+  ec::BatchEquivalenceCheckingManager batch(config);
+  EXPECT_NO_THROW(batch.run());
+  EXPECT_TRUE(batch.getResults().empty());
+}
+
+TEST_F(BatchTest, UnknownCircuitId) {
+  ec::BatchEquivalenceCheckingManager batch(config);
+  batch.addCircuit(qc::QuantumComputation(1U));
+  EXPECT_THROW(batch.addPair(0U, 1U), std::out_of_range);
+}
+
+TEST_F(BatchTest, ErrorsArePropagatedAfterAllPairs) {
+  qc::QuantumComputation dynamic(1U, 1U);
+  dynamic.h(0);
+  dynamic.measure(0, 0);
+  dynamic.reset(0);
+  qc::QuantumComputation qc1(1U);
+  qc1.h(0);
+
+  ec::BatchEquivalenceCheckingManager batch(config);
+  batch.addPair(dynamic, dynamic);
+  batch.addPair(qc1, qc1);
+  EXPECT_THROW(batch.run(), std::runtime_error);
+  EXPECT_EQ(batch.getResults()[1].equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+}
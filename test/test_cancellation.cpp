@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/DDAlternatingChecker.hpp"
+#include "checker/dd/DDConstructionChecker.hpp"
+#include "checker/dd/DDSimulationChecker.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/simulation/StateGenerator.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <iostream>
+
+class CancellationTest : public ::testing::Test {
+protected:
+  qc::QuantumComputation qc1{8U};
+  qc::QuantumComputation qc2{8U};
+  ec::Configuration config{};
+
+  void SetUp() override {
+    using namespace qc::literals;
+    for (std::size_t rep = 0U; rep < 10U; ++rep) {
+      for (qc::Qubit q = 0U; q < 8U; ++q) {
+        qc1.h(q);
+        qc1.t(q);
+      }
+      for (qc::Qubit q = 1U; q < 8U; ++q) {
+        qc1.cx(0_pc, q);
+      }
+    }
+    qc2 = qc1;
+    qc2.x(0);
+  }
+};
+
+TEST_F(CancellationTest, ConstructionCheckerStopsWhenSignalled) {
+  ec::DDConstructionChecker checker(qc1, qc2, config);
+  checker.signalDone();
+  EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NoInformation);
+}
+
+TEST_F(CancellationTest, AlternatingCheckerStopsWhenSignalled) {
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Sequential;
+  ec::DDAlternatingChecker checker(qc1, qc2, config);
+  checker.signalDone();
+  EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NoInformation);
+}
+
+TEST_F(CancellationTest, SimulationCheckerStopsWhenSignalled) {
+  ec::DDSimulationChecker checker(qc1, qc2, config);
+  ec::StateGenerator generator(12345U);
+  checker.setRandomInitialState(generator);
+  checker.signalDone();
+  EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NoInformation);
+}
+
+TEST_F(CancellationTest, ParallelRunReturnsAfterDecision) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 4U;
+  config.execution.runZXChecker = false;
+  config.simulation.maxSims = 16U;
+
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  std::cout << ecm.getResults() << '\n';
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+  // a subsequent run must not interfere with checkers of the previous run
+  ecm.reset();
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/Checkpoint.hpp"
+#include "checker/dd/DDAlternatingChecker.hpp"
+#include "checker/dd/applicationscheme/ApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <nlohmann/json.hpp>
+#include <string>
+
+class CheckpointTest : public testing::Test {
+protected:
+  void SetUp() override {
+    using namespace qc::literals;
+    for (std::size_t rep = 0U; rep < 3U; ++rep) {
+      for (qc::Qubit q = 0U; q < 3U; ++q) {
+        qc1.h(q);
+        qc1.t(q);
+      }
+      qc1.cx(0_pc, 1);
+      qc1.cx(1_pc, 2);
+    }
+    qc2 = qc1;
+
+    file = std::filesystem::temp_directory_path() /
+           ("qcec-" +
+            std::string(
+                testing::UnitTest::GetInstance()->current_test_info()->name()) +
+            ".ckpt");
+    std::filesystem::remove(file);
+    config.execution.checkpointFile = file.string();
+    config.execution.checkpointInterval = 0.;
+  }
+
+  void TearDown() override { std::filesystem::remove(file); }
+
+  [[nodiscard]] nlohmann::json
+  runChecker(const ec::EquivalenceCriterion expected) const {
+    ec::DDAlternatingChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), expected);
+    nlohmann::json j{};
+    checker.json(j);
+    return j.at("checkpoint");
+  }
+
+  qc::QuantumComputation qc1{3U};
+  qc::QuantumComputation qc2{3U};
+  ec::Configuration config{};
+  std::filesystem::path file;
+};
+
+TEST_F(CheckpointTest, ResumeFinishedCheck) {
+  const auto first = runChecker(ec::EquivalenceCriterion::Equivalent);
+  EXPECT_FALSE(first["resumed"].get<bool>());
+  EXPECT_GT(first["written"].get<std::size_t>(), 0U);
+  EXPECT_TRUE(std::filesystem::exists(file));
+
+  const auto second = runChecker(ec::EquivalenceCriterion::Equivalent);
+  EXPECT_TRUE(second["resumed"].get<bool>());
+}
+
+TEST_F(CheckpointTest, ResumeNonEquivalentCheck) {
+  qc2.x(0);
+  runChecker(ec::EquivalenceCriterion::NotEquivalent);
+  const auto second = runChecker(ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_TRUE(second["resumed"].get<bool>());
+}
+
+TEST_F(CheckpointTest, ResumeInterruptedCheck) {
+  // the state at the time of the interruption is kept
+  {
+    ec::DDAlternatingChecker checker(qc1, qc2, config);
+    checker.signalDone();
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NoInformation);
+  }
+  EXPECT_TRUE(std::filesystem::exists(file));
+
+  config.execution.checkpointInterval = 300.;
+  const auto resumed = runChecker(ec::EquivalenceCriterion::Equivalent);
+  EXPECT_TRUE(resumed["resumed"].get<bool>());
+}
+
+TEST_F(CheckpointTest, ResumeGateCostCheckHalfway) {
+  // every S gate of the first circuit is compiled to two T gates
+  using namespace qc::literals;
+  constexpr std::size_t reps = 4U;
+  qc1 = qc::QuantumComputation(3U);
+  qc2 = qc::QuantumComputation(3U);
+  for (std::size_t rep = 0U; rep < reps; ++rep) {
+    for (qc::Qubit q = 0U; q < 3U; ++q) {
+      qc1.h(q);
+      qc1.s(q);
+      qc2.h(q);
+      qc2.t(q);
+      qc2.t(q);
+    }
+    for (auto* const qc : {&qc1, &qc2}) {
+      qc->cx(0_pc, 1);
+      qc->cx(1_pc, 2);
+    }
+  }
+  config.application.alternatingScheme = ec::ApplicationSchemeType::GateCost;
+  config.application.costFunction =
+      [](const ec::GateCostLookupTableKeyType& key) -> std::size_t {
+    return key.first == qc::S ? 2U : 1U;
+  };
+  config.execution.instrumentation = true;
+  config.execution.checkpointInterval = 300.;
+
+  // the gates of the schedule cancel each other, so the DD never grows
+  const auto peakNodes = [this](const bool resume) {
+    ec::DDAlternatingChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+    nlohmann::json j{};
+    checker.json(j);
+    EXPECT_EQ(j["checkpoint"]["resumed"].get<bool>(), resume);
+    return j["dd"]["peak_nodes"].get<std::size_t>();
+  };
+  const auto uninterrupted = peakNodes(false);
+
+  // after half of the repetitions, both circuits realize the same unitary
+  ec::Checkpoint checkpoint("decision_diagram_alternating", "gate_cost", qc1,
+                            qc2);
+  checkpoint.positions = {(qc1.getNops() / reps) * (reps / 2U),
+                          (qc2.getNops() / reps) * (reps / 2U)};
+  ASSERT_TRUE(checkpoint.save(file.string(), dd::Package::makeIdent()));
+  EXPECT_EQ(peakNodes(true), uninterrupted);
+}
+
+TEST_F(CheckpointTest, IgnoreCheckpointOfOtherCircuits) {
+  runChecker(ec::EquivalenceCriterion::Equivalent);
+  qc2.x(0);
+  const auto other = runChecker(ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_FALSE(other["resumed"].get<bool>());
+}
+
+TEST_F(CheckpointTest, IgnoreCheckpointOfOtherGarbageQubits) {
+  runChecker(ec::EquivalenceCriterion::Equivalent);
+
+  // the hashes still match, but the qubits are not considered the same way
+  std::string magic{};
+  std::string header{};
+  std::string rest{};
+  {
+    std::ifstream ifs(file, std::ios::binary);
+    std::getline(ifs, magic);
+    std::getline(ifs, header);
+    rest.assign(std::istreambuf_iterator<char>(ifs),
+                std::istreambuf_iterator<char>());
+  }
+  auto j = nlohmann::json::parse(header);
+  j["garbage"][1][2] = true;
+  {
+    std::ofstream ofs(file, std::ios::binary);
+    ofs << magic << '\n' << j.dump() << '\n' << rest;
+  }
+  const auto other = runChecker(ec::EquivalenceCriterion::Equivalent);
+  EXPECT_FALSE(other["resumed"].get<bool>());
+}
+
+TEST_F(CheckpointTest, IgnoreCorruptCheckpoint) {
+  {
+    std::ofstream ofs(file);
+    ofs << "QCEC-CHECKPOINT\n{not json}\n";
+  }
+  const auto j = runChecker(ec::EquivalenceCriterion::Equivalent);
+  EXPECT_FALSE(j["resumed"].get<bool>());
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/clifford/CliffordChecker.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <string>
+
+class CliffordTest : public testing::Test {
+protected:
+  void SetUp() override {
+    config.execution.runCliffordChecker = true;
+    config.execution.runAlternatingChecker = false;
+    config.execution.runConstructionChecker = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+  }
+
+  [[nodiscard]] ec::EquivalenceCriterion check() const {
+    EXPECT_TRUE(ec::CliffordEquivalenceChecker::canHandle(qc1, qc2));
+    ec::CliffordEquivalenceChecker checker(qc1, qc2, config);
+    return checker.run();
+  }
+
+  qc::QuantumComputation qc1{2U};
+  qc::QuantumComputation qc2{2U};
+  ec::Configuration config{};
+};
+
+TEST_F(CliffordTest, ControlledZ) {
+  using namespace qc::literals;
+  qc1.cz(0_pc, 1);
+  qc2.h(1);
+  qc2.cx(0_pc, 1);
+  qc2.h(1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, SwapDecomposition) {
+  using namespace qc::literals;
+  qc1.swap(0, 1);
+  qc2.cx(0_pc, 1);
+  qc2.cx(1_pc, 0);
+  qc2.cx(0_pc, 1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, ISwapDecomposition) {
+  using namespace qc::literals;
+  qc1.iswap(0, 1);
+  qc2.s(0);
+  qc2.s(1);
+  qc2.h(0);
+  qc2.cx(0_pc, 1);
+  qc2.cx(1_pc, 0);
+  qc2.h(1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, RotationsByQuarterTurns) {
+  qc1.rz(qc::PI_2, 0);
+  qc1.rx(qc::PI, 1);
+  qc1.sx(0);
+  qc2.s(0);
+  qc2.x(1);
+  qc2.h(0);
+  qc2.s(0);
+  qc2.h(0);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, NegativeControl) {
+  using namespace qc::literals;
+  qc1.cx(0_nc, 1);
+  qc2.x(0);
+  qc2.cx(0_pc, 1);
+  qc2.x(0);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, NonEquivalentPhase) {
+  qc1.h(0);
+  qc2.h(0);
+  qc2.s(1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(CliffordTest, NonEquivalentBitFlip) {
+  using namespace qc::literals;
+  qc1.cx(0_pc, 1);
+  qc2.cx(1_pc, 0);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(CliffordTest, SignOfPauli) {
+  // Y only agrees with Z X up to a global phase
+  qc1.y(0);
+  qc2.x(0);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::NotEquivalent);
+  qc2.z(0);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, Permutations) {
+  qc1.h(0);
+  qc1.outputPermutation[0] = 1;
+  qc1.outputPermutation[1] = 0;
+  qc2.h(1);
+  qc2.initialLayout[0] = 1;
+  qc2.initialLayout[1] = 0;
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, Ancilla) {
+  using namespace qc::literals;
+  // the ancilla starts in |0>, so the CNOT has no effect
+  qc1.i(0);
+  qc1.setLogicalQubitAncillary(1);
+  qc2.cx(1_pc, 0);
+  qc2.setLogicalQubitAncillary(1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+
+  qc2.x(1);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(CliffordTest, CannotHandleNonClifford) {
+  qc1.t(0);
+  qc2.t(0);
+  EXPECT_FALSE(ec::CliffordEquivalenceChecker::canHandle(qc1, qc2));
+
+  auto qc3 = qc::QuantumComputation(2U);
+  qc3.rz(0.1, 0);
+  EXPECT_FALSE(ec::CliffordEquivalenceChecker::canHandle(qc3, qc3));
+
+  const auto qc4 = qc::QuantumComputation(2U);
+  const auto qc5 = qc::QuantumComputation(3U);
+  EXPECT_FALSE(ec::CliffordEquivalenceChecker::canHandle(qc4, qc5));
+}
+
+TEST_F(CliffordTest, WideCircuit) {
+  constexpr std::size_t nqubits = 1000U;
+  qc1 = qc::QuantumComputation(nqubits);
+  qc2 = qc::QuantumComputation(nqubits);
+  qc1.h(0);
+  qc2.h(0);
+  for (qc::Qubit q = 1U; q < nqubits; ++q) {
+    qc1.cx(qc::Control{q - 1U}, q);
+    qc2.cx(qc::Control{0U}, q);
+  }
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::NotEquivalent);
+
+  // a chain and a fan-out of CNOTs only agree on the all-zero state
+  qc2 = qc1;
+  qc2.s(nqubits - 1U);
+  qc2.sdg(nqubits - 1U);
+  EXPECT_EQ(check(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(CliffordTest, Json) {
+  qc1.h(0);
+  qc2.h(0);
+  ec::CliffordEquivalenceChecker checker(qc1, qc2, config);
+  checker.run();
+  nlohmann::json j{};
+  checker.json(j);
+  EXPECT_EQ(j["checker"].get<std::string>(), "clifford");
+  EXPECT_EQ(j["tableau_qubits"].get<std::size_t>(), 4U);
+  EXPECT_EQ(j["gates"].get<std::size_t>(), 2U);
+}
+
+TEST_F(CliffordTest, CheckingManager) {
+  qc1 = qasm3::Importer::importf("./circuits/test/test.qasm");
+  qc2 = qasm3::Importer::importf(
+      "./circuits/test/test_ancilla_inputperm_outputperm.qasm");
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.getResults().equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+  const auto j = ecm.getResults().json();
+  EXPECT_EQ(j["checkers"][0]["checker"].get<std::string>(), "clifford");
+}
+
+TEST_F(CliffordTest, CheckingManagerFallsBack) {
+  // circuits the tableaux cannot handle are passed on to the other checkers
+  qc1.t(0);
+  qc2.t(0);
+  config.execution.runConstructionChecker = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+}
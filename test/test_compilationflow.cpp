@@ -13,18 +13,27 @@
 #include "checker/dd/TaskManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/GateCostProfile.hpp"
+#include "checker/dd/applicationscheme/GateCostProfileStore.hpp"
 #include "dd/Package.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/OpType.hpp"
 #include "qasm3/Importer.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <ios>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace ec {
 namespace {
@@ -218,4 +227,155 @@ TEST(CompilationFlowTest, CompilationFlowProfileFromFile) {
   // NOLINTEND(misc-const-correctness)
 }
 
+TEST(CompilationFlowTest, CompiledProfile) {
+  const std::string filename = "compiled.profile";
+  std::ofstream ofs(filename);
+  ofs << "# comment\nx 2 15\nx 1 3\nh 0 0\n";
+  ofs.close();
+  const std::string compiled = "compiled.profile.bin";
+  GateCostProfile::compile(filename, compiled);
+
+  const auto text = GateCostProfile::load(filename);
+  const auto binary = GateCostProfile::load(compiled);
+  EXPECT_EQ(binary->size(), 3U);
+  EXPECT_EQ(binary->getMaxControls(), 2U);
+  EXPECT_EQ(binary->getSource(), compiled);
+  for (const auto type : {qc::X, qc::H, qc::Z}) {
+    for (std::size_t nc = 0U; nc <= 3U; ++nc) {
+      EXPECT_EQ(binary->cost(type, nc), text->cost(type, nc));
+    }
+  }
+  EXPECT_EQ(binary->cost(qc::X, 2U), 15U);
+  EXPECT_EQ(binary->cost(qc::H, 0U), 0U);
+  EXPECT_EQ(binary->cost(qc::X, 3U), 1U);
+#if defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+  EXPECT_TRUE(binary->isMapped());
+#endif
+
+  auto qc = qc::QuantumComputation(3, 3);
+  qc.mcx({1, 2}, 0);
+  auto dd = std::make_unique<dd::Package>(3);
+  auto tm = TaskManager<dd::MatrixDD>(qc, *dd);
+  auto scheme = GateCostApplicationScheme(tm, tm, binary, false);
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(1U, 15U));
+  EXPECT_EQ(scheme.getProfile(), binary);
+
+  // the profile is loaded once by the manager and shared by all checkers
+  Configuration config{};
+  config.application.profile = compiled;
+  config.application.alternatingScheme = ApplicationSchemeType::GateCost;
+  config.execution.runSimulationChecker = false;
+  EquivalenceCheckingManager ecm(qc, qc, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  const auto& loaded = ecm.getConfiguration().application.gateCostProfile;
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getSource(), compiled);
+
+  // garbage is rejected when it claims to be a compiled profile
+  std::ofstream corrupt(compiled, std::ios::binary | std::ios::app);
+  corrupt << "garbage";
+  corrupt.close();
+  EXPECT_THROW(static_cast<void>(GateCostProfile::load(compiled)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(GateCostProfile::load("missing.profile")),
+               std::invalid_argument);
+}
+
+TEST(CompilationFlowTest, ProfileStore) {
+  const auto filename =
+      (std::filesystem::temp_directory_path() / "qcec_test.profile").string();
+  std::filesystem::remove(filename);
+  GateCostProfileStore::clear();
+
+  std::size_t calls = 0U;
+  const CostFunction costFunction =
+      [&calls](const GateCostLookupTableKeyType& key) {
+        ++calls;
+        return key.second == 0U ? 1U : 5U * key.second;
+      };
+
+  // costs are only computed once they are needed
+  const auto store = GateCostProfileStore::open(filename, costFunction);
+  EXPECT_EQ(store->size(), 0U);
+  EXPECT_EQ(store->cost({qc::X, 2U}), 10U);
+  EXPECT_EQ(store->cost({qc::X, 2U}), 10U);
+  EXPECT_EQ(calls, 1U);
+
+  // the store is shared by all users of the same file
+  EXPECT_EQ(GateCostProfileStore::open(filename, costFunction), store);
+
+  auto qc = qc::QuantumComputation(3, 3);
+  qc.mcx({1, 2}, 0);
+  qc.h(0);
+  Configuration config{};
+  config.application.profileStore = filename;
+  config.application.costFunction = costFunction;
+  config.application.alternatingScheme = ApplicationSchemeType::GateCost;
+  config.execution.runSimulationChecker = false;
+  config.execution.runZXChecker = false;
+  config.execution.parallel = false;
+  EquivalenceCheckingManager ecm(qc, qc, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getConfiguration().json()["application"]["profile_store"],
+            filename);
+  EXPECT_EQ(store->size(), 2U);
+  EXPECT_EQ(store->computed(), 2U);
+  EXPECT_EQ(calls, 2U);
+
+  // the computed costs are persisted and reused by later processes
+  GateCostProfileStore::clear();
+  const auto reopened = GateCostProfileStore::open(filename, costFunction);
+  EXPECT_NE(reopened, store);
+  EXPECT_EQ(reopened->size(), 2U);
+  EXPECT_EQ(reopened->cost({qc::H, 0U}), 1U);
+  EXPECT_EQ(reopened->computed(), 0U);
+  EXPECT_EQ(calls, 2U);
+
+  // the file is a regular profile
+  const auto profile = GateCostProfile::load(filename);
+  EXPECT_EQ(profile->cost(qc::X, 2U), 10U);
+  EXPECT_EQ(profile->cost(qc::H, 0U), 1U);
+
+  GateCostProfileStore::clear();
+  std::filesystem::remove(filename);
+}
+
+TEST(CompilationFlowTest, ProfileStoreComputesWithoutLock) {
+  const auto filename =
+      (std::filesystem::temp_directory_path() / "qcec_test_concurrent.profile")
+          .string();
+  std::filesystem::remove(filename);
+  GateCostProfileStore::clear();
+
+  std::atomic<std::size_t> calls{0U};
+  std::shared_ptr<GateCostProfileStore> store{};
+  const CostFunction costFunction =
+      [&calls, &store](const GateCostLookupTableKeyType& key) -> std::size_t {
+    ++calls;
+    if (key.second == 0U) {
+      return 1U;
+    }
+    // the store can be used while one of its costs is being computed
+    return store->cost({key.first, 0U}) + key.second;
+  };
+  store = GateCostProfileStore::open(filename, costFunction);
+
+  // concurrent requests for the same cost wait for a single computation
+  std::vector<std::thread> threads{};
+  for (std::size_t i = 0U; i < 8U; ++i) {
+    threads.emplace_back(
+        [&store] { EXPECT_EQ(store->cost({qc::X, 2U}), 3U); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(calls, 2U);
+  EXPECT_EQ(store->computed(), 2U);
+
+  GateCostProfileStore::clear();
+  std::filesystem::remove(filename);
+}
+
 } // namespace ec
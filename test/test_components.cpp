@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "QubitComponents.hpp"
+#include "dd/RealNumber.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+
+using namespace qc::literals;
+
+class ComponentsTest : public testing::Test {
+protected:
+  void SetUp() override {
+    // two independent blocks on the qubits {0, 2} and {1, 3, 4}
+    qc1 = qc::QuantumComputation(5U);
+    qc1.h(0);
+    qc1.cx(0_pc, 2);
+    qc1.h(1);
+    qc1.cx(1_pc, 3);
+    qc1.cx(3_pc, 4);
+
+    qc2 = qc::QuantumComputation(5U);
+    qc2.h(1);
+    qc2.cx(1_pc, 3);
+    qc2.cx(3_pc, 4);
+    qc2.h(0);
+    qc2.cx(0_pc, 2);
+
+    config.execution.parallel = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.optimizations.decomposeComponents = true;
+  }
+
+  qc::QuantumComputation qc1;
+  qc::QuantumComputation qc2;
+  ec::Configuration config{};
+};
+
+TEST_F(ComponentsTest, SplitIntoComponents) {
+  const auto components = ec::splitIntoComponents(qc1, qc2);
+  ASSERT_EQ(components.size(), 2U);
+  // the smaller component comes first
+  EXPECT_EQ(components[0].first.getNqubits(), 2U);
+  EXPECT_EQ(components[0].first.getNops(), 2U);
+  EXPECT_EQ(components[1].first.getNqubits(), 3U);
+  EXPECT_EQ(components[1].second.getNops(), 3U);
+}
+
+TEST_F(ComponentsTest, PermutationsConnectQubits) {
+  // the output permutation swaps the qubits 0 and 1 of the first circuit
+  qc1.outputPermutation[0] = 1;
+  qc1.outputPermutation[1] = 0;
+  EXPECT_TRUE(ec::splitIntoComponents(qc1, qc2).empty());
+}
+
+TEST_F(ComponentsTest, ConnectedCircuitsAreNotDecomposed) {
+  qc1.cx(2_pc, 4);
+  EXPECT_TRUE(ec::splitIntoComponents(qc1, qc2).empty());
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.getResults().components, 0U);
+  EXPECT_FALSE(ecm.getResults().json().contains("components"));
+}
+
+TEST_F(ComponentsTest, Equivalent) {
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().components, 2U);
+
+  const auto json = ecm.getResults().json();
+  EXPECT_EQ(json["components"], 2U);
+  ASSERT_FALSE(json["checkers"].empty());
+  for (const auto& checker : json["checkers"]) {
+    EXPECT_TRUE(checker.contains("component"));
+  }
+}
+
+TEST_F(ComponentsTest, NotEquivalent) {
+  qc2.x(4);
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(ecm.getResults().components, 2U);
+}
+
+TEST_F(ComponentsTest, NestedManagersShareTolerance) {
+  // the components run their checkers one after another, but only the
+  // outermost manager sets the (process-wide) tolerance of the DD package
+  config.execution.runSimulationChecker = true;
+  config.execution.numericalTolerance = 1e-13;
+  config.execution.simulationTolerance = 1e-12;
+  config.execution.alternatingTolerance = 1e-10;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().components, 2U);
+  EXPECT_EQ(config.sharedTolerance(), 1e-12);
+  EXPECT_EQ(dd::RealNumber::eps, config.sharedTolerance());
+}
+
+TEST_F(ComponentsTest, GlobalPhase) {
+  qc2.gphase(qc::PI);
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(),
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(ComponentsTest, Parallel) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  config.execution.runSimulationChecker = true;
+  for (const bool equivalent : {true, false}) {
+    auto circ2 = qc2;
+    if (!equivalent) {
+      circ2.z(2);
+    }
+    auto ecm = ec::EquivalenceCheckingManager(qc1, circ2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.getResults().components, 2U);
+    if (equivalent) {
+      EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+    } else {
+      EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+    }
+  }
+}
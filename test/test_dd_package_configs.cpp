@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace qc::literals;
+
+TEST(DDPackageConfigs, SmallCircuitsUseSmallTables) {
+  const ec::Configuration::Execution execution{};
+  const auto small = ec::estimateDDPackageSizes(3U, 100U, false, execution);
+  const auto large =
+      ec::estimateDDPackageSizes(128U, 100'000U, true, execution);
+  EXPECT_LT(small.uniqueTableBuckets, large.uniqueTableBuckets);
+  EXPECT_LT(small.computeTableBuckets, large.computeTableBuckets);
+  for (const auto& sizes : {small, large}) {
+    EXPECT_TRUE(std::has_single_bit(sizes.uniqueTableBuckets));
+    EXPECT_TRUE(std::has_single_bit(sizes.computeTableBuckets));
+  }
+}
+
+TEST(DDPackageConfigs, ExplicitSizesTakePrecedence) {
+  ec::Configuration::Execution execution{};
+  execution.ddUniqueTableBuckets = 1000U;
+  execution.ddComputeTableBuckets = 4096U;
+  const auto sizes = ec::estimateDDPackageSizes(3U, 100U, true, execution);
+  EXPECT_EQ(sizes.uniqueTableBuckets, 1024U);
+  EXPECT_EQ(sizes.computeTableBuckets, 4096U);
+}
+
+TEST(DDPackageConfigs, ChosenSizesAreReported) {
+  auto qc1 = qc::QuantumComputation(2U);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+  auto qc2 = qc1;
+
+  auto config = ec::Configuration{};
+  config.execution.parallel = false;
+  config.execution.runZXChecker = false;
+  config.execution.runConstructionChecker = true;
+  config.execution.ddUniqueTableBuckets = 512U;
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  ASSERT_FALSE(json["checkers"].empty());
+  for (const auto& checker : json["checkers"]) {
+    ASSERT_TRUE(checker.contains("dd_package"));
+    const auto& tables = checker["dd_package"]["unique_table_buckets"];
+    if (checker["checker"] == "decision_diagram_simulation") {
+      EXPECT_EQ(tables["vector"], 512U);
+    } else {
+      EXPECT_EQ(tables["matrix"], 512U);
+    }
+  }
+}
@@ -12,13 +12,17 @@
 #include "EquivalenceCriterion.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "dd/DDDefinitions.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/operations/Control.hpp"
 
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory>
+#include <nlohmann/json.hpp>
 #include <optional>
 #include <stdexcept>
+#include <utility>
 
 class EqualityTest : public testing::Test {
   void SetUp() override {
@@ -485,6 +489,42 @@ TEST_F(EqualityTest, StripIdleQubitPresentOnlyInOneCircuit) {
   EXPECT_EQ(ecm.getSecondCircuit().getNqubits(), qc2.getNqubits() - 1);
 }
 
+TEST_F(EqualityTest, StripIdleQubitsOfWideDeviceMappedCircuit) {
+  using namespace qc::literals;
+
+  // a small circuit mapped to a wide device, where almost all qubits are idle
+  constexpr std::size_t deviceQubits = 1024U;
+  constexpr std::size_t offset = 700U;
+  qc1 = qc::QuantumComputation(3, 3);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+  qc1.cx(1_pc, 2);
+  qc1.measureAll(false);
+  qc1.initializeIOMapping();
+
+  qc2 = qc::QuantumComputation(deviceQubits, 3);
+  for (std::size_t p = 0U; p < deviceQubits; ++p) {
+    qc2.initialLayout[static_cast<qc::Qubit>(p)] =
+        static_cast<qc::Qubit>((p + deviceQubits - offset) % deviceQubits);
+  }
+  const auto q = [](const std::size_t logical) {
+    return static_cast<qc::Qubit>(logical + offset);
+  };
+  qc2.h(q(0));
+  qc2.cx(qc::Control{q(0)}, q(1));
+  qc2.cx(qc::Control{q(1)}, q(2));
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    qc2.measure(q(i), i);
+  }
+  qc2.initializeIOMapping();
+
+  config.execution.runConstructionChecker = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getSecondCircuit().getNqubits(), 3U);
+}
+
 TEST_F(EqualityTest, StripIdleQubitLogicalOnlyInOnePhysicalInBothCircuits) {
   //  Remove an idle logical qubit that is present only in one circuit, but
   //  which is mapped to a physical qubit that is present in both circuits
@@ -677,3 +717,294 @@ TEST_F(EqualityTest, RemoveDiagonalGatesBeforeMeasure) {
   EXPECT_TRUE(ecm2.getResults().consideredEquivalent());
   std::cout << ecm2.getResults() << "\n";
 }
+
+TEST_F(EqualityTest, MovedCircuits) {
+  qc1 = qc::QuantumComputation(2);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc2 = qc1;
+
+  config.execution.runAlternatingChecker = true;
+  ec::EquivalenceCheckingManager ecm(std::move(qc1), std::move(qc2), config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, SharedCircuitsAreNotModified) {
+  qc1 = qc::QuantumComputation(2, 2);
+  qc1.h(0);
+  qc1.x(1);
+  qc1.measure(0, 0);
+  qc1.measure(1, 1);
+  qc1.initializeIOMapping();
+
+  qc2 = qc::QuantumComputation(3, 2);
+  qc2.h(0);
+  qc2.x(1);
+  qc2.measure(0, 0);
+  qc2.measure(1, 1);
+  qc2.setLogicalQubitGarbage(2);
+  qc2.initializeIOMapping();
+
+  const auto shared1 = std::make_shared<const qc::QuantumComputation>(qc1);
+  const auto shared2 = std::make_shared<const qc::QuantumComputation>(qc2);
+
+  config.execution.runConstructionChecker = true;
+  ec::EquivalenceCheckingManager ecm(shared1, shared2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  // the idle qubit has only been stripped from the manager's copy
+  EXPECT_EQ(ecm.getSecondCircuit().getNqubits(), qc2.getNqubits() - 1);
+  EXPECT_EQ(shared2->getNqubits(), qc2.getNqubits());
+  EXPECT_EQ(shared1->getNops(), qc1.getNops());
+  EXPECT_NE(ecm.getSharedSecondCircuit(), shared2);
+}
+
+TEST_F(EqualityTest, PreprocessedCircuitsAreSharedWithoutCopy) {
+  qc1 = qc::QuantumComputation(2);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc1.x(1);
+  qc2 = qc1;
+
+  config.execution.runAlternatingChecker = true;
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  ecm1.run();
+  EXPECT_EQ(ecm1.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  ec::EquivalenceCheckingManager ecm2(ecm1.getSharedFirstCircuit(),
+                                      ecm1.getSharedSecondCircuit(), config,
+                                      true);
+  EXPECT_EQ(ecm2.getSharedFirstCircuit(), ecm1.getSharedFirstCircuit());
+  EXPECT_EQ(ecm2.getSharedSecondCircuit(), ecm1.getSharedSecondCircuit());
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, StripCommonGates) {
+  qc1 = qc::QuantumComputation(3);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc1.t(1);
+  qc1.cx(qc::Control{1}, 2);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+
+  const auto rewrite = [](const bool broken) {
+    auto qc = qc::QuantumComputation(3);
+    qc.h(0);
+    qc.cx(qc::Control{0}, 1);
+    qc.t(1);
+    qc.h(2);
+    qc.cz(qc::Control{1}, 2);
+    if (!broken) {
+      qc.h(2);
+    }
+    qc.h(0);
+    qc.cx(qc::Control{0}, 1);
+    return qc;
+  };
+  qc2 = rewrite(false);
+
+  config.execution.runAlternatingChecker = true;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reorderOperations = false;
+  config.optimizations.stripCommonGates = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  EXPECT_EQ(ecm.getFirstCircuit().getNops(), 1U);
+  EXPECT_EQ(ecm.getSecondCircuit().getNops(), 3U);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  // a difference between the common gates is still detected
+  ec::EquivalenceCheckingManager ecm2(qc1, rewrite(true), config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, StripCommonGatesKeepsGlobalPhase) {
+  qc1 = qc::QuantumComputation(2);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc2 = qc1;
+  qc2.gphase(qc::PI);
+
+  config.execution.runAlternatingChecker = true;
+  config.optimizations.stripCommonGates = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  // one operation is kept, such that the circuits do not become trivial
+  EXPECT_EQ(ecm.getFirstCircuit().getNops(), 1U);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(),
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(EqualityTest, StripCommonGatesTracksSwaps) {
+  qc1 = qc::QuantumComputation(2);
+  qc1.swap(0, 1);
+  qc1.cx(qc::Control{0}, 1);
+  qc1.t(0);
+
+  qc2 = qc::QuantumComputation(2);
+  qc2.swap(0, 1);
+  qc2.h(1);
+  qc2.cz(qc::Control{0}, 1);
+  qc2.h(1);
+  qc2.t(0);
+
+  config.execution.runAlternatingChecker = true;
+  config.optimizations.elidePermutations = false;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reconstructSWAPs = false;
+  config.optimizations.reorderOperations = false;
+  config.optimizations.stripCommonGates = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  const auto& circ1 = ecm.getFirstCircuit();
+  EXPECT_EQ(circ1.getNops(), 1U);
+  // the SWAP has become part of the layout
+  EXPECT_EQ(circ1.initialLayout.at(0), 1U);
+  EXPECT_EQ(circ1.initialLayout.at(1), 0U);
+  EXPECT_EQ(circ1.initialLayout, ecm.getSecondCircuit().initialLayout);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, ConstructionCheckerComparesWithoutMultiplying) {
+  qc1 = qc::QuantumComputation(3);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc1.cx(qc::Control{1}, 2);
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    qc1.rz(qc::PI / 3., 2);
+  }
+
+  const auto alternative = [](const double angle) {
+    auto qc = qc::QuantumComputation(3);
+    qc.h(0);
+    qc.cx(qc::Control{0}, 1);
+    qc.cx(qc::Control{1}, 2);
+    qc.rz(angle, 2);
+    return qc;
+  };
+
+  config.execution.runConstructionChecker = true;
+  config.optimizations.fuseSingleQubitGates = false;
+  // both functionalities only differ by numerical inaccuracies
+  ec::EquivalenceCheckingManager ecm(qc1, alternative(qc::PI), config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  ec::EquivalenceCheckingManager ecm2(qc1, alternative(qc::PI_2), config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, ConcurrentPreprocessing) {
+  // large enough for both circuits to be optimized concurrently
+  qc1 = qc::QuantumComputation(3);
+  for (std::size_t i = 0U; i < 200U; ++i) {
+    qc1.h(0);
+    qc1.t(1);
+    qc1.cx(qc::Control{static_cast<qc::Qubit>(i % 2U)}, 2);
+  }
+  qc2 = qc1;
+  qc2.swap(0, 1);
+  qc2.swap(0, 1);
+
+  config.execution.runConstructionChecker = true;
+  config.execution.parallel = false;
+  ec::EquivalenceCheckingManager sequential(qc1, qc2, config);
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  ec::EquivalenceCheckingManager concurrent(qc1, qc2, config);
+
+  EXPECT_EQ(concurrent.getFirstCircuit().getNops(),
+            sequential.getFirstCircuit().getNops());
+  EXPECT_EQ(concurrent.getSecondCircuit().getNops(),
+            sequential.getSecondCircuit().getNops());
+  concurrent.run();
+  EXPECT_EQ(concurrent.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, PipelinedPreprocessing) {
+  qc1 = qc::QuantumComputation(2);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc2 = qc1;
+  qc2.x(1);
+
+  config.execution.runSimulationChecker = true;
+  config.execution.pipelinedPreprocessing = true;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  // whether the speculative simulations decided the check depends on the time
+  // the preprocessing took, but the verdict does not
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  if (ecm.getResults().decidedDuringPreprocessing) {
+    EXPECT_GT(ecm.getResults().performedSimulations, 0U);
+    EXPECT_TRUE(ecm.getResults().json().contains(
+        "decided_during_preprocessing"));
+  }
+
+  // speculative simulations of equivalent circuits are discarded
+  config.execution.runConstructionChecker = true;
+  ec::EquivalenceCheckingManager ecm2(qc1, qc1, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_FALSE(ecm2.getResults().decidedDuringPreprocessing);
+}
+
+TEST_F(EqualityTest, SharedTolerance) {
+  config.execution.numericalTolerance = 1e-13;
+  config.execution.simulationTolerance = 1e-6;
+  config.execution.alternatingTolerance = 1e-12;
+  EXPECT_EQ(config.checkerTolerance(config.execution.simulationTolerance),
+            1e-6);
+  EXPECT_EQ(config.checkerTolerance(config.execution.constructionTolerance),
+            1e-13);
+
+  // only the tolerances of configured checkers are considered
+  config.execution.runSimulationChecker = true;
+  EXPECT_EQ(config.sharedTolerance(), 1e-6);
+  config.execution.runAlternatingChecker = true;
+  EXPECT_EQ(config.sharedTolerance(), 1e-12);
+  config.execution.runConstructionChecker = true;
+  EXPECT_EQ(config.sharedTolerance(), 1e-13);
+
+  config.execution.runConstructionChecker = false;
+  config.shareTolerance();
+  EXPECT_EQ(config.execution.numericalTolerance, 1e-12);
+  EXPECT_EQ(config.checkerTolerance(config.execution.simulationTolerance),
+            1e-12);
+}
+
+TEST_F(EqualityTest, PerCheckerTolerance) {
+  qc1 = qc::QuantumComputation(3U);
+  qc1.h(0);
+  qc1.cx(qc::Control{0}, 1);
+  qc1.t(1);
+  qc1.cx(qc::Control{1}, 2);
+  qc2 = qc1;
+
+  // coarse simulations screen for non-equivalence before the precise proof
+  config.execution.parallel = false;
+  config.execution.runSimulationChecker = true;
+  config.execution.runAlternatingChecker = true;
+  config.execution.simulationTolerance = 1e-6;
+  config.execution.alternatingTolerance = 1e-14;
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  std::cout << ecm.getResults() << "\n";
+  EXPECT_GT(ecm.getResults().performedSimulations, 0U);
+
+  qc2.x(2);
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+  const auto configuration = config.json();
+  EXPECT_EQ(configuration["execution"]["simulation_tolerance"].get<double>(),
+            1e-6);
+  EXPECT_FALSE(configuration["execution"].contains("construction_tolerance"));
+}
@@ -12,9 +12,11 @@
 #include "EquivalenceCheckingManager.hpp"
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/simulation/StateType.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "qasm3/Importer.hpp"
 
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <sstream>
@@ -96,6 +98,100 @@ TEST_P(FunctionalityTest, Lookahead) {
   EXPECT_TRUE(ecm.getResults().consideredEquivalent());
 }
 
+TEST_P(FunctionalityTest, LookaheadCostModel) {
+  config.execution.runAlternatingChecker = true;
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Lookahead;
+  config.application.lookaheadEstimateThreshold = 2.;
+  // only speculate on both candidate products for the smallest DDs
+  config.application.lookaheadMultiplicationBudget = 1U;
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << ecm.getResults() << "\n";
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  const auto json = ecm.getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  const auto& lookahead = json["checkers"].front()["lookahead"];
+  EXPECT_EQ(lookahead["estimate_threshold"], 2.);
+  EXPECT_GT(lookahead["estimated_steps"].get<std::size_t>() +
+                lookahead["budgeted_steps"].get<std::size_t>(),
+            0U);
+}
+
+TEST_P(FunctionalityTest, Adaptive) {
+  config.execution.runAlternatingChecker = true;
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Adaptive;
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << ecm.getResults() << "\n";
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+}
+
+TEST_F(FunctionalityTest, AdaptiveDecisions) {
+  // CNOTs on one side and their decomposition into Hadamards and CZs on the
+  // other side, such that the DD grows and shrinks again
+  qcOriginal = qc::QuantumComputation(3U);
+  qcAlternative = qc::QuantumComputation(3U);
+  for (qc::Qubit q = 0U; q < 2U; ++q) {
+    qcOriginal.cx(q, q + 1U);
+    qcAlternative.h(q + 1U);
+    qcAlternative.cz(q, q + 1U);
+    qcAlternative.h(q + 1U);
+  }
+  qcOriginal.t(0);
+  qcAlternative.t(0);
+
+  config.execution.runAlternatingChecker = true;
+  config.application.alternatingScheme = ec::ApplicationSchemeType::Adaptive;
+  config.optimizations.fuseSingleQubitGates = false;
+  config.optimizations.reconstructSWAPs = false;
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  const auto json = ecm.getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  const auto& adaptive = json["checkers"].front()["adaptive"];
+  EXPECT_GT(adaptive["steps_first"].get<std::size_t>(), 0U);
+  EXPECT_GT(adaptive["steps_second"].get<std::size_t>(), 0U);
+  ASSERT_FALSE(adaptive["decisions"].empty());
+  EXPECT_EQ(adaptive["decisions"].size(),
+            adaptive["switches"].get<std::size_t>() + 1U);
+  EXPECT_GE(adaptive["peak_nodes"].get<std::size_t>(),
+            adaptive["baseline_nodes"].get<std::size_t>());
+  const auto& first = adaptive["decisions"].front();
+  EXPECT_EQ(first["position1"], 0U);
+  EXPECT_EQ(first["position2"], 0U);
+  EXPECT_EQ(first["reason"], "balanced");
+}
+
+TEST_P(FunctionalityTest, AlternatingPortfolio) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 4U;
+  config.execution.runAlternatingChecker = true;
+  config.application.alternatingPortfolio = {
+      ec::ApplicationSchemeType::Proportional,
+      ec::ApplicationSchemeType::Lookahead,
+      ec::ApplicationSchemeType::Sequential};
+  EXPECT_FALSE(config.onlySingleTask());
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << ecm.getResults() << "\n";
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  const auto configJson = ecm.getConfiguration().json();
+  EXPECT_EQ(configJson["application"]["alternating_portfolio"].size(), 3U);
+  const auto json = ecm.getResults().json();
+  for (const auto& checker : json["checkers"]) {
+    EXPECT_EQ(checker["checker"], "decision_diagram_alternating");
+    EXPECT_TRUE(checker.contains("application_scheme"));
+  }
+}
+
 TEST_P(FunctionalityTest, Naive) {
   config.execution.runAlternatingChecker = true;
   config.application.alternatingScheme = ec::ApplicationSchemeType::OneToOne;
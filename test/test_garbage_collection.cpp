@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/GarbageCollector.hpp"
+#include "dd/Package.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace qc::literals;
+
+class GarbageCollectionTest : public testing::TestWithParam<std::size_t> {
+protected:
+  void SetUp() override {
+    qc1 = qc::QuantumComputation(nqubits);
+    for (std::size_t i = 0U; i < 10U; ++i) {
+      for (qc::Qubit q = 0U; q < nqubits; ++q) {
+        qc1.h(q);
+      }
+      for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+        qc1.cx(qc::Control{q}, q + 1U);
+      }
+    }
+    qc2 = qc1;
+
+    config.execution.parallel = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.execution.gcInterval = GetParam();
+  }
+
+  std::size_t nqubits = 4U;
+  qc::QuantumComputation qc1;
+  qc::QuantumComputation qc2;
+  ec::Configuration config{};
+};
+
+INSTANTIATE_TEST_SUITE_P(Intervals, GarbageCollectionTest,
+                         testing::Values(0U, 1U, 7U, 1000U));
+
+TEST_P(GarbageCollectionTest, EquivalenceIndependentOfInterval) {
+  config.execution.runConstructionChecker = true;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 2U);
+  for (const auto& checker : json["checkers"]) {
+    ASSERT_TRUE(checker.contains("garbage_collection"));
+    const auto& gc = checker["garbage_collection"];
+    EXPECT_EQ(gc["interval"], GetParam());
+    // the collector is invoked at most once per applied gate
+    EXPECT_LE(gc["invocations"].get<std::size_t>(),
+              qc1.getNops() + qc2.getNops());
+    if (GetParam() == 0U) {
+      EXPECT_EQ(gc["invocations"], 0U);
+    }
+  }
+}
+
+TEST(GarbageCollector, MemoryThresholdForcesCollection) {
+  auto dd = dd::Package(1U);
+  // any process exceeds a budget of a single byte
+  auto collector = ec::GarbageCollector(dd, 0U, 1U);
+  for (std::size_t i = 0U; i < 128U; ++i) {
+    collector.step();
+  }
+  EXPECT_EQ(collector.getInvocations(), 2U);
+  nlohmann::json j{};
+  collector.json(j);
+  EXPECT_EQ(j["forced_collections"], 2U);
+}
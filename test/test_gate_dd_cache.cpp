@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/GateDDCache.hpp"
+#include "dd/Operations.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/Permutation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+
+class GateDDCacheTest : public ::testing::Test {
+protected:
+  dd::Package dd{2U};
+  qc::Permutation identity{};
+  qc::Permutation swapped{};
+
+  void SetUp() override {
+    identity[0] = 0;
+    identity[1] = 1;
+    swapped[0] = 1;
+    swapped[1] = 0;
+  }
+};
+
+TEST_F(GateDDCacheTest, RepeatedGatesAreLookedUp) {
+  ec::GateDDCache cache(dd);
+  const qc::StandardOperation h(0, qc::H);
+  const qc::StandardOperation rz(1, qc::RZ, {0.25});
+
+  std::size_t builds = 0U;
+  const auto build = [&](const qc::StandardOperation& op,
+                         const qc::Permutation& perm) {
+    return [&, perm] {
+      ++builds;
+      return dd::getDD(op, dd, perm);
+    };
+  };
+
+  const auto e1 = cache.get(h, identity, false, build(h, identity));
+  const auto e2 = cache.get(h, identity, false, build(h, identity));
+  EXPECT_EQ(e1.p, e2.p);
+  EXPECT_EQ(builds, 1U);
+
+  // a different permutation, parameter, or the inverse is a different gate
+  const auto e3 = cache.get(h, swapped, false, build(h, swapped));
+  EXPECT_EQ(e3.p, dd::getDD(h, dd, swapped).p);
+  cache.get(rz, identity, false, build(rz, identity));
+  cache.get(rz, identity, true, [&] {
+    ++builds;
+    return dd::getInverseDD(rz, dd, identity);
+  });
+  EXPECT_EQ(builds, 4U);
+  EXPECT_EQ(cache.size(), 4U);
+  EXPECT_EQ(cache.getHits(), 1U);
+  EXPECT_EQ(cache.getMisses(), 4U);
+
+  // cached DDs survive garbage collection
+  dd.garbageCollect(true);
+  const auto e4 = cache.get(h, identity, false, build(h, identity));
+  EXPECT_EQ(e4.p, e1.p);
+  EXPECT_EQ(builds, 4U);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(GateDDCacheTest, CapacityIsRespected) {
+  ec::GateDDCache cache(dd, 1U);
+  const qc::StandardOperation x(0, qc::X);
+  const qc::StandardOperation y(0, qc::Y);
+  cache.get(x, identity, false, [&] { return dd::getDD(x, dd, identity); });
+  cache.get(y, identity, false, [&] { return dd::getDD(y, dd, identity); });
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_EQ(cache.getEvictions(), 1U);
+
+  ec::GateDDCache disabled(dd, 0U);
+  disabled.get(x, identity, false, [&] { return dd::getDD(x, dd, identity); });
+  EXPECT_EQ(disabled.size(), 0U);
+}
+
+TEST_F(GateDDCacheTest, FullCacheEvictsLeastRecentlyUsed) {
+  ec::GateDDCache cache(dd, 2U);
+  const qc::StandardOperation x(0, qc::X);
+  const qc::StandardOperation y(0, qc::Y);
+  const qc::StandardOperation z(0, qc::Z);
+
+  std::size_t builds = 0U;
+  const auto get = [&](const qc::StandardOperation& op) {
+    return cache.get(op, identity, false, [&] {
+      ++builds;
+      return dd::getDD(op, dd, identity);
+    });
+  };
+
+  get(x);
+  get(y);
+  // looking up `x` makes `y` the least recently used entry
+  get(x);
+  get(z);
+  EXPECT_EQ(builds, 3U);
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.getEvictions(), 1U);
+
+  // `x` and `z` are still cached, while `y` has to be rebuilt
+  get(x);
+  get(z);
+  EXPECT_EQ(builds, 3U);
+  get(y);
+  EXPECT_EQ(builds, 4U);
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.getEvictions(), 2U);
+
+  // the entries that remain cached survive garbage collection
+  dd.garbageCollect(true);
+  const auto e = get(y);
+  EXPECT_EQ(e.p, dd::getDD(y, dd, identity).p);
+  EXPECT_EQ(builds, 4U);
+  cache.clear();
+}
+
+TEST_F(GateDDCacheTest, LargeGatesAreNotCached) {
+  dd::Package large{ec::GateDDCache::MAX_QUBITS + 1U};
+  ec::GateDDCache cache(large);
+  qc::Controls controls{};
+  for (qc::Qubit q = 1U; q <= ec::GateDDCache::MAX_QUBITS; ++q) {
+    controls.emplace(q);
+  }
+  const qc::StandardOperation mcx(controls, 0, qc::X);
+  qc::Permutation perm{};
+  for (qc::Qubit q = 0U; q <= ec::GateDDCache::MAX_QUBITS; ++q) {
+    perm[q] = q;
+  }
+  std::size_t builds = 0U;
+  for (std::size_t i = 0U; i < 2U; ++i) {
+    cache.get(mcx, perm, false, [&] {
+      ++builds;
+      return dd::getDD(mcx, large, perm);
+    });
+  }
+  EXPECT_EQ(builds, 2U);
+  EXPECT_EQ(cache.size(), 0U);
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "IncrementalEquivalenceCheckingManager.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class IncrementalTest : public testing::Test {
+protected:
+  void SetUp() override {
+    for (std::size_t rep = 0U; rep < 4U; ++rep) {
+      for (qc::Qubit q = 0U; q < 3U; ++q) {
+        qc1.h(q);
+        qc1.t(q);
+      }
+      qc1.cx(qc::Control{0}, 1);
+      qc1.cx(qc::Control{1}, 2);
+    }
+    qc2 = qc1;
+  }
+
+  // replace the operation at the given position by its decomposition
+  static qc::QuantumComputation decomposeT(qc::QuantumComputation qc,
+                                           const std::size_t position) {
+    const auto target = qc.at(position)->getTargets().front();
+    qc.erase(qc.begin() + static_cast<std::ptrdiff_t>(position));
+    qc.insert(qc.begin() + static_cast<std::ptrdiff_t>(position),
+              std::make_unique<qc::StandardOperation>(target, qc::RZ,
+                                                      std::vector{qc::PI_4}));
+    return qc;
+  }
+
+  qc::QuantumComputation qc1{3U};
+  qc::QuantumComputation qc2{3U};
+  ec::Configuration config{};
+};
+
+TEST_F(IncrementalTest, EquivalentEdit) {
+  ec::IncrementalEquivalenceCheckingManager manager(qc1, qc2, config);
+  EXPECT_EQ(manager.run().equivalence, ec::EquivalenceCriterion::Equivalent);
+  EXPECT_FALSE(manager.decidedIncrementally());
+
+  // T and RZ(pi/4) only differ by a global phase
+  const auto edited = decomposeT(qc2, 1U);
+  const auto& results = manager.update(edited);
+  EXPECT_TRUE(manager.decidedIncrementally());
+  EXPECT_EQ(results.equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+  EXPECT_EQ(manager.getWindowSize(), (std::pair<std::size_t, std::size_t>{
+                                         1U, 1U}));
+  EXPECT_EQ(manager.getSecondCircuit().size(), edited.size());
+}
+
+TEST_F(IncrementalTest, NonEquivalentEdit) {
+  ec::IncrementalEquivalenceCheckingManager manager(qc1, qc2, config);
+  manager.run();
+
+  auto edited = qc2;
+  edited.erase(edited.begin() + 1);
+  manager.update(edited);
+  EXPECT_TRUE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
+
+  // the manager continues from the non-equivalent version
+  manager.update(qc1);
+  EXPECT_FALSE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(IncrementalTest, EditRange) {
+  ec::IncrementalEquivalenceCheckingManager manager(qc1, qc2, config);
+  manager.run();
+
+  // two separate edits are covered by a single range
+  auto edited = decomposeT(decomposeT(qc2, 1U), 9U);
+  manager.update(edited, 1U, 10U);
+  EXPECT_TRUE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+  EXPECT_EQ(manager.getWindowSize(), (std::pair<std::size_t, std::size_t>{
+                                         9U, 9U}));
+
+  // the operations outside the range have to match
+  auto other = edited;
+  other.x(0);
+  EXPECT_THROW(manager.update(other, 0U, 1U), std::invalid_argument);
+  EXPECT_THROW(manager.update(other, 2U, 1U), std::invalid_argument);
+
+  // the unchanged prefix and suffix must not overlap in the edited version
+  auto repeated = qc::QuantumComputation(3U);
+  for (const auto target : {0U, 1U, 2U, 1U, 2U, 0U}) {
+    repeated.h(target);
+  }
+  auto shortened = qc::QuantumComputation(3U);
+  for (const auto target : {0U, 1U, 2U, 0U}) {
+    shortened.h(target);
+  }
+  ec::IncrementalEquivalenceCheckingManager overlapping(repeated, repeated,
+                                                        config);
+  overlapping.run();
+  EXPECT_THROW(overlapping.update(shortened, 3U, 3U), std::invalid_argument);
+}
+
+TEST_F(IncrementalTest, UnchangedCircuit) {
+  ec::IncrementalEquivalenceCheckingManager manager(qc1, qc2, config);
+  manager.run();
+  manager.update(qc2);
+  EXPECT_TRUE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+
+  auto shifted = qc2;
+  shifted.gphase(qc::PI_2);
+  manager.update(shifted);
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(IncrementalTest, FallBackToFullCheck) {
+  ec::IncrementalEquivalenceCheckingManager manager(qc1, qc2, config);
+  // without a previous verdict, the full pair is checked
+  manager.update(decomposeT(qc2, 1U));
+  EXPECT_FALSE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+
+  // changed layouts cannot be checked incrementally
+  auto permuted = manager.getSecondCircuit();
+  permuted.outputPermutation[0] = 1;
+  permuted.outputPermutation[1] = 0;
+  manager.update(permuted);
+  EXPECT_FALSE(manager.decidedIncrementally());
+  EXPECT_EQ(manager.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace qc::literals;
+
+class InstrumentationTest : public testing::Test {
+protected:
+  void SetUp() override {
+    qc1 = qc::QuantumComputation(nqubits);
+    for (qc::Qubit q = 0U; q < nqubits; ++q) {
+      qc1.h(q);
+    }
+    for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+      qc1.cx(qc::Control{q}, q + 1U);
+    }
+    qc2 = qc1;
+
+    config.execution.parallel = false;
+    config.execution.runConstructionChecker = true;
+    config.execution.runSimulationChecker = true;
+    config.execution.runAlternatingChecker = true;
+    config.execution.runZXChecker = false;
+    config.simulation.maxSims = 2U;
+  }
+
+  std::size_t nqubits = 3U;
+  qc::QuantumComputation qc1;
+  qc::QuantumComputation qc2;
+  ec::Configuration config{};
+};
+
+TEST_F(InstrumentationTest, DisabledByDefault) {
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  for (const auto& checker : json["checkers"]) {
+    EXPECT_FALSE(checker.contains("phases"));
+    EXPECT_FALSE(checker.contains("dd"));
+  }
+}
+
+TEST_F(InstrumentationTest, RecordsPhasesAndStatistics) {
+  config.execution.instrumentation = true;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  ASSERT_FALSE(json["checkers"].empty());
+  for (const auto& checker : json["checkers"]) {
+    ASSERT_TRUE(checker.contains("phases"));
+    const auto& phases = checker["phases"];
+    double total = 0.;
+    for (const auto* phase : {"initialize", "execute", "finish", "postprocess",
+                              "check_equivalence"}) {
+      ASSERT_TRUE(phases.contains(phase));
+      EXPECT_GE(phases[phase].get<double>(), 0.);
+      total += phases[phase].get<double>();
+    }
+    // the phases are part of the runtime of the checker
+    EXPECT_LE(total, checker["runtime"].get<double>() + 1e-6);
+
+    ASSERT_TRUE(checker.contains("dd"));
+    const auto& dd = checker["dd"];
+    EXPECT_GT(dd["final_nodes"].get<std::size_t>(), 0U);
+    EXPECT_GE(dd["peak_nodes"].get<std::size_t>(),
+              dd["final_nodes"].get<std::size_t>());
+    EXPECT_TRUE(dd["package"].is_object());
+    EXPECT_FALSE(dd["package"].empty());
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+class MemoryLimitTest : public testing::TestWithParam<bool> {
+protected:
+  void SetUp() override {
+    qc1 = qc::QuantumComputation(nqubits);
+    // enough gates for the memory consumption to be checked several times
+    for (std::size_t i = 0U; i < 40U; ++i) {
+      for (qc::Qubit q = 0U; q < nqubits; ++q) {
+        qc1.h(q);
+      }
+      for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+        qc1.cx(qc::Control{q}, q + 1U);
+      }
+    }
+    qc2 = qc1;
+
+    config.execution.parallel = GetParam();
+    config.execution.nthreads = 4U;
+    config.execution.runConstructionChecker = true;
+    config.optimizations.fuseSingleQubitGates = false;
+    config.optimizations.reorderOperations = false;
+    // no package can be that small
+    config.execution.checkerMemoryLimit = 1U;
+  }
+
+  std::size_t nqubits = 5U;
+  qc::QuantumComputation qc1;
+  qc::QuantumComputation qc2;
+  ec::Configuration config{};
+};
+
+INSTANTIATE_TEST_SUITE_P(Execution, MemoryLimitTest, testing::Bool(),
+                         [](const testing::TestParamInfo<bool>& info) {
+                           return info.param ? "Parallel" : "Sequential";
+                         });
+
+TEST_P(MemoryLimitTest, DDCheckersAbortGracefully) {
+  config.execution.runZXChecker = false;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NoInformation);
+
+  const auto json = ecm.getResults().json();
+  ASSERT_FALSE(json["checkers"].empty());
+  for (const auto& checker : json["checkers"]) {
+    ASSERT_TRUE(checker.contains("memory"));
+    EXPECT_TRUE(checker["memory"]["limit_exceeded"].get<bool>());
+    EXPECT_GT(checker["memory"]["peak_package_memory"].get<std::size_t>(),
+              0U);
+  }
+}
+
+TEST_P(MemoryLimitTest, RemainingCheckersContinue) {
+  config.execution.runZXChecker = true;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST(MemoryLimit, PeakMemoryReportedWithoutLimit) {
+  auto qc = qc::QuantumComputation(2U);
+  qc.h(0);
+  qc.cx(qc::Control{0}, 1);
+
+  auto config = ec::Configuration{};
+  config.execution.parallel = false;
+  config.execution.runSimulationChecker = false;
+  config.execution.runZXChecker = false;
+  auto ecm = ec::EquivalenceCheckingManager(qc, qc, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  const auto& memory = json["checkers"][0]["memory"];
+  EXPECT_FALSE(memory["limit_exceeded"].get<bool>());
+  EXPECT_GT(memory["peak_package_memory"].get<std::size_t>(), 0U);
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "PreprocessingCache.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class PreprocessingCacheTest : public testing::Test {
+protected:
+  void SetUp() override {
+    ec::PreprocessingCache::global().clear();
+
+    qc1 = qc::QuantumComputation(2U);
+    qc1.h(0);
+    qc1.cx(qc::Control{0}, 1);
+    qc1.h(1);
+    qc1.h(1);
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.cx(qc::Control{0}, 1);
+    qc2.cx(qc::Control{0}, 2);
+    qc2.cx(qc::Control{0}, 2);
+    qc2.setLogicalQubitAncillary(2);
+    qc2.setLogicalQubitGarbage(2);
+
+    config.execution.parallel = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.execution.runAlternatingChecker = false;
+    config.execution.runConstructionChecker = true;
+    config.optimizations.cachePreprocessing = true;
+  }
+
+  void TearDown() override {
+    ec::PreprocessingCache::global().clear();
+    if (!directory.empty()) {
+      std::filesystem::remove_all(directory);
+    }
+  }
+
+  qc::QuantumComputation qc1;
+  qc::QuantumComputation qc2;
+  ec::Configuration config{};
+  std::filesystem::path directory;
+};
+
+TEST_F(PreprocessingCacheTest, RepeatedCheckIsServedFromMemory) {
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  EXPECT_EQ(ecm1.getResults().preprocessingCacheHits, 0U);
+  ecm1.run();
+
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  EXPECT_EQ(ecm2.getResults().preprocessingCacheHits, 2U);
+  EXPECT_EQ(ecm2.getSharedFirstCircuit(), ecm1.getSharedFirstCircuit());
+  EXPECT_EQ(ecm2.getSharedSecondCircuit(), ecm1.getSharedSecondCircuit());
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ecm1.equivalence());
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(PreprocessingCacheTest, OptimizedCircuitIsReusedAcrossPairs) {
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  ecm1.run();
+
+  auto variant = qc1;
+  variant.x(0);
+  variant.x(0);
+  ec::EquivalenceCheckingManager ecm2(qc1, variant, config);
+  // only the first circuit has been seen before
+  EXPECT_EQ(ecm2.getResults().preprocessingCacheHits, 1U);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(PreprocessingCacheTest, DifferentOptionsDoNotShareEntries) {
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  config.optimizations.fuseSingleQubitGates =
+      !config.optimizations.fuseSingleQubitGates;
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  EXPECT_EQ(ecm2.getResults().preprocessingCacheHits, 0U);
+}
+
+TEST_F(PreprocessingCacheTest, EntriesArePersistedOnDisk) {
+  directory = std::filesystem::temp_directory_path() /
+              "mqt-qcec-test-preprocessing-cache";
+  std::filesystem::remove_all(directory);
+  config.optimizations.cachePreprocessing = false;
+  config.optimizations.preprocessingCacheDirectory = directory.string();
+
+  ec::EquivalenceCheckingManager ecm1(qc1, qc2, config);
+  ecm1.run();
+  EXPECT_FALSE(std::filesystem::is_empty(directory));
+
+  // forget everything that is kept in memory
+  ec::PreprocessingCache::global().clear();
+
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  EXPECT_EQ(ecm2.getResults().preprocessingCacheHits, 2U);
+  EXPECT_EQ(ecm2.getFirstCircuit().getNqubits(),
+            ecm1.getFirstCircuit().getNqubits());
+  EXPECT_EQ(ecm2.getFirstCircuit().getNancillae(),
+            ecm1.getFirstCircuit().getNancillae());
+  EXPECT_EQ(ecm2.getSecondCircuit().getNgarbageQubits(),
+            ecm1.getSecondCircuit().getNgarbageQubits());
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ecm1.equivalence());
+}
+
+TEST_F(PreprocessingCacheTest, DiskHitPreservesFusedGates) {
+  directory = std::filesystem::temp_directory_path() /
+              "mqt-qcec-test-preprocessing-cache-fusion";
+  std::filesystem::remove_all(directory);
+  config.optimizations.fuseSingleQubitGates = true;
+  config.optimizations.preprocessingCacheDirectory = directory.string();
+
+  qc::QuantumComputation qc(2U);
+  qc.h(0);
+  qc.t(0);
+  qc.cx(qc::Control{0}, 1);
+  qc.s(1);
+  qc.h(1);
+
+  const ec::EquivalenceCheckingManager ecm(qc, qc, config);
+  const ec::EquivalenceCheckingManager memoryHit(qc, qc, config);
+  ASSERT_EQ(memoryHit.getResults().preprocessingCacheHits, 2U);
+  // the single-qubit gates have been fused
+  ASSERT_LT(memoryHit.getFirstCircuit().getNops(), qc.getNops());
+
+  ec::PreprocessingCache::global().clear();
+  const ec::EquivalenceCheckingManager diskHit(qc, qc, config);
+  ASSERT_EQ(diskHit.getResults().preprocessingCacheHits, 2U);
+  EXPECT_EQ(diskHit.getFirstCircuit().getNops(),
+            memoryHit.getFirstCircuit().getNops());
+  EXPECT_EQ(diskHit.getSecondCircuit().getNops(),
+            memoryHit.getSecondCircuit().getNops());
+}
+
+TEST_F(PreprocessingCacheTest, ConcurrentWritersUseSeparateFiles) {
+  directory = std::filesystem::temp_directory_path() /
+              "mqt-qcec-test-preprocessing-cache-concurrent";
+  std::filesystem::remove_all(directory);
+  config.optimizations.cachePreprocessing = false;
+  config.optimizations.preprocessingCacheDirectory = directory.string();
+
+  std::vector<std::thread> writers{};
+  for (std::size_t i = 0U; i < 4U; ++i) {
+    writers.emplace_back([this] {
+      const ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  // all temporary files have been moved into place
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    EXPECT_EQ(entry.path().string().find(".tmp"), std::string::npos);
+  }
+
+  ec::PreprocessingCache::global().clear();
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  EXPECT_EQ(ecm.getResults().preprocessingCacheHits, 2U);
+}
+
+TEST(PreprocessingCache, EvictsOldestEntries) {
+  auto cache = ec::PreprocessingCache(1U);
+  const auto circ = std::make_shared<const qc::QuantumComputation>(1U);
+  cache.store("a", {circ});
+  cache.store("b", {circ});
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_FALSE(cache.lookup("a").has_value());
+  EXPECT_TRUE(cache.lookup("b").has_value());
+  EXPECT_EQ(cache.getHits(), 1U);
+  EXPECT_EQ(cache.getMisses(), 1U);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "checker/dd/DDConstructionChecker.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+class ProgressTest : public ::testing::Test {
+protected:
+  qc::QuantumComputation qc1{4U};
+  qc::QuantumComputation qc2{4U};
+  ec::Configuration config{};
+
+  void SetUp() override {
+    using namespace qc::literals;
+    for (std::size_t rep = 0U; rep < 20U; ++rep) {
+      for (qc::Qubit q = 0U; q < 4U; ++q) {
+        qc1.h(q);
+        qc1.t(q);
+      }
+      for (qc::Qubit q = 1U; q < 4U; ++q) {
+        qc1.cx(0_pc, q);
+      }
+    }
+    qc2 = qc1;
+
+    config.execution.runAlternatingChecker = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.execution.runConstructionChecker = true;
+  }
+};
+
+TEST_F(ProgressTest, CheckerCountsAppliedGates) {
+  ec::DDConstructionChecker checker(qc1, qc2, config);
+  checker.run();
+  const auto progress = checker.getProgress();
+  EXPECT_EQ(progress.gates1, qc1.getNops());
+  EXPECT_EQ(progress.gates2, qc2.getNops());
+  EXPECT_EQ(progress.rewrites, 0U);
+}
+
+TEST_F(ProgressTest, ManagerReportsSnapshots) {
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  std::vector<ec::EquivalenceCheckingManager::Progress> snapshots{};
+  ecm.setProgressCallback(
+      [&snapshots](const ec::EquivalenceCheckingManager::Progress& progress) {
+        snapshots.emplace_back(progress);
+      },
+      1e-3);
+  ecm.run();
+
+  // a final snapshot is reported once the run has finished
+  ASSERT_FALSE(snapshots.empty());
+  for (std::size_t i = 1U; i < snapshots.size(); ++i) {
+    EXPECT_LE(snapshots[i - 1U].elapsed, snapshots[i].elapsed);
+  }
+  const auto& last = snapshots.back();
+  ASSERT_EQ(last.checkers.size(), 1U);
+  EXPECT_EQ(last.checkers.front().name, "decision_diagram_construction");
+  EXPECT_EQ(last.checkers.front().progress.gates1,
+            ecm.getFirstCircuit().getNops());
+  EXPECT_EQ(last.checkers.front().progress.gates2,
+            ecm.getSecondCircuit().getNops());
+}
+
+TEST_F(ProgressTest, CallbackErrorsArePropagated) {
+  ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+  ecm.setProgressCallback(
+      [](const ec::EquivalenceCheckingManager::Progress&) {
+        throw std::runtime_error("stop");
+      },
+      1e-3);
+  EXPECT_THROW(ecm.run(), std::runtime_error);
+
+  // disabling the callback restores the regular behavior
+  ecm.setProgressCallback({});
+  EXPECT_NO_THROW(ecm.run());
+}
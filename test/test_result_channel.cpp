@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ResultChannel.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(ResultChannelTest, CapacityIsPowerOfTwo) {
+  EXPECT_EQ(ec::ResultChannel<std::size_t>(0U).capacity(), 1U);
+  EXPECT_EQ(ec::ResultChannel<std::size_t>(5U).capacity(), 8U);
+  EXPECT_EQ(ec::ResultChannel<std::size_t>(8U).capacity(), 8U);
+}
+
+namespace {
+struct Message {
+  std::size_t id;
+  double value;
+};
+} // namespace
+
+TEST(ResultChannelTest, PopsInOrder) {
+  ec::ResultChannel<Message> channel(4U);
+  EXPECT_TRUE(channel.empty());
+  EXPECT_FALSE(channel.tryPop().has_value());
+
+  // the ring buffer wraps around multiple times
+  for (std::size_t round = 0U; round < 3U; ++round) {
+    for (std::size_t i = 0U; i < 4U; ++i) {
+      channel.push({i, static_cast<double>(round)});
+    }
+    EXPECT_FALSE(channel.empty());
+    for (std::size_t i = 0U; i < 4U; ++i) {
+      const auto [id, value] = channel.waitAndPop();
+      EXPECT_EQ(id, i);
+      EXPECT_EQ(value, static_cast<double>(round));
+    }
+    EXPECT_TRUE(channel.empty());
+  }
+}
+
+TEST(ResultChannelTest, WaitTimesOut) {
+  ec::ResultChannel<std::size_t> channel(1U);
+  const auto start = std::chrono::steady_clock::now();
+  const auto value =
+      channel.waitAndPopUntil(start + std::chrono::milliseconds(5));
+  EXPECT_FALSE(value.has_value());
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(5));
+
+  channel.push(42U);
+  EXPECT_EQ(channel.waitAndPopUntil(std::chrono::steady_clock::now() +
+                                    std::chrono::seconds(1)),
+            42U);
+}
+
+TEST(ResultChannelTest, TimedWaitWakesUpOnPush) {
+  ec::ResultChannel<std::size_t> channel(1U);
+  std::thread producer([&channel] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    channel.push(7U);
+  });
+  // the consumer is woken up by the push long before the deadline
+  const auto start = std::chrono::steady_clock::now();
+  const auto value = channel.waitAndPopUntil(start + std::chrono::seconds(30));
+  producer.join();
+  EXPECT_EQ(value, 7U);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST(ResultChannelTest, ManyProducers) {
+  constexpr std::size_t producers = 8U;
+  constexpr std::size_t values = 1000U;
+  // the channel is smaller than the number of values, such that producers
+  // have to wait for the consumer
+  ec::ResultChannel<std::size_t> channel(16U);
+
+  std::vector<std::thread> threads{};
+  for (std::size_t p = 0U; p < producers; ++p) {
+    threads.emplace_back([&channel, p] {
+      for (std::size_t i = 0U; i < values; ++i) {
+        channel.push((p * values) + i);
+      }
+    });
+  }
+
+  std::vector<std::size_t> last(producers, 0U);
+  std::vector<std::size_t> received(producers, 0U);
+  for (std::size_t i = 0U; i < producers * values; ++i) {
+    const auto value = channel.waitAndPop();
+    const auto p = value / values;
+    // values of the same producer arrive in order
+    if (received[p] > 0U) {
+      EXPECT_GT(value, last[p]);
+    }
+    last[p] = value;
+    ++received[p];
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto count : received) {
+    EXPECT_EQ(count, values);
+  }
+  EXPECT_TRUE(channel.empty());
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "qasm3/Importer.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace qc::literals;
+
+class SegmentedConstructionTest : public testing::Test {
+protected:
+  void SetUp() override {
+    config.execution.parallel = false;
+    config.execution.runConstructionChecker = true;
+    config.execution.runAlternatingChecker = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.execution.constructionThreads = 4U;
+    // keep the SWAPs in the circuits
+    config.optimizations.elidePermutations = false;
+  }
+
+  // a circuit with interleaved SWAPs, such that the segments start with
+  // different permutations
+  static qc::QuantumComputation makeCircuit(const std::size_t layers) {
+    constexpr std::size_t nqubits = 4U;
+    auto qc = qc::QuantumComputation(nqubits);
+    for (std::size_t i = 0U; i < layers; ++i) {
+      for (qc::Qubit q = 0U; q < nqubits; ++q) {
+        qc.h(q);
+        qc.t(q);
+      }
+      for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+        qc.cx(qc::Control{q}, q + 1U);
+      }
+      qc.swap(static_cast<qc::Qubit>(i % nqubits),
+              static_cast<qc::Qubit>((i + 1U) % nqubits));
+    }
+    return qc;
+  }
+
+  ec::Configuration config{};
+};
+
+TEST_F(SegmentedConstructionTest, Equivalent) {
+  const auto qc1 = makeCircuit(10U);
+  auto qc2 = makeCircuit(10U);
+  // a different decomposition of the last SWAP
+  qc2.erase(qc2.end() - 1);
+  qc2.cx(qc::Control{1U}, 2U);
+  qc2.cx(qc::Control{2U}, 1U);
+  qc2.cx(qc::Control{1U}, 2U);
+
+  config.optimizations.reconstructSWAPs = false;
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  const auto& segments = json["checkers"].front()["segments"];
+  EXPECT_EQ(segments[0], 4U);
+  EXPECT_EQ(segments[1], 4U);
+}
+
+TEST_F(SegmentedConstructionTest, NotEquivalent) {
+  const auto qc1 = makeCircuit(10U);
+  auto qc2 = makeCircuit(10U);
+  qc2.x(0);
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+  // the result matches the gate-by-gate construction
+  config.execution.constructionThreads = 1U;
+  auto reference = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  reference.run();
+  EXPECT_EQ(reference.equivalence(), ecm.equivalence());
+}
+
+TEST_F(SegmentedConstructionTest, SmallCircuitsAreNotSplit) {
+  const auto qc = makeCircuit(1U);
+  auto ecm = ec::EquivalenceCheckingManager(qc, qc, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm.getResults().json();
+  const auto& segments = json["checkers"].front()["segments"];
+  EXPECT_EQ(segments[0], 0U);
+  EXPECT_EQ(segments[1], 0U);
+}
+
+TEST_F(SegmentedConstructionTest, CompiledCircuit) {
+  const auto original =
+      qasm3::Importer::importf("./circuits/original/dk27_225.qasm");
+  const auto transpiled = qasm3::Importer::importf(
+      "./circuits/transpiled/dk27_225_transpiled.qasm");
+  auto ecm = ec::EquivalenceCheckingManager(original, transpiled, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+}
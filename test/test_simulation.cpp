@@ -10,12 +10,24 @@
 
 #include "Configuration.hpp"
 #include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "checker/dd/simulation/StateGenerator.hpp"
 #include "checker/dd/simulation/StateType.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
 #include "qasm3/Importer.hpp"
 
+#include <cmath>
+#include <complex>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
 
 class SimulationTest : public ::testing::Test {
 protected:
@@ -196,3 +208,291 @@ TEST_F(SimulationTest, GlobalStimuliAncillaryQubit) {
   std::cout << ecm.getFirstCircuit() << '\n' << ecm.getSecondCircuit() << '\n';
   EXPECT_TRUE(ecm.getResults().consideredEquivalent());
 }
+
+TEST_F(SimulationTest, BatchedStimuli) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  config.simulation.stimuliPerRun = 3U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << "Results:\n" << ecm.getResults() << '\n';
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  std::cout << "Results (expected non-equivalent):\n"
+            << ecm2.getResults() << '\n';
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_NE(ecm2.getResults().cexInput.p, nullptr);
+}
+
+TEST_F(SimulationTest, BatchedStimuliParallel) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  config.simulation.stimuliPerRun = 3U;
+  config.simulation.stateType = ec::StateType::Random1QBasis;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  std::cout << "Results:\n" << ecm.getResults() << '\n';
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().startedSimulations, config.simulation.maxSims);
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(SimulationTest, LongLivedWorkers) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  config.simulation.maxSims = 16U;
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+  EXPECT_EQ(ecm.getResults().startedSimulations, config.simulation.maxSims);
+  EXPECT_EQ(ecm.getResults().performedSimulations, config.simulation.maxSims);
+
+  // each worker runs many simulations with the same checker
+  const auto json = ecm.getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 2U);
+  std::size_t runs = 0U;
+  for (const auto& checker : json["checkers"]) {
+    const auto& latency = checker["runs"];
+    runs += latency["count"].get<std::size_t>();
+    EXPECT_LE(latency["min"].get<double>(), latency["max"].get<double>());
+  }
+  EXPECT_EQ(runs, config.simulation.maxSims);
+}
+
+TEST_F(SimulationTest, IndexedStimuli) {
+  constexpr std::size_t nqubits = 4U;
+  auto dd = std::make_unique<dd::Package>(nqubits);
+  const ec::StateGenerator generator(12345U);
+  const ec::StateGenerator other(12345U);
+
+  // all indices yield distinct basis states (without any shared state)
+  std::set<const dd::vNode*> states{};
+  for (std::size_t i = 0U; i < (1U << nqubits); ++i) {
+    const auto state = generator.generateState(*dd, i, nqubits);
+    EXPECT_TRUE(states.insert(state.p).second);
+    EXPECT_EQ(other.generateState(*dd, i, nqubits), state);
+  }
+
+  // the stream of each index is independent of the order of generation
+  const auto type = ec::StateType::Random1QBasis;
+  const auto later = generator.generateState(*dd, 7U, nqubits, 0U, type);
+  const auto earlier = generator.generateState(*dd, 3U, nqubits, 0U, type);
+  EXPECT_EQ(other.generateState(*dd, 3U, nqubits, 0U, type), earlier);
+  EXPECT_EQ(other.generateState(*dd, 7U, nqubits, 0U, type), later);
+}
+
+TEST_F(SimulationTest, StabilizerStimuli) {
+  constexpr std::size_t nqubits = 3U;
+  auto dd = std::make_unique<dd::Package>(nqubits);
+  const ec::StateGenerator generator(12345U);
+
+  // the amplitudes of a stabilizer state are either zero or all have the same
+  // magnitude 1 / sqrt(2^k) for some k
+  for (std::size_t i = 0U; i < 16U; ++i) {
+    const auto state = generator.generateState(*dd, i, nqubits, 0U,
+                                               ec::StateType::Stabilizer);
+    const auto vector = state.getVector();
+    std::size_t support = 0U;
+    for (const auto& amplitude : vector) {
+      if (std::abs(amplitude) > 1e-8) {
+        ++support;
+      }
+    }
+    ASSERT_GT(support, 0U);
+    EXPECT_EQ(support & (support - 1U), 0U);
+    const auto magnitude = 1. / std::sqrt(static_cast<double>(support));
+    for (const auto& amplitude : vector) {
+      if (std::abs(amplitude) > 1e-8) {
+        EXPECT_NEAR(std::abs(amplitude), magnitude, 1e-8);
+      }
+    }
+  }
+}
+
+TEST_F(SimulationTest, ExhaustiveBasisStates) {
+  using namespace qc::literals;
+
+  qcOriginal = qc::QuantumComputation(2U);
+  qcOriginal.h(0);
+  qcOriginal.cx(0_pc, 1);
+  qcAlternative = qc::QuantumComputation(2U);
+  qcAlternative.h(0);
+  qcAlternative.h(1);
+  qcAlternative.cz(0_pc, 1);
+  qcAlternative.h(1);
+
+  config.simulation.exhaustive = true;
+  config.simulation.maxSims = 1U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().performedSimulations, 4U);
+
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm2.getResults().performedSimulations, 4U);
+}
+
+TEST_F(SimulationTest, ExhaustiveBasisStatesUpToPhase) {
+  // both circuits only agree up to a global phase, which cannot be concluded
+  // from the individual simulations
+  qcOriginal = qc::QuantumComputation(1U);
+  qcOriginal.s(0);
+  qcAlternative = qc::QuantumComputation(1U);
+  qcAlternative.rz(qc::PI_2, 0);
+
+  config.simulation.exhaustive = true;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+  EXPECT_EQ(ecm.getResults().performedSimulations, 2U);
+}
+
+TEST_F(SimulationTest, EarlyStopping) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  // each basis stimulus misses an error with probability (at most) 1/2, so
+  // four successful simulations suffice for a bound of 0.1
+  config.simulation.falseNegativeBound = 0.1;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+  EXPECT_EQ(ecm.getResults().performedSimulations, 4U);
+  EXPECT_NEAR(ecm.getResults().falseNegativeProbability, 0.0625, 1e-12);
+
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  ec::EquivalenceCheckingManager ecm2(qcOriginal, qcAlternative, config);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+  EXPECT_GE(ecm2.getResults().performedSimulations, 4U);
+  EXPECT_EQ(ecm2.getResults().performedSimulations,
+            ecm2.getResults().startedSimulations);
+  EXPECT_LE(ecm2.getResults().falseNegativeProbability, 0.1);
+}
+
+TEST_F(SimulationTest, AdaptiveStateType) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  config.simulation.adaptiveStateType = true;
+  config.simulation.maxSims = 12U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+  // the adaptive mode is not bound by the number of basis states
+  EXPECT_EQ(ecm.getResults().performedSimulations, 12U);
+
+  // every type of stimuli has been tried, and the quantum stimuli provide more
+  // evidence than basis states
+  const auto basisOnly = std::pow(0.5, 12);
+  EXPECT_LT(ecm.getResults().falseNegativeProbability, basisOnly);
+
+  config.simulation.basisDetectionProbability = 1.;
+  EXPECT_THROW(
+      ec::EquivalenceCheckingManager(qcOriginal, qcAlternative, config),
+      std::invalid_argument);
+}
+
+TEST_F(SimulationTest, CounterexampleStimulusReproducible) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+
+  config.simulation.stimuliPerRun = 4U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  ASSERT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  const auto stimulus = ecm.getResults().cexStimulus;
+  ASSERT_TRUE(stimulus.has_value());
+  EXPECT_EQ(ecm.getResults().json()["simulations"]["counterexample_stimulus"],
+            *stimulus);
+
+  // another process only simulating this stimulus finds the same
+  // counterexample
+  config.simulation.stimuliPerRun = 1U;
+  config.simulation.firstStimulus = *stimulus;
+  config.simulation.maxSims = 1U;
+  ec::EquivalenceCheckingManager single(qcOriginal, qcAlternative, config);
+  single.run();
+  EXPECT_EQ(single.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(single.getResults().cexStimulus, stimulus);
+}
+
+TEST_F(SimulationTest, DisjointStimulusRanges) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_alternative.qasm");
+
+  // the range of stimuli ends at the number of basis states
+  config.simulation.firstStimulus = (1ULL << qcOriginal.getNqubits()) - 2U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  EXPECT_EQ(ecm.getConfiguration().simulation.maxSims, 2U);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+  EXPECT_EQ(ecm.getResults().performedSimulations, 2U);
+}
+
+TEST_F(SimulationTest, CompactCounterexample) {
+  qcOriginal = qasm3::Importer::importf("./circuits/test/test_original.qasm");
+  qcAlternative =
+      qasm3::Importer::importf("./circuits/test/test_erroneous.qasm");
+
+  config.execution.retainCounterexampleDDs = false;
+  config.execution.counterexampleAmplitudes = 2U;
+  ec::EquivalenceCheckingManager ecm(qcOriginal, qcAlternative, config);
+  ecm.run();
+  ASSERT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+  const auto& results = ecm.getResults();
+  // the DDs are released together with the packages of the checkers
+  EXPECT_EQ(results.cexInput.p, nullptr);
+  EXPECT_EQ(results.cexOutput1.p, nullptr);
+
+  ASSERT_TRUE(results.counterexample.has_value());
+  const auto& cex = *results.counterexample;
+  EXPECT_EQ(cex.stimulusType, ec::StateType::ComputationalBasis);
+  ASSERT_TRUE(cex.basisState.has_value());
+  EXPECT_LT(*cex.basisState, 1U << qcOriginal.getNqubits());
+  ASSERT_FALSE(cex.amplitudes.empty());
+  ASSERT_LE(cex.amplitudes.size(), 2U);
+  const auto difference = [](const auto& amplitude) {
+    return std::abs(amplitude.output1 - amplitude.output2);
+  };
+  EXPECT_GT(difference(cex.amplitudes.front()), 0.);
+  EXPECT_GE(difference(cex.amplitudes.front()),
+            difference(cex.amplitudes.back()));
+
+  const auto json = results.json();
+  ASSERT_TRUE(json.contains("counterexample"));
+  EXPECT_EQ(json["counterexample"]["basis_state"], *cex.basisState);
+  EXPECT_EQ(json["counterexample"]["amplitudes"].size(),
+            cex.amplitudes.size());
+}
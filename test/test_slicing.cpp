@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CircuitSlicing.hpp"
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+
+using namespace qc::literals;
+
+class SlicingTest : public testing::Test {
+protected:
+  void SetUp() override {
+    config.execution.parallel = false;
+    config.execution.runSimulationChecker = false;
+    config.execution.runZXChecker = false;
+    config.execution.slices = 4U;
+    // keep the SWAPs in the circuits
+    config.optimizations.elidePermutations = false;
+  }
+
+  // a block of gates that is written differently in both circuits
+  static void addBlock(qc::QuantumComputation& qc, const qc::Qubit q,
+                       const bool rewritten) {
+    qc.t(q);
+    if (rewritten) {
+      qc.h(q + 1U);
+      qc.cz(qc::Control{q}, q + 1U);
+      qc.h(q + 1U);
+    } else {
+      qc.cx(qc::Control{q}, q + 1U);
+    }
+    qc.h(q);
+  }
+
+  static qc::QuantumComputation makeCircuit(const std::size_t blocks,
+                                            const bool rewritten,
+                                            const bool barriers) {
+    auto qc = qc::QuantumComputation(3U);
+    for (std::size_t i = 0U; i < blocks; ++i) {
+      addBlock(qc, static_cast<qc::Qubit>(i % 2U), rewritten);
+      if (barriers && i + 1U < blocks) {
+        qc.barrier();
+      }
+    }
+    return qc;
+  }
+
+  ec::Configuration config{};
+};
+
+TEST_F(SlicingTest, CutAtBarriers) {
+  const auto qc1 = makeCircuit(3U, false, true);
+  const auto qc2 = makeCircuit(3U, true, true);
+  const auto slices = ec::sliceAtCutPoints(qc1, qc2, 2U);
+  ASSERT_EQ(slices.size(), 3U);
+  for (const auto& [slice1, slice2] : slices) {
+    EXPECT_EQ(slice1.getNops(), 3U);
+    EXPECT_EQ(slice2.getNops(), 5U);
+  }
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().slices, 3U);
+  const auto json = ecm.getResults().json();
+  EXPECT_EQ(json["slices"], 3U);
+  for (const auto& checker : json["checkers"]) {
+    EXPECT_TRUE(checker.contains("slice"));
+  }
+}
+
+TEST_F(SlicingTest, ProportionalCuts) {
+  const auto qc1 = makeCircuit(32U, false, false);
+  const auto qc2 = makeCircuit(32U, true, false);
+  const auto slices = ec::sliceAtCutPoints(qc1, qc2, 4U);
+  ASSERT_EQ(slices.size(), 4U);
+  std::size_t nops1 = 0U;
+  std::size_t nops2 = 0U;
+  for (const auto& [slice1, slice2] : slices) {
+    nops1 += slice1.getNops();
+    nops2 += slice2.getNops();
+  }
+  EXPECT_EQ(nops1, qc1.getNops());
+  EXPECT_EQ(nops2, qc2.getNops());
+
+  // the proportional cuts do not need to match, in which case the full check
+  // decides
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().slices, 4U);
+}
+
+TEST_F(SlicingTest, TooSmall) {
+  const auto qc1 = makeCircuit(2U, false, false);
+  const auto qc2 = makeCircuit(2U, true, false);
+  EXPECT_TRUE(ec::sliceAtCutPoints(qc1, qc2, 4U).empty());
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().slices, 0U);
+  EXPECT_FALSE(ecm.getResults().json().contains("slices"));
+}
+
+TEST_F(SlicingTest, NotEquivalentFallsBackToFullCheck) {
+  const auto qc1 = makeCircuit(3U, false, true);
+  auto qc2 = makeCircuit(3U, true, true);
+  qc2.x(2);
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(ecm.getResults().slices, 3U);
+}
+
+TEST_F(SlicingTest, TracksLayoutAcrossSwaps) {
+  // the second circuit swaps the qubits 0 and 1 and relabels the remaining
+  // gates accordingly
+  auto qc1 = qc::QuantumComputation(3U);
+  qc1.h(0);
+  qc1.cx(0_pc, 2);
+  qc1.barrier();
+  qc1.t(0);
+  qc1.cx(1_pc, 0);
+
+  auto qc2 = qc::QuantumComputation(3U);
+  qc2.h(0);
+  qc2.cx(0_pc, 2);
+  qc2.swap(0, 1);
+  qc2.barrier();
+  qc2.t(1);
+  qc2.cx(0_pc, 1);
+  qc2.outputPermutation[0] = 1;
+  qc2.outputPermutation[1] = 0;
+
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().slices, 2U);
+  // the slices are conclusive on their own
+  for (const auto& checker : ecm.getResults().checkerResults) {
+    EXPECT_TRUE(checker.contains("slice"));
+  }
+}
+
+TEST_F(SlicingTest, Parallel) {
+  config.execution.parallel = true;
+  config.execution.nthreads = 2U;
+  const auto qc1 = makeCircuit(5U, false, true);
+  const auto qc2 = makeCircuit(5U, true, true);
+  auto ecm = ec::EquivalenceCheckingManager(qc1, qc2, config);
+  ecm.run();
+  EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().slices, 5U);
+}
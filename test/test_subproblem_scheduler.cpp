@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "SubproblemScheduler.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class SubproblemSchedulerTest : public testing::Test {
+protected:
+  void SetUp() override {
+    config.execution.parallel = false;
+    config.execution.runZXChecker = false;
+    config.simulation.maxSims = 4U;
+
+    auto bell = std::make_shared<qc::QuantumComputation>(2U);
+    bell->h(0);
+    bell->cx(qc::Control{0}, 1);
+    auto flipped = std::make_shared<qc::QuantumComputation>(*bell);
+    flipped->x(1);
+    equivalent = {bell, bell};
+    nonEquivalent = {bell, flipped};
+  }
+
+  // sub-problems checking the pairs with the given equivalence
+  [[nodiscard]] ec::SubproblemScheduler::Factory
+  factory(const std::vector<bool>& equivalences) const {
+    return [this, equivalences](const std::size_t i,
+                                const ec::Configuration& subConfig) {
+      const auto& pair = equivalences[i] ? equivalent : nonEquivalent;
+      return std::make_unique<ec::EquivalenceCheckingManager>(
+          pair.first, pair.second, subConfig);
+    };
+  }
+
+  using Pair = std::pair<std::shared_ptr<const qc::QuantumComputation>,
+                         std::shared_ptr<const qc::QuantumComputation>>;
+  Pair equivalent;
+  Pair nonEquivalent;
+  ec::Configuration config{};
+};
+
+TEST_F(SubproblemSchedulerTest, CancelLater) {
+  ec::SubproblemScheduler::Options options{};
+  options.cancellation = ec::SubproblemScheduler::Cancellation::Later;
+  ec::SubproblemScheduler scheduler(options);
+  const auto results =
+      scheduler.run(3U, config, factory({true, false, true}));
+  ASSERT_EQ(results.size(), 3U);
+  ASSERT_TRUE(results[0].has_value());
+  EXPECT_TRUE(results[0]->consideredEquivalent());
+  ASSERT_TRUE(results[1].has_value());
+  EXPECT_EQ(results[1]->equivalence, ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_FALSE(results[2].has_value());
+  EXPECT_EQ(scheduler.firstDisproof(), 1U);
+  EXPECT_EQ(scheduler.checked(), 2U);
+}
+
+TEST_F(SubproblemSchedulerTest, IndependentSubproblems) {
+  ec::SubproblemScheduler scheduler(ec::SubproblemScheduler::Options{});
+  const auto results =
+      scheduler.run(3U, config, factory({false, true, false}));
+  for (const auto& res : results) {
+    ASSERT_TRUE(res.has_value());
+  }
+  EXPECT_EQ(scheduler.firstDisproof(), 0U);
+  EXPECT_EQ(scheduler.checked(), 3U);
+}
+
+TEST_F(SubproblemSchedulerTest, Concurrent) {
+  ec::SubproblemScheduler::Options options{};
+  options.concurrency = 3U;
+  options.threadPool = std::make_shared<ec::ThreadPool>(2U);
+  ec::SubproblemScheduler scheduler(options);
+
+  std::vector<std::size_t> reported{};
+  const auto results = scheduler.run(
+      8U, config, factory(std::vector(8U, true)),
+      [&reported](const std::size_t index,
+                  const ec::SubproblemScheduler::Results& res) {
+        EXPECT_TRUE(res.consideredEquivalent());
+        reported.emplace_back(index);
+      });
+  EXPECT_EQ(reported.size(), 8U);
+  EXPECT_EQ(scheduler.checked(), 8U);
+  EXPECT_FALSE(scheduler.firstDisproof().has_value());
+}
+
+TEST_F(SubproblemSchedulerTest, SkippedAndFailingSubproblems) {
+  ec::SubproblemScheduler scheduler(ec::SubproblemScheduler::Options{});
+  const auto equivalentPairs = factory({true, true, true});
+  std::mutex mutex;
+  std::vector<std::size_t> created{};
+
+  // skipped sub-problems have no results, while failing ones do not stop
+  // independent sub-problems since the exception is only rethrown at the end
+  EXPECT_THROW(
+      scheduler.run(3U, config,
+                    [&](const std::size_t i, const ec::Configuration& sub)
+                        -> std::unique_ptr<ec::EquivalenceCheckingManager> {
+                      if (i == 0U) {
+                        return nullptr;
+                      }
+                      if (i == 1U) {
+                        throw std::runtime_error("failing sub-problem");
+                      }
+                      const std::lock_guard lock(mutex);
+                      created.emplace_back(i);
+                      return equivalentPairs(i, sub);
+                    }),
+      std::runtime_error);
+  EXPECT_EQ(created, std::vector<std::size_t>{2U});
+  EXPECT_EQ(scheduler.checked(), 1U);
+
+  // cancelled schedulers skip all sub-problems
+  scheduler.cancel();
+  const auto results = scheduler.run(2U, config, equivalentPairs);
+  EXPECT_FALSE(results[0].has_value());
+  EXPECT_FALSE(results[1].has_value());
+}
@@ -85,6 +85,74 @@ TEST_F(SymbolicTest, InvalidCircuit) {
   auto ecm = ec::EquivalenceCheckingManager(qc, qc);
   ecm.run();
 
+  // the circuits cannot be checked by the ZX checker, but their instantiations
+  // can be checked by the DD-based checkers
   EXPECT_EQ(ecm.getResults().equivalence,
-            ec::EquivalenceCriterion::NoInformation);
+            ec::EquivalenceCriterion::Equivalent);
+  EXPECT_EQ(ecm.getResults().performedInstantiations, 2U);
+}
+
+TEST_F(SymbolicTest, NonEquivalentInstantiation) {
+  symQc1.rx(xMonom, 0);
+  symQc2.rx(xMonomNeg, 0);
+
+  ec::Configuration config{};
+  config.execution.parallel = false;
+  config.simulation.seed = 12345U;
+  auto ecm = ec::EquivalenceCheckingManager(symQc1, symQc2, config);
+  ecm.run();
+
+  // both circuits agree on the zero instantiation, but not on the random one
+  EXPECT_EQ(ecm.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(ecm.getResults().performedInstantiations, 2U);
+}
+
+TEST_F(SymbolicTest, ParallelInstantiations) {
+  symQc1.rx(xMonom, 0);
+  symQc2.rx(xMonomNeg, 0);
+
+  ec::Configuration config{};
+  config.parameterized.nAdditionalInstantiations = 8U;
+  config.simulation.seed = 12345U;
+  config.execution.parallel = false;
+  auto sequential = ec::EquivalenceCheckingManager(symQc1, symQc2, config);
+  sequential.run();
+
+  config.execution.parallel = true;
+  config.execution.nthreads = 4U;
+  auto parallel = ec::EquivalenceCheckingManager(symQc1, symQc2, config);
+  parallel.run();
+
+  // the first non-equivalent instantiation is reported in both flows
+  EXPECT_EQ(sequential.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(parallel.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
+  EXPECT_EQ(parallel.getResults().performedInstantiations,
+            sequential.getResults().performedInstantiations);
+}
+
+TEST_F(SymbolicTest, RaceZXAgainstInstantiations) {
+  symQc1.rx(xMonom, 0);
+
+  symQc2.h(0);
+  symQc2.rz(xMonom, 0);
+  symQc2.h(0);
+
+  ec::Configuration config{};
+  config.execution.parallel = true;
+  config.execution.nthreads = 4U;
+  config.parameterized.nAdditionalInstantiations = 4U;
+  auto ecm = ec::EquivalenceCheckingManager(symQc1, symQc2, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+  // the ZX checker cannot show non-equivalence, but the instantiations can
+  symQc2 = QuantumComputation(1);
+  symQc2.rx(xMonomNeg, 0);
+  auto nonEquivalent = ec::EquivalenceCheckingManager(symQc1, symQc2, config);
+  nonEquivalent.run();
+  EXPECT_EQ(nonEquivalent.getResults().equivalence,
+            ec::EquivalenceCriterion::NotEquivalent);
 }
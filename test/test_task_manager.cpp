@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "checker/dd/TaskManager.hpp"
+#include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "checker/dd/applicationscheme/ProportionalApplicationScheme.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+namespace ec {
+class TaskManagerTest : public testing::Test {
+protected:
+  qc::QuantumComputation qc{3U};
+  dd::Package dd{3U};
+
+  void SetUp() override {
+    qc.h(0);
+    qc.swap(0, 1);
+    qc.cx(0, 1);
+    qc.mcx({0, 1}, 2);
+    qc.t(2);
+  }
+};
+
+TEST_F(TaskManagerTest, PositionAndRemaining) {
+  auto tm = TaskManager<dd::MatrixDD>(qc, dd);
+  auto state = dd::Package::makeIdent();
+  tm.incRef(state);
+  EXPECT_EQ(tm.getPosition(), 0U);
+  EXPECT_EQ(tm.getRemaining(), 5U);
+
+  // the SWAP is only tracked in the permutation, but still counts
+  tm.advance(state);
+  EXPECT_EQ(tm.getPosition(), 2U);
+  EXPECT_EQ(tm.getRemaining(), 3U);
+
+  tm.advanceIterator();
+  EXPECT_EQ(tm.getRemaining(), 2U);
+
+  tm.finish(state);
+  EXPECT_TRUE(tm.finished());
+  EXPECT_EQ(tm.getRemaining(), 0U);
+
+  tm.reset();
+  EXPECT_EQ(tm.getPosition(), 0U);
+  EXPECT_EQ(tm.getRemaining(), 5U);
+  tm.decRef(state);
+}
+
+TEST_F(TaskManagerTest, UsedQubitCounts) {
+  auto tm = TaskManager<dd::MatrixDD>(qc, dd);
+  tm.computeUsedQubitCounts();
+  const std::vector<std::size_t> expected{1U, 2U, 2U, 3U, 1U};
+  for (const auto count : expected) {
+    EXPECT_EQ(tm.getUsedQubitCount(), count);
+    tm.advanceIterator();
+  }
+}
+
+TEST_F(TaskManagerTest, CostPrefixSums) {
+  auto tm = TaskManager<dd::MatrixDD>(qc, dd);
+  tm.computeCostPrefixSums(
+      [](const qc::Operation& op) { return op.getNcontrols() + 1U; });
+  const std::vector<std::size_t> expected{0U, 1U, 2U, 4U, 7U, 8U};
+  EXPECT_EQ(tm.getCostPrefixSums(), expected);
+  EXPECT_EQ(tm.getRemainingCost(), 8U);
+
+  tm.advanceIterator();
+  tm.advanceIterator();
+  tm.advanceIterator();
+  EXPECT_EQ(tm.getCurrentCost(), 3U);
+  EXPECT_EQ(tm.getRemainingCost(), 4U);
+}
+
+TEST_F(TaskManagerTest, ProportionalScheme) {
+  auto qc2 = qc::QuantumComputation(3U);
+  qc2.cx(0, 1);
+  qc2.cx(1, 2);
+
+  auto tm1 = TaskManager<dd::MatrixDD>(qc, dd);
+  auto tm2 = TaskManager<dd::MatrixDD>(qc2, dd);
+  auto scheme = ProportionalApplicationScheme<dd::MatrixDD>(tm1, tm2, true);
+
+  // the first operation is a single-qubit gate
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(1U, 1U));
+
+  // four remaining operations on the left versus two on the right
+  tm1.advanceIterator();
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(2U, 1U));
+}
+
+TEST_F(TaskManagerTest, GateCostSchemeBatchesCostlessGates) {
+  auto qc2 = qc::QuantumComputation(3U);
+  qc2.cx(0, 1);
+
+  auto tm1 = TaskManager<dd::MatrixDD>(qc, dd);
+  auto tm2 = TaskManager<dd::MatrixDD>(qc2, dd);
+  auto scheme = GateCostApplicationScheme<dd::MatrixDD>(
+      tm1, tm2,
+      [](const GateCostLookupTableKeyType& key) -> std::size_t {
+        return key.first == qc::H ? 0U : key.second + 1U;
+      },
+      false);
+
+  const auto h = qc::StandardOperation(0, qc::H);
+  const auto x = qc::StandardOperation(qc::Controls{0, 1}, 2, qc::X);
+  EXPECT_EQ(scheme.getCost(h), 0U);
+  EXPECT_EQ(scheme.getCost(x), 3U);
+
+  // the Hadamard gate has no cost and is applied together with the SWAP
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(2U, 1U));
+  tm1.advanceIterator();
+  tm1.advanceIterator();
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(1U, 2U));
+  tm1.advanceIterator();
+  EXPECT_EQ(scheme(), std::make_pair<std::size_t, std::size_t>(1U, 3U));
+}
+} // namespace ec
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, ExecutesAllTasks) {
+  ec::ThreadPool pool(4U);
+  EXPECT_EQ(pool.size(), 4U);
+
+  std::atomic<std::size_t> counter{0U};
+  std::vector<std::future<std::size_t>> futures{};
+  for (std::size_t i = 0U; i < 1000U; ++i) {
+    futures.emplace_back(pool.submit([&counter, i] {
+      ++counter;
+      return i;
+    }));
+  }
+  for (std::size_t i = 0U; i < futures.size(); ++i) {
+    EXPECT_EQ(futures[i].get(), i);
+  }
+  EXPECT_EQ(counter, 1000U);
+}
+
+TEST(ThreadPoolTest, AtLeastOneWorker) {
+  ec::ThreadPool pool(0U);
+  EXPECT_EQ(pool.size(), 1U);
+  EXPECT_EQ(pool.submit([] { return 42; }).get(), 42);
+}
+
+TEST(ThreadPoolTest, PropagatesExceptions) {
+  ec::ThreadPool pool(2U);
+  auto future = pool.submit([] { throw std::runtime_error("error"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, NestedSubmissionDoesNotDeadlock) {
+  ec::ThreadPool pool(1U);
+  auto outer = pool.submit([&pool] {
+    auto inner = pool.submit([] { return 1; });
+    // the single worker is busy, so it has to help processing the task
+    while (inner.wait_for(std::chrono::seconds(0)) !=
+           std::future_status::ready) {
+      pool.runPendingTask();
+    }
+    return inner.get() + 1;
+  });
+  EXPECT_EQ(outer.get(), 2);
+}
+
+TEST(ThreadPoolTest, SharedAcrossManagers) {
+  using namespace qc::literals;
+  qc::QuantumComputation qc1(2U);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+  qc::QuantumComputation qc2(2U);
+  qc2.h(0);
+  qc2.cx(0_pc, 1);
+  qc2.x(1);
+
+  ec::Configuration config{};
+  config.execution.parallel = true;
+  config.execution.nthreads = 4U;
+  config.execution.runZXChecker = false;
+  config.simulation.maxSims = 4U;
+
+  const auto pool = std::make_shared<ec::ThreadPool>(2U);
+
+  ec::EquivalenceCheckingManager ecm1(qc1, qc1, config);
+  ecm1.setThreadPool(pool);
+  ecm1.run();
+  EXPECT_EQ(ecm1.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+  ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+  ecm2.setThreadPool(pool);
+  ecm2.run();
+  EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+  EXPECT_EQ(ecm1.getThreadPool(), pool);
+  EXPECT_EQ(ecm2.getThreadPool(), pool);
+}
+
+TEST(ThreadPoolTest, OwnedPoolIsReusedAcrossRuns) {
+  using namespace qc::literals;
+  qc::QuantumComputation qc1(2U);
+  qc1.h(0);
+  qc1.cx(0_pc, 1);
+
+  ec::Configuration config{};
+  config.execution.parallel = true;
+  config.execution.nthreads = 3U;
+  config.execution.runZXChecker = false;
+  config.simulation.maxSims = 4U;
+
+  ec::EquivalenceCheckingManager ecm(qc1, qc1, config);
+  ecm.run();
+  const auto pool = ecm.getThreadPool();
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->size(), 3U);
+
+  ecm.reset();
+  ecm.run();
+  EXPECT_EQ(ecm.getThreadPool(), pool);
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+}
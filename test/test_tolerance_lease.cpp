@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 - 2026 Chair for Design Automation, TUM
+ * Copyright (c) 2025 - 2026 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "ToleranceLease.hpp"
+#include "dd/ComplexNumbers.hpp"
+#include "dd/DDDefinitions.hpp"
+#include "dd/RealNumber.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+class ToleranceLeaseTest : public testing::Test {
+protected:
+  void TearDown() override { dd::ComplexNumbers::setTolerance(tolerance); }
+
+  dd::fp tolerance = dd::RealNumber::eps;
+};
+
+TEST_F(ToleranceLeaseTest, SharedLeasesAgreeOnTolerance) {
+  const ec::ToleranceLease first(1e-10, false);
+  EXPECT_EQ(dd::RealNumber::eps, 1e-10);
+  const ec::ToleranceLease second(1e-10, false);
+  EXPECT_THROW(ec::ToleranceLease(1e-8, false), std::runtime_error);
+  EXPECT_THROW(ec::ToleranceLease(1e-10, true), std::runtime_error);
+  // a shared lease never changes the tolerance
+  second.use(1e-6);
+  EXPECT_EQ(dd::RealNumber::eps, 1e-10);
+}
+
+TEST_F(ToleranceLeaseTest, ExclusiveLeaseMayChangeTolerance) {
+  {
+    const ec::ToleranceLease lease(1e-12, true);
+    EXPECT_THROW(ec::ToleranceLease(1e-12, false), std::runtime_error);
+    lease.use(1e-6);
+    EXPECT_EQ(dd::RealNumber::eps, 1e-6);
+  }
+  // once released, any tolerance may be claimed again
+  const ec::ToleranceLease lease(1e-13, false);
+  EXPECT_EQ(dd::RealNumber::eps, 1e-13);
+}
+
+TEST_F(ToleranceLeaseTest, ConcurrentManagerWithOtherToleranceIsRejected) {
+  qc::QuantumComputation qc(2U);
+  qc.h(0);
+  qc.cx(qc::Control{0}, 1);
+
+  ec::Configuration config{};
+  config.execution.numericalTolerance = 1e-9;
+  // another check holds the tolerance while the manager is constructed
+  const ec::ToleranceLease other(1e-11, false);
+  EXPECT_THROW(
+      static_cast<void>(ec::EquivalenceCheckingManager(qc, qc, config)),
+      std::runtime_error);
+  config.execution.numericalTolerance = 1e-11;
+  ec::EquivalenceCheckingManager ecm(qc, qc, config);
+  ecm.run();
+  EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+}
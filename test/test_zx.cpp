@@ -461,3 +461,144 @@ TEST_F(ZXTest, EmptyCircuitWithAncillasAndGarbage) {
   EXPECT_EQ(ecm->getResults().equivalence,
             ec::EquivalenceCriterion::Equivalent);
 }
+
+TEST_F(ZXTest, DeepCircuitReducesIncrementally) {
+  // the miter of a deep circuit with itself collapses through many local
+  // rewrites, each of which only touches a small part of the diagram
+  constexpr auto numLayers = 200;
+  constexpr auto nqubits = 4U;
+  qcOriginal = qc::QuantumComputation(nqubits);
+  for (auto i = 0; i < numLayers; ++i) {
+    for (qc::Qubit q = 0U; q < nqubits; ++q) {
+      qcOriginal.h(q);
+      qcOriginal.t(q);
+    }
+    for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+      qcOriginal.cx(q, q + 1U);
+    }
+  }
+  qcAlternative = qcOriginal;
+
+  config.execution.parallel = false;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcAlternative, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm->getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  const auto& checker = json["checkers"].front();
+  EXPECT_EQ(checker["checker"], "zx");
+  EXPECT_GT(checker["rewrites"].get<std::size_t>(), 0U);
+  EXPECT_GT(checker["peak_vertices"].get<std::size_t>(), 0U);
+}
+
+TEST_F(ZXTest, StreamedMiterConsidersLastChunk) {
+  // the miter is built in chunks, so a difference in the very last gate has
+  // to be detected as well
+  constexpr auto numLayers = 100;
+  qcOriginal = qc::QuantumComputation(3U);
+  for (auto i = 0; i < numLayers; ++i) {
+    qcOriginal.h(0);
+    qcOriginal.cx(0, 1);
+    qcOriginal.t(1);
+    qcOriginal.cx(1, 2);
+  }
+  qcAlternative = qcOriginal;
+  qcOriginal.rz(qc::PI / 8, 2);
+
+  config.execution.parallel = false;
+  auto alternative = qcAlternative;
+  alternative.s(2);
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         alternative, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::ProbablyNotEquivalent);
+
+  qcAlternative.p(qc::PI / 8, 2);
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcAlternative, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(ZXTest, ParallelMatching) {
+  constexpr auto numLayers = 200;
+  constexpr auto nqubits = 6U;
+  qcOriginal = qc::QuantumComputation(nqubits);
+  for (auto i = 0; i < numLayers; ++i) {
+    for (qc::Qubit q = 0U; q < nqubits; ++q) {
+      qcOriginal.h(q);
+      qcOriginal.t(q);
+    }
+    for (qc::Qubit q = 0U; q + 1U < nqubits; ++q) {
+      qcOriginal.cx(q, q + 1U);
+    }
+  }
+  qcAlternative = qcOriginal;
+  qcAlternative.z(0);
+
+  // the ZX checker is the only checker and may use all threads
+  config.execution.parallel = false;
+  config.execution.nthreads = 4U;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcOriginal, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+  const auto json = ecm->getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  EXPECT_EQ(json["checkers"].front()["threads"], 4U);
+  // the helpers of the search are run on the thread pool of the manager
+  ASSERT_NE(ecm->getThreadPool(), nullptr);
+  EXPECT_EQ(ecm->getThreadPool()->size(), 4U);
+
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcAlternative, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::ProbablyNotEquivalent);
+}
+
+TEST_F(ZXTest, Instrumentation) {
+  qcOriginal = qc::QuantumComputation(3U);
+  for (auto i = 0; i < 20; ++i) {
+    qcOriginal.h(0);
+    qcOriginal.cx(0, 1);
+    qcOriginal.t(1);
+    qcOriginal.cx(1, 2);
+  }
+  qcAlternative = qcOriginal;
+
+  config.execution.parallel = false;
+  // the stall detection must not interfere with a successful reduction
+  config.functionality.zxStallRounds = 1U;
+  ecm = std::make_unique<ec::EquivalenceCheckingManager>(qcOriginal,
+                                                         qcAlternative, config);
+  ecm->run();
+  EXPECT_EQ(ecm->getResults().equivalence,
+            ec::EquivalenceCriterion::Equivalent);
+
+  const auto json = ecm->getResults().json();
+  ASSERT_EQ(json["checkers"].size(), 1U);
+  const auto& checker = json["checkers"].front();
+  EXPECT_FALSE(checker["stalled"].get<bool>());
+  EXPECT_EQ(checker["edges"], 3U);
+
+  std::size_t applications = 0U;
+  for (const auto& [name, rule] : checker["rules"].items()) {
+    applications += rule["applications"].get<std::size_t>();
+  }
+  EXPECT_EQ(applications, checker["rewrites"].get<std::size_t>());
+  EXPECT_TRUE(checker["rules"].contains("spider_fusion"));
+
+  for (const auto* phase :
+       {"construction", "reduction", "approximation", "verification"}) {
+    EXPECT_GE(checker["phases"][phase].get<double>(), 0.);
+  }
+  ASSERT_FALSE(checker["trace"].empty());
+  EXPECT_EQ(checker["trace"].back()["edges"], 3U);
+}